@@ -0,0 +1,380 @@
+/**
+ * @file bench.c
+ * @brief Host microbenchmarks for the drawing and game step hot paths.
+ *
+ * Built from the firmware sources with the host flags (LCD_HOST and
+ * friends), so what is timed is the code in src/, with the SPI replaced by
+ * a stub that only counts bytes. utils/bench.py builds this at several
+ * optimisation levels, runs it and compares the results with a baseline.
+ *
+ * Each case is one operation, run in batches of at least BENCH_BATCH_NS;
+ * the result is the fastest and the median of BENCH_REPEATS batches, in
+ * nanoseconds per operation, and the bytes the operation sent to the
+ * display. Output is one JSON object on stdout.
+ *
+ * With --soak, it instead plays games back to back with the autopilot
+ * (autopilot.h) for a number of physics steps, headless and from a fixed
+ * seed, so every run plays the same games. It prints the games played,
+ * their scores and the time per step, mean and worst.
+ *
+ * Usage: bench [case...]   (default: every case)
+ *        bench --soak steps
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "stm32f0xx.h"
+#include "lcd.h"
+#include "picture.h"
+#include "assets.h"
+#include "obstacle.h"
+#include "physics.h"
+#include "snapshot.h"
+#include "clock.h"
+#include "spibus.h"
+#include "autopilot.h"
+#include "game.h"
+#include "power.h"
+
+#define BENCH_BATCH_NS 10000000 // 10 ms
+#define BENCH_REPEATS 15
+#define BENCH_BYTES_OPS 256 // operations the SPI byte count is averaged over
+
+#ifndef BENCH_OPT
+#define BENCH_OPT "unknown"
+#endif
+
+GPIO_TypeDef bench_gpiob;
+SPI_TypeDef bench_spi1;
+
+/* The display: count what would have gone out */
+void lcd_host_put(u16 data, int wide)
+{
+    (void)data;
+    (void)wide;
+}
+
+void lcd_host_dma(const void *buf, unsigned int count, int wide, int increment)
+{
+    (void)buf;
+    (void)count;
+    (void)wide;
+    (void)increment;
+}
+
+u8 lcd_host_get(void)
+{
+    return 0;
+}
+
+/* lcd_spi_bytes does the counting; the pins and timebase are stand-ins */
+void init_lcd_spi(void)
+{
+    spibus_init();
+}
+
+uint32_t micros(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint32_t)(t.tv_sec * 1000000 + t.tv_nsec / 1000);
+}
+
+void nano_wait(unsigned int t)
+{
+    (void)t;
+}
+
+void delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+#define TempPicturePtr(name, width, height) Picture name[(width) * (height) / 6 + 2] = {{width, height, 2}}
+
+TempPicturePtr(screen_pic, LCD_W, LCD_H);
+TempPicturePtr(box_pic, 29, 29);
+TempPicturePtr(bird_pic, 19, 19);
+
+static ObstaclePool pool;
+static ObstacleScreen screen;
+static ObstacleView view;
+static Autopilot autopilot;
+static unsigned int n; // operations so far, to vary the arguments
+static int crowd;      // barriers the obstacles_draw_N cases keep on screen, or 0
+static volatile int sink;
+
+/* Start a game as play() does: the bird at the start and one barrier. */
+static void new_game(void)
+{
+    obstacles_reset(&barriers, OBSTACLE_MAX, BARRIER_SPACING);
+    obstacle_spawn(&barriers, FIX(BARRIER_Y0), FIX(BARRIER_V0), FIRST_GAP);
+    game_reset();
+}
+
+/* For obstacles_draw_N: a pool of N, spawning as close together as bands may be, stepped and drawn until it
+   is full. A barrier that leaves is replaced in the same step, so there are N on screen from then on. */
+static void fill_crowd(void)
+{
+    obstacles_reset(&pool, crowd, BARRIER_HEIGHT + BARRIER_V0);
+    while (pool.nactive < crowd)
+    {
+        obstacles_step(&pool);
+        obstacles_view(&pool, &view);
+        obstacles_draw(&screen, &view, 0);
+    }
+}
+
+/* Reset everything a case may have changed. */
+static void setup(void)
+{
+    // through a plain pointer: indexing pix2, a zero-length array, past 0 draws -Wzero-length-bounds
+    u16 *pix = screen_pic->pix2;
+    for (int i = 0; i < LCD_W * LCD_H; i++)
+        pix[i] = (u16)(i * 2654435761u >> 16);
+    pix = bird_pic->pix2;
+    for (int i = 0; i < 19 * 19; i++)
+        pix[i] = 0xffff;
+    asset_overlay(bird_pic, 0, 0, &bird, 0);
+
+    srand(1);
+    obstacles_clear_screen(&screen, &background);
+    obstacles_reset(&pool, OBSTACLE_MAX, BARRIER_SPACING);
+    obstacle_spawn(&pool, FIX(BARRIER_Y0), FIX(BARRIER_V0), 70);
+    if (crowd)
+        fill_crowd();
+    new_game();
+    autopilot_init(&autopilot, BIRD_GRAVITY, BIRD_FLAP, BIRD_MIN_X, BIRD_MAX_X, BIRD_Y0);
+    game_init();
+    publish_game();
+    n = 0;
+}
+
+static void run_pic_subset(void)
+{
+    pic_subset(box_pic, screen_pic, n % (LCD_W - 29), n % (LCD_H - 29));
+}
+
+static void run_pic_overlay(void)
+{
+    pic_overlay(box_pic, 5, 5, bird_pic, 0xffff);
+}
+
+/* A barrier's per-step work: move, then redraw its band and what it uncovered */
+static void run_obstacles_draw(void)
+{
+    obstacles_step(&pool);
+    obstacles_view(&pool, &view);
+    obstacles_draw(&screen, &view, 0);
+}
+
+/* A barrier-sized solid band */
+static void run_lcd_fill(void)
+{
+    u16 y = n % (LCD_H - 20);
+    LCD_DrawFillRectangle(0, y, LCD_W - 1, y + 19, (u16)n);
+}
+
+static void run_lcd_draw_picture(void)
+{
+    LCD_DrawPicture(n % (LCD_W - 29), 140 - 14, box_pic);
+}
+
+static void run_lcd_draw_char(void)
+{
+    LCD_DrawChar(n % (LCD_W - 8), 0, WHITE, BLACK, 'A' + n % 26, 16, 0);
+}
+
+static void run_lcd_draw_char_transparent(void)
+{
+    LCD_DrawChar(n % (LCD_W - 8), 0, WHITE, BLACK, 'A' + n % 26, 16, 1);
+}
+
+/* A physics step as the TIM16 handler runs it. Returns 1 if the bird crashed; the game then starts
+   over with the same barriers, so every step of a batch costs about the same. */
+static int step(int pressed)
+{
+    sink = game_step(pressed);
+    publish_game();
+    if (!game_over)
+        return 0;
+    game_reset();
+    publish_game();
+    return 1;
+}
+
+/* The autopilot's decision for the next step, from the published state as main.c's autopilot task makes it */
+static int fly(void)
+{
+    GameView played;
+    snapshot_read(&game, &played);
+    return autopilot_press(&autopilot, &played.bird, &played.barriers);
+}
+
+/* The button held one step in three */
+static void run_game_step(void)
+{
+    step((n / 20) % 3 == 0);
+}
+
+/* The autopilot's decision and the step it makes */
+static void run_autopilot(void)
+{
+    step(fly());
+}
+
+typedef struct
+{
+    const char *name;
+    void (*run)(void);
+    int crowd; // barriers on screen throughout, for the obstacles_draw_N cases
+} BenchCase;
+
+static const BenchCase cases[] = {
+    {"pic_subset", run_pic_subset},
+    {"pic_overlay", run_pic_overlay},
+    {"obstacles_draw", run_obstacles_draw},
+    {"obstacles_draw_1", run_obstacles_draw, 1},
+    {"obstacles_draw_2", run_obstacles_draw, 2},
+    {"obstacles_draw_3", run_obstacles_draw, 3},
+    {"obstacles_draw_4", run_obstacles_draw, 4},
+    {"obstacles_draw_5", run_obstacles_draw, 5},
+    {"obstacles_draw_6", run_obstacles_draw, 6},
+    {"obstacles_draw_7", run_obstacles_draw, 7},
+    {"obstacles_draw_8", run_obstacles_draw, 8},
+    {"lcd_fill", run_lcd_fill},
+    {"lcd_draw_picture", run_lcd_draw_picture},
+    {"lcd_draw_char", run_lcd_draw_char},
+    {"lcd_draw_char_transparent", run_lcd_draw_char_transparent},
+    {"game_step", run_game_step},
+    {"autopilot", run_autopilot},
+};
+
+static uint64_t now_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Time one case and print its JSON member.
+ * @param c The case.
+ * @param first Whether it is the first member printed.
+ * @return void
+ */
+static void bench(const BenchCase *c, int first)
+{
+    // bytes sent, over few enough operations that the count cannot wrap
+    crowd = c->crowd;
+    setup();
+    uint32_t bytes0 = lcd_spi_bytes;
+    for (int i = 0; i < BENCH_BYTES_OPS; i++, n++)
+        c->run();
+    double bytes = (double)(uint32_t)(lcd_spi_bytes - bytes0) / BENCH_BYTES_OPS;
+
+    // find a batch size that takes long enough to time
+    unsigned long iters = 1;
+    for (;;)
+    {
+        setup();
+        uint64_t t0 = now_ns();
+        for (unsigned long i = 0; i < iters; i++, n++)
+            c->run();
+        if (now_ns() - t0 >= BENCH_BATCH_NS / 4)
+            break;
+        iters *= 2;
+    }
+    iters *= 4;
+
+    // every batch starts from the same state, so runs the same operations
+    double ns[BENCH_REPEATS];
+    for (int r = 0; r < BENCH_REPEATS; r++)
+    {
+        setup();
+        uint64_t t0 = now_ns();
+        for (unsigned long i = 0; i < iters; i++, n++)
+            c->run();
+        ns[r] = (double)(now_ns() - t0) / iters;
+    }
+    qsort(ns, BENCH_REPEATS, sizeof ns[0], compare_double);
+
+    printf("%s\n    \"%s\": {\"ns\": %.1f, \"median_ns\": %.1f, \"spi_bytes\": %.1f, \"iterations\": %lu}",
+           first ? "" : ",", c->name, ns[0], ns[BENCH_REPEATS / 2], bytes, iters);
+    fflush(stdout);
+}
+
+/**
+ * @brief Play games with the autopilot for a number of physics steps and print the JSON results.
+ * Each game starts as play() starts one, and the bird does not draw, so this is the physics step alone.
+ * @param steps The physics steps to run.
+ * @return void
+ */
+static void soak(unsigned long steps)
+{
+    setup();
+    unsigned long games = 0, best = 0, points = 0;
+    uint64_t worst = 0;
+    uint64_t t0 = now_ns();
+    for (unsigned long i = 0; i < steps; i++, n++)
+    {
+        uint64_t s = now_ns();
+        game_step(fly());
+        publish_game();
+        uint64_t ns = now_ns() - s;
+        if (ns > worst)
+            worst = ns;
+        if (game_over)
+        {
+            games++;
+            points += score;
+            if ((unsigned long)score > best)
+                best = score;
+            new_game();
+            publish_game();
+        }
+    }
+    double total = (double)(now_ns() - t0);
+    if ((unsigned long)score > best)
+        best = score;
+
+    printf("{\n  \"opt\": \"%s\",\n  \"compiler\": \"%s\",\n  \"soak\": {\"steps\": %lu, \"crashes\": %lu, "
+           "\"best_score\": %lu, \"mean_score\": %.1f, \"ns_per_step\": %.1f, \"worst_step_ns\": %.0f}\n}\n",
+           BENCH_OPT, __VERSION__, steps, games, best, games ? (double)points / games : (double)score,
+           total / steps, (double)worst);
+}
+
+int main(int argc, char **argv)
+{
+    clock_init();
+    LCD_Setup();
+
+    if (argc == 3 && strcmp(argv[1], "--soak") == 0)
+    {
+        soak(strtoul(argv[2], 0, 10));
+        return 0;
+    }
+
+    printf("{\n  \"opt\": \"%s\",\n  \"compiler\": \"%s\",\n  \"cases\": {", BENCH_OPT, __VERSION__);
+    int first = 1;
+    for (unsigned int i = 0; i < sizeof cases / sizeof cases[0]; i++)
+    {
+        int wanted = argc < 2;
+        for (int a = 1; a < argc; a++)
+            wanted |= strcmp(argv[a], cases[i].name) == 0;
+        if (!wanted)
+            continue;
+        bench(&cases[i], first);
+        first = 0;
+    }
+    printf("\n  }\n}\n");
+    return 0;
+}
@@ -0,0 +1,36 @@
+#ifndef BENCH_STM32F0XX_H
+#define BENCH_STM32F0XX_H
+
+#include <stdint.h>
+
+/*
+ * Host stand-in for the device header, for the benchmarks and the host
+ * tests. With LCD_HOST and the other host flags, lcd.c is the only source
+ * that still touches registers: the DC and RESET pins and the SPI busy
+ * flag. Here they are plain memory, defined in bench.c, or in
+ * test/fake_lcd.c for the tests.
+ */
+
+typedef struct
+{
+    volatile uint32_t BSRR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t SR;
+} SPI_TypeDef;
+
+extern GPIO_TypeDef bench_gpiob;
+extern SPI_TypeDef bench_spi1;
+
+#define GPIOB (&bench_gpiob)
+#define SPI1 (&bench_spi1)
+
+#define GPIO_BSRR_BS_11 (1u << 11)
+#define GPIO_BSRR_BS_14 (1u << 14)
+#define GPIO_BSRR_BR_11 (1u << 27)
+#define GPIO_BSRR_BR_14 (1u << 30)
+#define SPI_SR_BSY (1u << 7)
+
+#endif /* BENCH_STM32F0XX_H */
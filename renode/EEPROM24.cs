@@ -0,0 +1,96 @@
+//
+// 24-series I2C EEPROM on I2C1 (address 0x57), for the Flappy Chip
+// simulation: 4 KiB in 32-byte pages, addressed by two bytes after the
+// device address. A write wraps within its page, as on the part; a read
+// carries on from wherever the last access left off. The write cycle
+// takes no time here, and the firmware waits it out anyway.
+//
+// Load() and Save() keep the contents (the high score) across runs.
+//
+using System;
+using System.IO;
+using System.Collections.Generic;
+using Antmicro.Renode.Core;
+using Antmicro.Renode.Logging;
+
+namespace Antmicro.Renode.Peripherals.I2C
+{
+    public class EEPROM24 : II2CPeripheral
+    {
+        public EEPROM24(int size = 4096, int pageSize = 32)
+        {
+            memory = new byte[size];
+            this.pageSize = pageSize;
+            Erase();
+            Reset();
+        }
+
+        public void Reset()
+        {
+            address = 0;
+            addressBytes = 0;
+        }
+
+        public void Erase()
+        {
+            for(var i = 0; i < memory.Length; i++)
+            {
+                memory[i] = 0xFF;
+            }
+        }
+
+        public void Load(string path)
+        {
+            var data = File.ReadAllBytes(path);
+            Array.Copy(data, memory, Math.Min(data.Length, memory.Length));
+        }
+
+        public void Save(string path)
+        {
+            File.WriteAllBytes(path, memory);
+        }
+
+        public void Write(byte[] data)
+        {
+            foreach(var b in data)
+            {
+                if(addressBytes < 2)
+                {
+                    address = (address << 8 | b) & (memory.Length - 1);
+                    addressBytes++;
+                    continue;
+                }
+                var page = address & ~(pageSize - 1);
+                memory[address] = b;
+                address = page | ((address + 1) & (pageSize - 1));
+                Writes++;
+            }
+        }
+
+        public byte[] Read(int count = 1)
+        {
+            var result = new List<byte>();
+            for(var i = 0; i < count; i++)
+            {
+                result.Add(memory[address]);
+                address = (address + 1) & (memory.Length - 1);
+            }
+            Reads += (ulong)count;
+            return result.ToArray();
+        }
+
+        public void FinishTransmission()
+        {
+            // the next write starts with an address
+            addressBytes = 0;
+        }
+
+        public ulong Writes { get; private set; } // bytes written
+        public ulong Reads { get; private set; }  // bytes read
+
+        private readonly byte[] memory;
+        private readonly int pageSize;
+        private int address;
+        private int addressBytes;
+    }
+}
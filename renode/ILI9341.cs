@@ -0,0 +1,270 @@
+//
+// ILI9341 display controller on SPI1, for the Flappy Chip simulation.
+//
+// Enough of the controller for the firmware: CASET/PASET windows, RAMWR and
+// Memory Write Continue (0x3C) into a 240x320 RGB565 frame memory, MADCTL's
+// row/column exchange, and the two reads LCD_LinkTest() makes (Read ID4 and
+// RAMRD), each answered after a dummy byte. Every other command is counted
+// and its parameters ignored.
+//
+// GPIO 0 is DC (high for data) and GPIO 1 is the display's chip select
+// (active low). SPI1 also carries the SD card, which is not modelled:
+// bytes sent while the display is deselected are left alone and read back
+// as 0xFF, as from a card slot with no card in it.
+//
+using System;
+using System.IO;
+using Antmicro.Renode.Core;
+using Antmicro.Renode.Logging;
+
+namespace Antmicro.Renode.Peripherals.SPI
+{
+    public class ILI9341 : ISPIPeripheral, IGPIOReceiver
+    {
+        public ILI9341()
+        {
+            frame = new ushort[Width * Height];
+            Reset();
+        }
+
+        public void Reset()
+        {
+            Array.Clear(frame, 0, frame.Length);
+            selected = false;
+            dataMode = true;
+            command = 0;
+            count = 0;
+            xs = 0;
+            xe = Width - 1;
+            ys = 0;
+            ye = Height - 1;
+            exchange = false;
+            Bytes = 0;
+            Commands = 0;
+            Pixels = 0;
+            Windows = 0;
+            Reads = 0;
+        }
+
+        public void OnGPIO(int number, bool value)
+        {
+            if(number == 0)
+            {
+                dataMode = value;
+            }
+            else if(number == 1)
+            {
+                selected = !value;
+            }
+        }
+
+        public byte Transmit(byte data)
+        {
+            if(!selected)
+            {
+                return 0xFF;
+            }
+            Bytes++;
+            if(!dataMode)
+            {
+                Command(data);
+                return 0;
+            }
+            return Data(data);
+        }
+
+        public void FinishTransmission()
+        {
+        }
+
+        // Write the frame memory out as a binary PPM.
+        public void SaveFrame(string path)
+        {
+            using(var f = File.Create(path))
+            {
+                var header = System.Text.Encoding.ASCII.GetBytes(string.Format("P6\n{0} {1}\n255\n", Width, Height));
+                f.Write(header, 0, header.Length);
+                foreach(var p in frame)
+                {
+                    f.WriteByte((byte)((p >> 11) << 3));
+                    f.WriteByte((byte)(((p >> 5) & 0x3F) << 2));
+                    f.WriteByte((byte)((p & 0x1F) << 3));
+                }
+            }
+        }
+
+        // Hash of the frame memory, to compare runs without saving pictures.
+        public uint FrameHash()
+        {
+            uint h = 2166136261;
+            foreach(var p in frame)
+            {
+                h = (h ^ (uint)(p >> 8)) * 16777619;
+                h = (h ^ (uint)(p & 0xFF)) * 16777619;
+            }
+            return h;
+        }
+
+        public ulong Bytes { get; private set; }    // clocked while selected
+        public ulong Commands { get; private set; }
+        public ulong Pixels { get; private set; }   // written to frame memory
+        public ulong Windows { get; private set; }  // CASET and PASET
+        public ulong Reads { get; private set; }    // read commands
+
+        private void Command(byte data)
+        {
+            Commands++;
+            command = data;
+            count = 0;
+            switch(data)
+            {
+            case 0x2C: // RAMWR
+                cx = xs;
+                cy = ys;
+                break;
+            case 0x2E: // RAMRD
+                cx = xs;
+                cy = ys;
+                Reads++;
+                break;
+            case 0xD3: // Read ID4
+                Reads++;
+                break;
+            case 0x2A:
+            case 0x2B:
+                Windows++;
+                break;
+            }
+        }
+
+        private byte Data(byte data)
+        {
+            var n = count++;
+            switch(command)
+            {
+            case 0x2A: // CASET
+            case 0x2B: // PASET
+                if(n < 4)
+                {
+                    param[n] = data;
+                }
+                if(n == 3)
+                {
+                    var start = param[0] << 8 | param[1];
+                    var end = param[2] << 8 | param[3];
+                    if(command == 0x2A)
+                    {
+                        xs = start;
+                        xe = end;
+                    }
+                    else
+                    {
+                        ys = start;
+                        ye = end;
+                    }
+                }
+                return 0;
+            case 0x36: // MADCTL
+                exchange = (data & 0x20) != 0;
+                return 0;
+            case 0x2C: // RAMWR
+            case 0x3C: // Memory Write Continue
+                if(n % 2 == 0)
+                {
+                    high = data;
+                }
+                else
+                {
+                    Put((ushort)(high << 8 | data));
+                }
+                return 0;
+            case 0xD3: // Read ID4: dummy, version, 0x93, 0x41
+                return n == 2 ? (byte)0x93 : n == 3 ? (byte)0x41 : (byte)0;
+            case 0x2E: // RAMRD: dummy, then 6 bits of each color left aligned in a byte
+                if(n == 0)
+                {
+                    return 0;
+                }
+                if((n - 1) % 3 == 0)
+                {
+                    readPixel = Get();
+                }
+                switch((n - 1) % 3)
+                {
+                case 0:
+                    return (byte)(Expand5(readPixel >> 11) << 2);
+                case 1:
+                    return (byte)(((readPixel >> 5) & 0x3F) << 2);
+                default:
+                    return (byte)(Expand5(readPixel & 0x1F) << 2);
+                }
+            default:
+                return 0;
+            }
+        }
+
+        private static int Expand5(int v)
+        {
+            return v << 1 | v >> 4;
+        }
+
+        private int Index()
+        {
+            int x = cx, y = cy;
+            if(exchange)
+            {
+                x = cy;
+                y = cx;
+            }
+            return x < Width && y < Height ? y * Width + x : -1;
+        }
+
+        private void Advance()
+        {
+            if(++cx > xe)
+            {
+                cx = xs;
+                if(++cy > ye)
+                {
+                    cy = ys;
+                }
+            }
+        }
+
+        private void Put(ushort pixel)
+        {
+            var i = Index();
+            if(i >= 0)
+            {
+                frame[i] = pixel;
+            }
+            else
+            {
+                this.Log(LogLevel.Debug, "Pixel outside frame memory at {0},{1}", cx, cy);
+            }
+            Pixels++;
+            Advance();
+        }
+
+        private ushort Get()
+        {
+            var i = Index();
+            Advance();
+            return i >= 0 ? frame[i] : (ushort)0;
+        }
+
+        private const int Width = 240;
+        private const int Height = 320;
+
+        private readonly ushort[] frame;
+        private readonly byte[] param = new byte[4];
+        private bool selected;
+        private bool dataMode;
+        private byte command;
+        private int count;
+        private byte high;
+        private ushort readPixel;
+        private int xs, xe, ys, ye, cx, cy;
+        private bool exchange;
+    }
+}
@@ -0,0 +1,87 @@
+//
+// The 8-segment displays on SPI2, for the Flappy Chip simulation. The
+// firmware sends each digit as a 16-bit frame, most significant byte
+// first: the digit number (0 to 7, decoded by the 74HC138) and then its
+// segments. DMA repeats the eight frames for as long as the game runs, so
+// Text is always what the displays show.
+//
+using System;
+using System.Text;
+using Antmicro.Renode.Core;
+
+namespace Antmicro.Renode.Peripherals.SPI
+{
+    public class ShiftChain : ISPIPeripheral
+    {
+        public ShiftChain()
+        {
+            Reset();
+        }
+
+        public void Reset()
+        {
+            Array.Clear(segments, 0, segments.Length);
+            second = false;
+            Frames = 0;
+        }
+
+        public byte Transmit(byte data)
+        {
+            if(!second)
+            {
+                digit = data & 7;
+            }
+            else
+            {
+                segments[digit] = data;
+                Frames++;
+            }
+            second = !second;
+            return 0;
+        }
+
+        public void FinishTransmission()
+        {
+            second = false;
+        }
+
+        // The segments of each digit, left to right, as hex.
+        public string Segments
+        {
+            get
+            {
+                var s = new StringBuilder();
+                foreach(var b in segments)
+                {
+                    s.AppendFormat("{0:X2} ", b);
+                }
+                return s.ToString().TrimEnd();
+            }
+        }
+
+        // What the displays show, for the characters the font can tell apart.
+        public string Text
+        {
+            get
+            {
+                var s = new StringBuilder();
+                foreach(var b in segments)
+                {
+                    var i = Array.IndexOf(Glyphs, (byte)(b & 0x7F));
+                    s.Append(i < 0 ? '?' : GlyphChars[i]);
+                }
+                return s.ToString();
+            }
+        }
+
+        public ulong Frames { get; private set; }
+
+        // from font[] in src/score_display.c: digits, then some letters of the readouts ('s' is '5')
+        private static readonly byte[] Glyphs = { 0x00, 0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x07, 0x7f, 0x67, 0x71, 0x73, 0x10, 0x40 };
+        private const string GlyphChars = " 0123456789Fpi-";
+
+        private readonly byte[] segments = new byte[8];
+        private int digit;
+        private bool second;
+    }
+}
@@ -0,0 +1,109 @@
+/**
+ * @file arena.c
+ * @brief Bump-pointer arena for transient drawing buffers. See arena.h.
+ */
+
+#include "arena.h"
+
+static uint32_t frame_mem[FRAME_ARENA_SIZE / 4];
+Arena frame_arena = ARENA(frame_mem);
+
+/**
+ * @brief Set up an arena over a block of memory.
+ * @param a The arena.
+ * @param mem The memory, 4-byte aligned.
+ * @param size Its size in bytes.
+ * @return void
+ */
+void arena_init(Arena *a, void *mem, uint32_t size)
+{
+    a->base = mem;
+    a->size = size;
+    a->used = 0;
+    a->peak = 0;
+    a->overflows = 0;
+}
+
+/**
+ * @brief Take bytes from an arena.
+ * @param a The arena.
+ * @param bytes How many, rounded up to ARENA_ALIGN.
+ * @return The memory, or 0 if there is not enough left (counted in a->overflows).
+ */
+void *arena_alloc(Arena *a, uint32_t bytes)
+{
+    uint32_t room = a->size - a->used;
+    uint32_t take = (bytes + ARENA_ALIGN - 1) & ~(uint32_t)(ARENA_ALIGN - 1);
+    if (bytes > room || take > room) // take wraps to 0 for a request within 3 bytes of 4 GB
+    {
+        a->overflows++;
+        return 0;
+    }
+    void *p = a->base + a->used;
+    a->used += take;
+    if (a->used > a->peak)
+        a->peak = a->used;
+    return p;
+}
+
+/**
+ * @brief Take an RGB565 Picture from an arena, with its header filled in and its pixels not.
+ * @param a The arena.
+ * @param width The width.
+ * @param height The height.
+ * @return The picture, or 0 if it does not fit.
+ */
+Picture *arena_picture(Arena *a, unsigned int width, unsigned int height)
+{
+    Picture *pic = arena_alloc(a, sizeof(Picture) + 2 * width * height);
+    if (pic)
+    {
+        pic->width = width;
+        pic->height = height;
+        pic->bytes_per_pixel = 2;
+    }
+    return pic;
+}
+
+/**
+ * @brief Take a row of RGB565 pixels from an arena.
+ * @param a The arena.
+ * @param n The number of pixels.
+ * @return The row, 4-byte aligned, or 0 if it does not fit.
+ */
+u16 *arena_line(Arena *a, unsigned int n)
+{
+    return arena_alloc(a, 2 * n);
+}
+
+/**
+ * @brief Note how much of an arena is in use, to release back to later.
+ * @param a The arena.
+ * @return The mark.
+ */
+uint32_t arena_mark(const Arena *a)
+{
+    return a->used;
+}
+
+/**
+ * @brief Give back everything allocated since a mark.
+ * @param a The arena.
+ * @param mark From arena_mark().
+ * @return void
+ */
+void arena_release(Arena *a, uint32_t mark)
+{
+    if (mark < a->used)
+        a->used = mark;
+}
+
+/**
+ * @brief Give back everything. peak and overflows are kept.
+ * @param a The arena.
+ * @return void
+ */
+void arena_reset(Arena *a)
+{
+    a->used = 0;
+}
@@ -0,0 +1,51 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdint.h>
+#include "lcd.h"
+
+/*
+ * Bump-pointer arena for the transient buffers of drawing: composition
+ * rows and text rows, sized to what is being drawn instead of to the
+ * largest thing that could be. Nothing is freed on its own; a caller
+ * takes an arena_mark() before allocating and hands it back to
+ * arena_release() when done, so allocations nest like stack frames.
+ * draw_frame() also resets frame_arena at the start of every frame, so a
+ * missed release costs one frame, not the arena.
+ *
+ * Allocations are 4-byte aligned. One that does not fit returns 0 and is
+ * counted in overflows; the caller skips the drawing that needed it. peak
+ * is the most ever in use at once, the number to size FRAME_ARENA_SIZE by.
+ *
+ * An arena belongs to one context at a time. frame_arena is only used by
+ * code that draws on the display, which never runs in two contexts at
+ * once anyway.
+ */
+
+#define ARENA_ALIGN 4
+#define FRAME_ARENA_SIZE 2048 // three rows of a full display width, with their Picture headers
+
+typedef struct
+{
+    uint8_t *base;
+    uint32_t size;
+    uint32_t used;
+    uint32_t peak;      // most bytes in use at once
+    uint32_t overflows; // allocations refused for lack of room
+} Arena;
+
+/* An arena over a static array, for use as an initializer */
+#define ARENA(mem) {(uint8_t *)(mem), sizeof(mem), 0, 0, 0}
+
+extern Arena frame_arena;
+
+/* Function Prototypes */
+void arena_init(Arena *a, void *mem, uint32_t size);
+void *arena_alloc(Arena *a, uint32_t bytes);
+Picture *arena_picture(Arena *a, unsigned int width, unsigned int height);
+u16 *arena_line(Arena *a, unsigned int n);
+uint32_t arena_mark(const Arena *a);
+void arena_release(Arena *a, uint32_t mark);
+void arena_reset(Arena *a);
+
+#endif /* ARENA_H */
@@ -0,0 +1,28 @@
+// Generated by utils/assetc.py from assets/assets.json. Do not edit.
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include "picture.h"
+
+/* background: 240x320 tiled (16x16 tiles, 2 distinct), 1324 bytes (raw 153600) */
+#define ASSET_BACKGROUND_WIDTH 240
+#define ASSET_BACKGROUND_HEIGHT 320
+#define ASSET_BACKGROUND_FORMAT ASSET_TILED
+#define ASSET_BACKGROUND_BYTES 1324
+extern const Asset background;
+
+/* barrier: 220x20 rle (20 runs), 122 bytes (raw 8800) */
+#define ASSET_BARRIER_WIDTH 220
+#define ASSET_BARRIER_HEIGHT 20
+#define ASSET_BARRIER_FORMAT ASSET_RLE
+#define ASSET_BARRIER_BYTES 122
+extern const Asset barrier;
+
+/* bird: 19x19 indexed (2 bpp, 1 colors), 236 bytes (raw 722) */
+#define ASSET_BIRD_WIDTH 19
+#define ASSET_BIRD_HEIGHT 19
+#define ASSET_BIRD_FORMAT ASSET_INDEXED
+#define ASSET_BIRD_BYTES 236
+extern const Asset bird;
+
+#endif /* ASSETS_H */
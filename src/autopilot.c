@@ -0,0 +1,80 @@
+/**
+ * @file autopilot.c
+ * @brief Flies the bird through the gaps, for demo games and soak runs. See autopilot.h.
+ */
+
+#include "autopilot.h"
+
+/**
+ * @brief Set up an autopilot for a game's physics.
+ * @param a The autopilot.
+ * @param gravity The bird's acceleration per step with the button up.
+ * @param flap The bird's velocity while the button is held.
+ * @param floor The lowest bird position that is not a crash.
+ * @param ceiling The highest bird position.
+ * @param column The display column the bird flies in.
+ * @return void
+ */
+void autopilot_init(Autopilot *a, fix gravity, fix flap, int floor, int ceiling, int column)
+{
+    a->gravity = gravity;
+    a->flap = flap;
+    a->floor = floor;
+    a->ceiling = ceiling;
+    a->column = column;
+}
+
+/* Steps the bird lasts, up to AUTOPILOT_LOOKAHEAD, if it presses on step press_at (1 is the
+   next step, 0 never) and otherwise lets go. Follows game_step() and obstacles_collide(). */
+static int lasts(const Autopilot *a, const Body *bird, const ObstacleView *barriers, int press_at)
+{
+    fix pos = bird->pos;
+    fix vel = bird->vel;
+    for (int j = 1; j <= AUTOPILOT_LOOKAHEAD; j++)
+    {
+        if (j == press_at)
+            vel = a->flap;
+        else
+            vel += a->gravity;
+        pos += vel;
+
+        int x = FIX_INT(pos);
+        if (x < a->floor)
+            return j - 1;
+        for (int i = 0; i < barriers->count; i++)
+        {
+            // barriers move after the bird in a step, so on step j they are j - 1 steps on
+            const BarrierView *o = &barriers->barrier[i];
+            int oy = FIX_INT(o->y - (j - 1) * (o->prev_y - o->y));
+            if (a->column > oy - (BARRIER_HEIGHT >> 1) && a->column < oy + (BARRIER_HEIGHT >> 1) &&
+                (x < o->gap || x > o->gap + GAP_WIDTH))
+                return j - 1;
+        }
+
+        if (pos > FIX(a->ceiling))
+            pos = FIX(a->ceiling);
+    }
+    return AUTOPILOT_LOOKAHEAD;
+}
+
+/**
+ * @brief Decide whether the button should be held for the next physics step.
+ * @param a The autopilot.
+ * @param bird The bird, as the last step left it.
+ * @param barriers The barriers, as the last step left them.
+ * @return 1 to hold the button, 0 to let go.
+ */
+int autopilot_press(const Autopilot *a, const Body *bird, const ObstacleView *barriers)
+{
+    // let go if the bird can fall, or can press later, and last the whole look-ahead
+    int best = lasts(a, bird, barriers, 0);
+    for (int p = 2; p <= AUTOPILOT_LOOKAHEAD && best < AUTOPILOT_LOOKAHEAD; p++)
+    {
+        int n = lasts(a, bird, barriers, p);
+        if (n > best)
+            best = n;
+    }
+    if (best == AUTOPILOT_LOOKAHEAD)
+        return 0;
+    return lasts(a, bird, barriers, 1) >= best; // otherwise whichever puts off a crash longest
+}
@@ -0,0 +1,47 @@
+#ifndef AUTOPILOT_H
+#define AUTOPILOT_H
+
+#include "physics.h"
+#include "obstacle.h"
+
+/*
+ * Autopilot. Once per physics step, before the step, it decides whether the
+ * button should be held, by running the bird and the barriers forward
+ * AUTOPILOT_LOOKAHEAD steps with the same motion and crash rules as the
+ * game. It tries three plans: let go throughout, press now, and press on
+ * the next step. It lets go if falling is safe over the whole look-ahead,
+ * or if the press can wait a step. Otherwise it presses, unless pressing now
+ * crashes sooner than waiting. A press lifts the bird about 35 pixels, so
+ * it is put off as long as possible, and the bird rides the bottom of each
+ * gap and rises into the next one only when it has to.
+ *
+ * Barriers that have not spawned yet are not seen; the look-ahead is short
+ * enough that a new one is still far off when it appears.
+ *
+ * It works from the published game state (see game.h), so it can run
+ * anywhere that can read it: main.c runs it as a background task after
+ * each physics step, not in the step's interrupt, and feeds what it decides
+ * to the next step in place of PA0, for attract-mode demo games and
+ * unattended soak runs. bench/bench.c uses it to play games on the host.
+ * A barrier's speed is taken from how far it moved in the last step, so one
+ * that has just spawned looks still for a step, while it is far off.
+ *
+ * Plain C with no register access, so it can be exercised on a PC.
+ */
+
+#define AUTOPILOT_LOOKAHEAD 20 // physics steps simulated for each plan
+
+typedef struct
+{
+    fix gravity; // the bird's acceleration per step with the button up
+    fix flap;    // its velocity while the button is held
+    int floor;   // lowest bird position that is not a crash
+    int ceiling; // highest bird position, which it is held to
+    int column;  // the display column the bird flies in, which barriers scroll past
+} Autopilot;
+
+/* Function Prototypes */
+void autopilot_init(Autopilot *a, fix gravity, fix flap, int floor, int ceiling, int column);
+int autopilot_press(const Autopilot *a, const Body *bird, const ObstacleView *barriers);
+
+#endif /* AUTOPILOT_H */
@@ -1,331 +1,78 @@
-// =============================================================================
-// Backround image data for the game (blue sky and green ground for now)
-// =============================================================================
-const struct
-{
-    unsigned int width;
-    unsigned int height;
-    unsigned int bytes_per_pixel;
-    unsigned char pixel_data[240 * 320 * 2 + 1];
-} background = {
-    240, 320, 2,
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"
-    "\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\340\001\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000\037\000"};
+// Generated by utils/assetc.py from assets/background.png. Do not edit.
+#include "assets.h"
+
+static const unsigned short background_pixels[512] = {
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+};
+
+static const unsigned char background_index[300] = {
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+
+const Asset background = {240, 320, ASSET_TILED, 4, -1, background_pixels, background_index, 0, 0};
@@ -1,39 +1,33 @@
-const struct
-{
-    unsigned int width;
-    unsigned int height;
-    unsigned int bytes_per_pixel;
-    unsigned char pixel_data[19 * 19 * 2 + 1];
-} bird = {
-    19,
-    19,
-    2,
-    "\377\377\377\377\377\377\377\377\377\377\377\377_\262_\262_\262_\262_\262"
-    "_\262_\262\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377_\262_\262_\262_\262"
-    "_\262_\262_\262_\262_\262_\262_\262_\262_\262\377\377\377\377\377\377\377"
-    "\377\377\377_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262"
-    "_\262_\262_\262\377\377\377\377\377\377_\262_\262_\262_\262_\262_\262_\262"
-    "_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262\377\377\377\377_\262_"
-    "\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262"
-    "_\262\377\377_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262"
-    "_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262"
-    "_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262"
-    "_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262"
-    "_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262"
-    "_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262"
-    "_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262"
-    "_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262"
-    "_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262"
-    "_\262\377\377_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262"
-    "_\262_\262_\262_\262_\262\377\377\377\377_\262_\262_\262_\262_\262_\262_"
-    "\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262\377\377\377\377\377"
-    "\377_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262"
-    "_\262\377\377\377\377\377\377\377\377\377\377_\262_\262_\262_\262_\262_\262"
-    "_\262_\262_\262_\262_\262_\262_\262\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262_\262\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377_\262_\262_\262_\262_\262_\262_\262\377\377\377\377\377\377\377\377\377"
-    "\377\377\377",
+// Generated by utils/assetc.py from assets/bird.png. Do not edit.
+#include "assets.h"
+
+static const unsigned short bird_pixels[4] = {
+    0xffff, 0xb25f, 0x0000, 0x0000,
 };
+
+static const unsigned char bird_index[95] = {
+    0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x01, 0x55,
+    0x55, 0x55, 0x00, 0x05, 0x55, 0x55, 0x55, 0x40, 0x15, 0x55, 0x55, 0x55,
+    0x50, 0x15, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55,
+    0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55,
+    0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54,
+    0x55, 0x55, 0x55, 0x55, 0x54, 0x15, 0x55, 0x55, 0x55, 0x50, 0x15, 0x55,
+    0x55, 0x55, 0x50, 0x05, 0x55, 0x55, 0x55, 0x40, 0x01, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00,
+};
+
+static const unsigned short bird_spans[38] = {
+    6, 12, 4, 14, 3, 15, 2, 16, 1, 17, 1, 17, 0, 18, 0, 18,
+    0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 1, 17, 1, 17, 2, 16,
+    3, 15, 4, 14, 6, 12,
+};
+
+static const unsigned char bird_mask[57] = {
+    0x03, 0xf8, 0x00, 0x0f, 0xfe, 0x00, 0x1f, 0xff, 0x00, 0x3f, 0xff, 0x80,
+    0x7f, 0xff, 0xc0, 0x7f, 0xff, 0xc0, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0,
+    0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0,
+    0xff, 0xff, 0xe0, 0x7f, 0xff, 0xc0, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0x80,
+    0x1f, 0xff, 0x00, 0x0f, 0xfe, 0x00, 0x03, 0xf8, 0x00,
+};
+
+const Asset bird = {19, 19, ASSET_INDEXED, 2, 0xffff, bird_pixels, bird_index, bird_spans, bird_mask};
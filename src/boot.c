@@ -0,0 +1,54 @@
+/**
+ * @file boot.c
+ * @brief Boot sequencer: runs the display bring-up in the background of the other initialisation.
+ *
+ * The ILI9341 needs 150 ms around its reset pulse and another 120 ms after Sleep Out.
+ * Rather than spinning through those, boot_run() starts the display sequence, then
+ * runs each boot job while the display is waiting, polling it between jobs so the
+ * next command goes out as soon as its delay has passed.
+ */
+
+#include "boot.h"
+#include "lcd.h"
+#include "utils.h"
+#include "telemetry.h"
+#include "power.h"
+
+uint32_t boot_trace[BOOT_STAGE_COUNT];
+
+/**
+ * @brief Record that a boot milestone has been reached.
+ * @param stage The milestone.
+ * @return void
+ */
+void boot_mark(enum boot_stage stage)
+{
+    boot_trace[stage] = micros();
+    telemetry_boot(stage, boot_trace[stage]);
+}
+
+/**
+ * @brief Initialize the display while running other boot jobs during its delays.
+ * @param jobs The jobs to run, in order. None of them may draw to the display.
+ * @param count The number of jobs.
+ * @return void
+ */
+void boot_run(const boot_job_t *jobs, int count)
+{
+    LCD_SetupStart();
+    boot_mark(BOOT_LCD_START);
+
+    for (int i = 0; i < count; i++)
+    {
+        jobs[i].run();
+        boot_mark(jobs[i].stage);
+        LCD_InitPoll();
+    }
+
+    // nothing left to overlap, wait out the rest of the display sequence
+    while (!LCD_InitPoll())
+        power_sleep(); // SysTick wakes it at least every millisecond
+    boot_mark(BOOT_LCD_READY);
+    LCD_LinkTest();
+    boot_mark(BOOT_LCD_LINK);
+}
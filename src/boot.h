@@ -0,0 +1,34 @@
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <stdint.h>
+
+/* Boot milestones, in the order they normally happen. */
+enum boot_stage
+{
+    BOOT_START,         // clocks and timebase running
+    BOOT_LCD_START,     // display reset asserted, init sequence started
+    BOOT_EEPROM,        // high score cached from the EEPROM
+    BOOT_ASSETS,        // sprites composed into their padded buffers
+    BOOT_SCORE_DISPLAY, // 8-segment displays refreshing
+    BOOT_LCD_READY,     // display initialized
+    BOOT_LCD_LINK,      // display SPI clock checked by reading back
+    BOOT_SDCARD,        // SD card assets looked for
+    BOOT_FIRST_FRAME,   // first full screen drawn
+    BOOT_STAGE_COUNT
+};
+
+/* One piece of initialisation work to overlap with the display power-up delays. */
+typedef struct
+{
+    void (*run)(void);
+    enum boot_stage stage; // milestone recorded when run() returns
+} boot_job_t;
+
+/* Microsecond timestamp of each milestone, 0 if not reached yet. */
+extern uint32_t boot_trace[BOOT_STAGE_COUNT];
+
+void boot_mark(enum boot_stage stage);
+void boot_run(const boot_job_t *jobs, int count);
+
+#endif /* BOOT_H */
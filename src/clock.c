@@ -0,0 +1,222 @@
+/**
+ * @file clock.c
+ * @brief Clock profiles and the peripheral timing derived from them. See clock.h.
+ */
+
+#include "clock.h"
+#include "spibus.h"
+#include "telemetry.h"
+#include "utils.h"
+
+#if defined(CLOCK_HOST)
+ClockHost clock_host;
+typedef ClockHostTimer TIM_TypeDef;
+#define TIM2 (&clock_host.tim2)
+#define TIM16 (&clock_host.tim16)
+#define TIM17 (&clock_host.tim17)
+#define TIM_CR1_URS (1u << 2)
+#define TIM_EGR_UG (1u << 0)
+#else
+#include "stm32f0xx.h"
+#endif
+
+/* Supply currents are datasheet figures with the peripherals enabled, rounded up */
+const ClockProfile clock_profiles[CLOCK_PROFILES] = {
+    [CLOCK_LOW] = {8000000, 5000, 3000},
+    [CLOCK_FULL] = {48000000, 22000, 12000},
+};
+
+static clock_profile_t current = CLOCK_FULL;
+static ClockTiming timing;
+
+/**
+ * @brief The smallest SPI baud rate divisor (2 << br) that keeps the clock at or under max_hz.
+ * @param pclk_hz The SPI's peripheral clock.
+ * @param max_hz The fastest clock wanted.
+ * @return br, the SPI_CR1_BR field value not yet shifted; 7 (divide by 256) if nothing is slow enough.
+ */
+uint8_t clock_spi_br(uint32_t pclk_hz, uint32_t max_hz)
+{
+    uint8_t br = 0;
+    while (br < 7 && (pclk_hz >> (br + 1)) > max_hz)
+        br++;
+    return br;
+}
+
+/* TIMINGR for standard mode from the I2C kernel clock: the prescaler makes a tick of at least
+   250 ns, then SCL is low for 20 ticks and high for 16, with 2 ticks of SDA hold and 5 of setup. */
+static uint32_t i2c_timingr(uint32_t i2cclk_hz)
+{
+    uint32_t presc = (i2cclk_hz + 3999999) / 4000000 - 1;
+    return presc << 28 | 4 << 20 | 2 << 16 | (16 - 1) << 8 | (20 - 1);
+}
+
+/**
+ * @brief Work out every peripheral setting that depends on the system clock.
+ * @param sysclk_hz The SYSCLK frequency, a whole number of MHz.
+ * @param t Where to put the settings.
+ * @return void
+ */
+void clock_derive(uint32_t sysclk_hz, ClockTiming *t)
+{
+    t->sysclk_hz = sysclk_hz;
+    t->flash_latency = sysclk_hz > 24000000;
+    t->spi2_br = clock_spi_br(sysclk_hz, CLOCK_SPI2_HZ);
+    t->i2c1_timingr = i2c_timingr(CLOCK_HSI_HZ);
+    t->us_psc = sysclk_hz / 1000000 - 1;
+    t->tim16_psc = sysclk_hz / CLOCK_TIM16_HZ - 1;
+    t->systick_reload = sysclk_hz / 1000;
+    t->usart2_brr = (sysclk_hz + TELEMETRY_BAUD / 2) / TELEMETRY_BAUD;
+}
+
+/* Change a running timer's prescaler now rather than at its next update, keeping its count. */
+static void retime(TIM_TypeDef *tim, uint16_t psc)
+{
+    uint32_t cr1 = tim->CR1;
+    uint32_t cnt = tim->CNT;
+    tim->CR1 = cr1 | TIM_CR1_URS; // so the forced update below raises no interrupt
+    tim->PSC = psc;
+    tim->EGR = TIM_EGR_UG; // load the prescaler, which also clears the count...
+    tim->CNT = cnt;        // ...so put it back
+    tim->CR1 = cr1;
+}
+
+/* Re-time the timers that count at fixed rates for the current timing */
+static void retime_timers(void)
+{
+    retime(TIM2, timing.us_psc);
+    retime(TIM16, timing.tim16_psc);
+    retime(TIM17, timing.us_psc);
+}
+
+#if defined(CLOCK_HOST)
+
+void clock_init(void)
+{
+    current = CLOCK_FULL;
+    clock_derive(clock_profiles[current].sysclk_hz, &timing);
+}
+
+void clock_set(clock_profile_t p)
+{
+    if (p == current)
+        return;
+    current = p;
+    clock_derive(clock_profiles[current].sysclk_hz, &timing);
+    retime_timers();
+}
+
+void clock_resume(void)
+{
+}
+
+#else
+
+/**
+ * @brief Start the full speed profile. Called first thing, before any peripheral is set up.
+ * @return void
+ */
+void clock_init(void)
+{
+    internal_clock(); // HSI to 48MHz
+    current = CLOCK_FULL;
+    clock_derive(clock_profiles[current].sysclk_hz, &timing);
+}
+
+/* Change an idle SPI's baud rate divisor. */
+static void spi_rebaud(SPI_TypeDef *spi, uint8_t br)
+{
+    while ((spi->SR & SPI_SR_FTLVL) || (spi->SR & SPI_SR_BSY))
+        ;
+    spi->CR1 &= ~SPI_CR1_SPE;
+    spi->CR1 = (spi->CR1 & ~SPI_CR1_BR) | (uint32_t)br << SPI_CR1_BR_Pos;
+    spi->CR1 |= SPI_CR1_SPE;
+}
+
+/**
+ * @brief Switch to another clock profile and re-time every peripheral for it.
+ * SPI1 is re-timed for the device the bus is set up for. Interrupts are held off for the switch, which takes
+ * as long as the telemetry chunk in flight, if any, needs to finish.
+ * @param p The profile.
+ * @return void
+ */
+void clock_set(clock_profile_t p)
+{
+    if (p == current)
+        return;
+
+    // let queued telemetry go out at the old rate first
+    while (DMA1_Channel4->CCR & DMA_CCR_EN)
+        ;
+    __disable_irq();
+    while ((DMA1_Channel4->CCR & DMA_CCR_EN) && DMA1_Channel4->CNDTR != 0)
+        ;
+    int usart = USART2->CR1 & USART_CR1_UE; // off if telemetry is compiled out
+    while (usart && !(USART2->ISR & USART_ISR_TC))
+        ;
+    // the 8-segment refresh restarts from the first digit afterwards
+    DMA1_Channel5->CCR &= ~DMA_CCR_EN;
+
+    clock_derive(clock_profiles[p].sysclk_hz, &timing);
+    if (p == CLOCK_FULL)
+    {
+        internal_clock(); // sets the flash wait state before the PLL takes over
+    }
+    else
+    {
+        RCC->CFGR &= ~RCC_CFGR_SW; // HSI
+        while ((RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_HSI)
+            ;
+        RCC->CR &= ~RCC_CR_PLLON;
+        FLASH->ACR = FLASH_ACR_PRFTBE | timing.flash_latency; // fewer wait states once slower
+    }
+    current = p;
+
+    spibus_retime();
+    spi_rebaud(SPI2, timing.spi2_br);
+    DMA1_Channel5->CNDTR = 8;
+    DMA1_Channel5->CCR |= DMA_CCR_EN;
+
+    if (usart)
+    {
+        USART2->CR1 &= ~USART_CR1_UE;
+        USART2->BRR = timing.usart2_brr;
+        USART2->CR1 |= USART_CR1_UE;
+    }
+
+    retime_timers();
+    SysTick->LOAD = timing.systick_reload - 1;
+    SysTick->VAL = 0;
+
+    __enable_irq();
+}
+
+/**
+ * @brief Restore the current profile's clock after stop mode, which wakes up on the HSI.
+ * @return void
+ */
+void clock_resume(void)
+{
+    if (current == CLOCK_FULL && (RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_PLL)
+        internal_clock();
+}
+
+#endif /* CLOCK_HOST */
+
+/**
+ * @brief The profile the clock is running.
+ * @return The profile.
+ */
+clock_profile_t clock_profile(void)
+{
+    return current;
+}
+
+/**
+ * @brief The peripheral settings for the current profile.
+ * @return The settings, valid after clock_init().
+ */
+const ClockTiming *clock_timing(void)
+{
+    return &timing;
+}
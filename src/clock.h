@@ -0,0 +1,102 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <stdint.h>
+
+/*
+ * Clock profiles. The game needs the full 48 MHz only while it is being
+ * played; the title screen mostly sleeps and runs as well from the 8 MHz
+ * HSI. Every profile is one row of clock_profiles[], and everything that
+ * depends on the clock frequency is derived from that row by
+ * clock_derive():
+ *
+ *   SPI1        per device, by the bus (spibus.h) with clock_spi_br()
+ *   SPI2        the fastest divisor not above CLOCK_SPI2_HZ
+ *   I2C1        TIMINGR for 100 kHz. I2C1 is clocked from the HSI, not
+ *               SYSCLK, so this is the same in every profile.
+ *   TIM2/TIM17  prescalers for a 1 MHz count
+ *   TIM16       prescaler for a CLOCK_TIM16_HZ count
+ *   SysTick     a 1 ms reload
+ *   USART2      BRR for TELEMETRY_BAUD
+ *   flash       wait states
+ *
+ * Timers count at the same rates in every profile, so their reload values,
+ * micros(), millis() and the physics step do not change. Serial clocks stay
+ * at or under their targets; at 8 MHz the display SPI can only reach 4 MHz.
+ *
+ * clock_set() switches profile at runtime. It must not be called while the
+ * frame timer's interrupt is enabled, since the display SPI has to be idle.
+ *
+ * clock_derive() is plain C. Build with -DCLOCK_HOST to run it, and the
+ * profile bookkeeping, on a PC without the registers. The timers that
+ * clock_set() re-times are then plain structs (clock_host), so the
+ * prescalers it leaves them with can be checked.
+ */
+
+#define CLOCK_HSI_HZ 8000000
+#define CLOCK_SPI1_HZ 12000000      // display, unless LCD_LinkTest() verifies a faster clock
+#define CLOCK_SPI1_FAST_HZ 24000000 // display, if LCD_LinkTest() finds it reads back
+#define CLOCK_SPI1_SLOW_HZ 187500   // SD card setup, which must be under 400 kHz
+#define CLOCK_SPI2_HZ 187500        // 8-segment displays
+#define CLOCK_I2C1_HZ 100000        // EEPROM
+#define CLOCK_TIM16_HZ 16000        // TIM16 count rate, divided down to the physics step
+
+typedef enum
+{
+    CLOCK_LOW,  // HSI, 8 MHz
+    CLOCK_FULL, // (HSI/2) * 12 PLL, 48 MHz
+    CLOCK_PROFILES
+} clock_profile_t;
+
+typedef struct
+{
+    uint32_t sysclk_hz; // SYSCLK = HCLK = PCLK
+    uint32_t run_ua;    // approximate MCU supply current awake...
+    uint32_t sleep_ua;  // ...and in sleep mode, with the game's peripherals on
+} ClockProfile;
+
+/* Peripheral settings for one SYSCLK frequency */
+typedef struct
+{
+    uint32_t sysclk_hz;
+    uint32_t i2c1_timingr;
+    uint32_t systick_reload; // SysTick_Config() argument
+    uint16_t us_psc;         // TIM2 and TIM17 PSC
+    uint16_t tim16_psc;
+    uint16_t usart2_brr;
+    uint8_t spi2_br; // SPI_CR1_BR field value, not yet shifted
+    uint8_t flash_latency;
+} ClockTiming;
+
+extern const ClockProfile clock_profiles[CLOCK_PROFILES];
+
+#if defined(CLOCK_HOST)
+/* Stand-in for a timer's registers, as far as clock_set() touches them */
+typedef struct
+{
+    uint32_t CR1;
+    uint32_t PSC;
+    uint32_t CNT;
+    uint32_t EGR;
+} ClockHostTimer;
+
+typedef struct
+{
+    ClockHostTimer tim2;
+    ClockHostTimer tim16;
+    ClockHostTimer tim17;
+} ClockHost;
+
+extern ClockHost clock_host;
+#endif
+
+/* Function Prototypes */
+void clock_derive(uint32_t sysclk_hz, ClockTiming *t);
+uint8_t clock_spi_br(uint32_t pclk_hz, uint32_t max_hz);
+void clock_init(void);
+void clock_set(clock_profile_t p);
+void clock_resume(void);
+clock_profile_t clock_profile(void);
+const ClockTiming *clock_timing(void);
+
+#endif /* CLOCK_H */
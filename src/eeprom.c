@@ -1,4 +1,9 @@
 #include "eeprom.h"
+#include "utils.h"
+#include "telemetry.h"
+#include "power.h"
+#include "clock.h"
+#include "pins.h"
 
 // I2C initialization for EEPROM communication
 void eeprom_init(void) {
@@ -9,6 +14,8 @@ void eeprom_init(void) {
     RCC->APB1ENR |= RCC_APB1ENR_I2C1EN;
     
     // Configure PB6 (SCL) and PB7 (SDA) for I2C1
+    pin_claim(PIN('B', 6), "eeprom");
+    pin_claim(PIN('B', 7), "eeprom");
     // Set alternate function mode (0b10)
     GPIOB->MODER &= ~(GPIO_MODER_MODER6 | GPIO_MODER_MODER7);
     GPIOB->MODER |= (GPIO_MODER_MODER6_1 | GPIO_MODER_MODER7_1);
@@ -31,8 +38,8 @@ void eeprom_init(void) {
     RCC->APB1RSTR |= RCC_APB1RSTR_I2C1RST;
     RCC->APB1RSTR &= ~RCC_APB1RSTR_I2C1RST;
     
-    // Configure I2C1 timing for 100kHz with 48MHz clock
-    I2C1->TIMINGR = 0x10420F13;
+    // Configure I2C1 timing for 100kHz from its clock, the 8MHz HSI
+    I2C1->TIMINGR = clock_timing()->i2c1_timingr;
     
     // Enable I2C1
     I2C1->CR1 |= I2C_CR1_PE;
@@ -73,8 +80,8 @@ int8_t eeprom_write_byte(uint16_t addr, uint8_t data) {
     // Generate STOP condition
     I2C1->CR2 |= I2C_CR2_STOP;
     
-    // Wait for write cycle time
-    for(volatile int i = 0; i < 48000 * EEPROM_WRITE_CYCLE_TIME; i++);
+    // Wait for write cycle time, asleep
+    delay_ms(EEPROM_WRITE_CYCLE_TIME);
     
     return EEPROM_OK;
 }
@@ -130,25 +137,31 @@ int8_t eeprom_read_byte(uint16_t addr, uint8_t *data) {
 }
 
 int8_t eeprom_save_high_score(uint32_t score) {
+    uint32_t start = micros();
     // Write score byte by byte
     for(int i = 0; i < 4; i++) {
         if(eeprom_write_byte(HIGH_SCORE_ADDR + i, (score >> (i*8)) & 0xFF) != EEPROM_OK) {
+            telemetry_eeprom(TLM_EEPROM_WRITE, micros() - start, EEPROM_ERROR);
             return EEPROM_ERROR;
         }
     }
+    telemetry_eeprom(TLM_EEPROM_WRITE, micros() - start, EEPROM_OK);
     return EEPROM_OK;
 }
 
 int8_t eeprom_get_high_score(uint32_t *score) {
     uint8_t byte;
+    uint32_t start = micros();
     *score = 0;
     
     // Read score byte by byte
     for(int i = 0; i < 4; i++) {
         if(eeprom_read_byte(HIGH_SCORE_ADDR + i, &byte) != EEPROM_OK) {
+            telemetry_eeprom(TLM_EEPROM_READ, micros() - start, EEPROM_ERROR);
             return EEPROM_ERROR;
         }
         *score |= ((uint32_t)byte << (i*8));
     }
+    telemetry_eeprom(TLM_EEPROM_READ, micros() - start, EEPROM_OK);
     return EEPROM_OK;
 }
@@ -0,0 +1,99 @@
+/**
+ * @file game.c
+ * @brief The physics step and the game state it publishes. See game.h.
+ */
+
+#include "game.h"
+
+Body bird_body;
+int bird_y = BIRD_Y0;
+ObstaclePool barriers;
+int score;
+int game_over;
+
+static GameView game_views[2];
+Snapshot game;
+
+/**
+ * @brief Set up the published game state, all zeros until the first publish_game().
+ * @return void
+ */
+void game_init(void)
+{
+    GameView view = {0};
+    snapshot_init(&game, &game_views[0], &game_views[1], sizeof view, &view);
+}
+
+/**
+ * @brief Put the bird back at the start and clear the score, for a new game. The barriers are left alone.
+ * @return void
+ */
+void game_reset(void)
+{
+    body_reset(&bird_body, FIX(BIRD_X0), FIX(BIRD_V0));
+    bird_y = BIRD_Y0;
+    game_over = 0;
+    score = 0;
+}
+
+/**
+ * @brief Advance the game by one physics step: move the bird and barriers, check for crashes and score.
+ * Nothing moves once game_over is set.
+ * @param pressed Non-zero if the button is held for this step.
+ * @return The points scored this step.
+ */
+int game_step(int pressed)
+{
+    // Button pressed: velocity boost. Otherwise fall.
+    if (pressed)
+    {
+        bird_body.vel = BIRD_FLAP;
+        body_step(&bird_body, 0);
+    }
+    else
+    {
+        body_step(&bird_body, BIRD_GRAVITY);
+    }
+
+    // check if bird hit ground
+    if (FIX_INT(bird_body.pos) < BIRD_MIN_X)
+    {
+        game_over = 1;
+        return 0;
+    }
+
+    // check the bird against every barrier on screen
+    int passed;
+    if (obstacles_collide(&barriers, FIX_INT(bird_body.pos), bird_y, &passed))
+    {
+        game_over = 1;
+        return 0;
+    }
+
+    // a point for every barrier the bird got through
+    score += passed;
+
+    // bird can't go above the ceiling
+    if (bird_body.pos > FIX(BIRD_MAX_X))
+    {
+        bird_body.pos = FIX(BIRD_MAX_X);
+    }
+
+    /* Barrier physics: scroll, recycle the ones that left the screen, spawn new ones */
+    obstacles_step(&barriers);
+    return passed;
+}
+
+/**
+ * @brief Publish the game state for the renderer and play().
+ * @return void
+ */
+void publish_game(void)
+{
+    GameView *v = snapshot_begin(&game);
+    v->bird = bird_body;
+    obstacles_view(&barriers, &v->barriers);
+    v->score = score;
+    v->game_over = game_over;
+    snapshot_publish(&game);
+}
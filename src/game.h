@@ -0,0 +1,54 @@
+#ifndef GAME_H
+#define GAME_H
+
+#include "physics.h"
+#include "obstacle.h"
+#include "snapshot.h"
+
+/*
+ * The game itself: the bird, the barriers and the score, the physics step
+ * that advances them, and the GameView it publishes for everything else.
+ * main.c's TIM16 handler runs game_step() then publish_game() at PHYS_HZ
+ * while a game is being played; bench/bench.c runs the same two on a PC.
+ *
+ * The state below belongs to whoever is stepping the game: the physics
+ * step while a game is on, play() in between. Anything else reads the
+ * published GameView from `game` with snapshot_read().
+ *
+ * Plain C with no register access, so it can be exercised on a PC.
+ */
+
+#define BIRD_WIDTH 19                // bird width
+#define BIRD_HEIGHT 19               // bird height
+#define BIRD_V0 0                    // bird initial velocity
+#define BIRD_GRAVITY FIX_FRAC(-3, 8) // bird acceleration per step
+#define BIRD_FLAP FIX(5)             // bird velocity while the button is held
+#define BIRD_X0 100                  // bird initial x position
+#define BIRD_Y0 140                  // bird initial y position
+#define BIRD_MIN_X 50                // bird min x position
+#define BIRD_MAX_X 200               // bird max x position
+#define FIRST_GAP 70                 // gap of the first barrier of a game
+
+/* What the renderer and play() see of the game, published after every physics step */
+typedef struct
+{
+    Body bird;
+    ObstacleView barriers;
+    int score;
+    int game_over;
+} GameView;
+
+extern Body bird_body;        // x position, advanced by the physics step
+extern int bird_y;            // the display row the bird flies along
+extern ObstaclePool barriers; // moved by the physics step
+extern int score;
+extern int game_over;
+extern Snapshot game;         // the game state as last published
+
+/* Function Prototypes */
+void game_init(void);
+void game_reset(void);
+int game_step(int pressed);
+void publish_game(void);
+
+#endif /* GAME_H */
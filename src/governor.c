@@ -0,0 +1,98 @@
+/**
+ * @file governor.c
+ * @brief Picks a stable frame period from measured render times. See governor.h.
+ */
+
+#include "governor.h"
+#include "physics.h"
+
+#define STEP_US (1000000 / PHYS_HZ)
+
+/* Frame periods, fastest first: 2, 1, 1/2, 1/3 and 1/4 frames per physics step */
+static const uint32_t ladder[GOV_LEVELS] = {STEP_US / 2, STEP_US, 2 * STEP_US, 3 * STEP_US, 4 * STEP_US};
+
+/**
+ * @brief Start over at GOV_START with no history.
+ * @param g The governor.
+ * @return void
+ */
+void governor_reset(Governor *g)
+{
+    g->level = GOV_START;
+    g->period_us = ladder[GOV_START];
+    g->peak_us = 0;
+    g->second_us = 0;
+    g->last_peak = 0;
+    g->misses = 0;
+    g->frames = 0;
+    g->calm = 0;
+}
+
+/**
+ * @brief Account for one rendered frame, and choose a new period at the end of each window
+ * (when frames is back to 0 afterwards).
+ * @param g The governor.
+ * @param render_us How long the frame took to draw.
+ * @return 1 if period_us changed and the frame timer needs reprogramming, otherwise 0.
+ */
+int governor_frame(Governor *g, uint32_t render_us)
+{
+    if (render_us > g->period_us)
+        g->misses++;
+    if (render_us > g->peak_us)
+    {
+        g->second_us = g->peak_us;
+        g->peak_us = render_us;
+    }
+    else if (render_us > g->second_us)
+    {
+        g->second_us = render_us;
+    }
+    // a second miss ends the window early, so a heavier scene costs two misses rather than a window of them
+    if (++g->frames < GOV_WINDOW && g->second_us <= g->period_us)
+        return 0;
+
+    uint32_t need = g->second_us + (g->second_us >> 3);
+    int level = g->level;
+    g->frames = 0;
+    g->last_peak = g->peak_us;
+    g->peak_us = 0;
+    g->second_us = 0;
+
+    if (need > ladder[level])
+    {
+        // too slow: go straight to the first rung that covers it
+        while (level < GOV_LEVELS - 1 && need > ladder[level])
+            level++;
+        g->calm = 0;
+    }
+    else if (level > 0 && need + (need >> 3) <= ladder[level - 1])
+    {
+        // would have fit one rung faster with room to spare; only take it once that has held for a while
+        if (++g->calm >= GOV_CALM)
+        {
+            level--;
+            g->calm = 0;
+        }
+    }
+    else
+    {
+        g->calm = 0;
+    }
+
+    if (level == g->level)
+        return 0;
+    g->level = level;
+    g->period_us = ladder[level];
+    return 1;
+}
+
+/**
+ * @brief The chosen frame rate.
+ * @param g The governor.
+ * @return Frames per second, rounded down.
+ */
+uint32_t governor_rate(const Governor *g)
+{
+    return 1000000 / g->period_us;
+}
@@ -0,0 +1,52 @@
+#ifndef GOVERNOR_H
+#define GOVERNOR_H
+
+#include <stdint.h>
+
+/*
+ * Frame-rate governor. The frame timer (TIM17) used to fire about 979
+ * times a second, far faster than a frame can be drawn, so the real frame
+ * rate was whatever the SPI traffic of each frame allowed and jittered with
+ * it. The governor instead picks a frame period from a ladder of 2, 1, 1/2,
+ * 1/3 and 1/4 frames per physics step (see physics.h), from the render
+ * times it is fed:
+ *
+ *   - every GOV_WINDOW frames, or as soon as two frames in a window have
+ *     overrun the period, it takes the second slowest render in the
+ *     window (so one outlier is a miss, not a rate change) plus 1/8
+ *     headroom, and drops straight to the fastest period that covers it if
+ *     the current one does not;
+ *   - it only speeds up one rung at a time, after GOV_CALM windows in a
+ *     row that would all have fit the faster period with another 1/8 to
+ *     spare.
+ *
+ * Game speed does not depend on the frame rate, since the simulation runs
+ * on its own timer; a slower rate just means more steps per frame. A frame
+ * that takes longer than the period is counted as a miss.
+ *
+ * Plain C with no register access, so it can be exercised on a PC.
+ */
+
+#define GOV_WINDOW 16 // frames per decision
+#define GOV_CALM 2    // windows that must fit a faster period before it is used
+#define GOV_START 1   // initial rung
+#define GOV_LEVELS 5  // rungs in the ladder
+
+typedef struct
+{
+    uint32_t period_us; // chosen frame period
+    uint32_t peak_us;   // slowest render so far in the window
+    uint32_t second_us; // second slowest render so far in the window
+    uint32_t last_peak; // slowest render in the last complete window
+    uint32_t misses;    // frames that overran their period
+    uint8_t level;      // rung of the ladder, 0 is the fastest
+    uint8_t frames;     // frames so far in the window
+    uint8_t calm;       // windows in a row that would have fit one rung faster
+} Governor;
+
+/* Function Prototypes */
+void governor_reset(Governor *g);
+int governor_frame(Governor *g, uint32_t render_us);
+uint32_t governor_rate(const Governor *g);
+
+#endif /* GOVERNOR_H */
@@ -7,25 +7,38 @@
 #include <stdio.h>
 #include <stdint.h>
 #include "lcd.h"
-
-void nano_wait(int t);
+#include "clock.h"
+#include "spibus.h"
+#include "arena.h"
+#include "power.h"
+#include "utils.h"
 
 lcd_dev_t lcddev;
 
+// Running count of bytes clocked out to the display, for telemetry.
+volatile uint32_t lcd_spi_bytes;
+
+// What the controller's column/page window and RAM write cursor are known to
+// be, so LCD_SetWindow only sends the commands that change something.
+static struct
+{
+    u16 xs, xe; // last CASET
+    u16 ys, ye; // last PASET
+    uint32_t pos;  // pixels written since the last RAMWR
+    u8 valid;      // the fields above match the controller
+    u8 streaming;  // no command since RAMWR, so more pixels just follow on
+} win;
+
+#if defined(LCD_HOST)
+u8 lcd_host_window_cache = 1;
+#define WINDOW_CACHE lcd_host_window_cache
+#else
+#define WINDOW_CACHE 1
+#endif
+
 #define SPI SPI1
 
 #define CS_NUM 8
-#define CS_BIT (1 << CS_NUM)
-#define CS_HIGH                       \
-    do                                \
-    {                                 \
-        GPIOB->BSRR = GPIO_BSRR_BS_8; \
-    } while (0)
-#define CS_LOW                        \
-    do                                \
-    {                                 \
-        GPIOB->BSRR = GPIO_BSRR_BR_8; \
-    } while (0)
 #define RESET_NUM 11
 #define RESET_BIT (1 << RESET_NUM)
 #define RESET_HIGH                     \
@@ -51,21 +64,23 @@ lcd_dev_t lcddev;
         GPIOB->BSRR = GPIO_BSRR_BR_14; \
     } while (0)
 
-// Set the CS pin low if val is non-zero.
-// Note that when CS is being set high again, wait on SPI to not be busy.
+// The display on the SPI1 bus (see spibus.h). It parks the bus while a
+// row is still going out (LCD_DrawPictureAsync), and LCD_Flush lets go.
+static SpiDevice lcd_spi = SPIBUS_DEVICE("lcd", PIN('B', CS_NUM), 8, 0, CLOCK_SPI1_HZ, LCD_Flush, 0);
+
+// Take the bus and set the CS pin low if val is non-zero.
+// Note that when CS is being set high again, the bus waits on SPI to not be busy.
 static void tft_select(int val)
 {
     if (val == 0)
     {
-        while (SPI1->SR & SPI_SR_BSY)
-            ;
-        CS_HIGH;
+        spibus_release(&lcd_spi);
     }
     else
     {
-        while ((GPIOB->ODR & (CS_BIT)) == 0)
+        while (spibus_owner() == &lcd_spi || !spibus_acquire(&lcd_spi))
         {
-            ; // If CS is already low, this is an error.  Loop forever.
+            ; // If CS is already low, or the card has the bus, this is an error.  Loop forever.
             // This has happened because something called a drawing subroutine
             // while one was already in process.  For instance, the main()
             // subroutine could call a long-running LCD_DrawABC function,
@@ -73,7 +88,6 @@ static void tft_select(int val)
             // This is a common mistake made by students.
             // This is what catches the problem early.
         }
-        CS_LOW;
     }
 }
 
@@ -103,14 +117,6 @@ static void tft_reg_select(int val)
     }
 }
 
-void LCD_Reset(void)
-{
-    lcddev.reset(1);      // Assert reset
-    nano_wait(100000000); // Wait
-    lcddev.reset(0);      // De-assert reset
-    nano_wait(50000000);  // Wait
-}
-
 // If you want to try the slower version of SPI, #define SLOW_SPI
 
 #if defined(SLOW_SPI)
@@ -143,11 +149,13 @@ void SPI_WriteByte(uint8_t Data)
     while ((SPI->SR & SPI_SR_TXE) == 0)
         ;
     *((volatile uint8_t *)&SPI->DR) = Data;
+    lcd_spi_bytes++;
 }
 
 // Write to an LCD "register"
 void LCD_WR_REG(uint8_t data)
 {
+    win.streaming = 0;
     lcddev.reg_select(1);
     SPI_WriteByte(data);
 }
@@ -170,6 +178,7 @@ void LCD_WriteData16(u16 Data)
 {
     SPI_WriteByte(Data >> 8);
     SPI_WriteByte(Data);
+    win.pos++;
 }
 
 // Finish writing 16-bit data
@@ -177,50 +186,330 @@ void LCD_WriteData16_End()
 {
 }
 
+// Write a block of 8-bit parameters to the LCD
+void LCD_WriteParams(const uint8_t *data, unsigned int count)
+{
+    for (unsigned int i = 0; i < count; i++)
+        LCD_WR_DATA(data[i]);
+}
+
+// Write count 16-bit pixels from data
+void LCD_WriteData16_Block(const u16 *data, unsigned int count)
+{
+    while (count--)
+        LCD_WriteData16(*data++);
+}
+
+// Write count copies of one 16-bit pixel
+void LCD_WriteData16_Repeat(u16 data, unsigned int count)
+{
+    while (count--)
+        LCD_WriteData16(data);
+}
+
+static void lcd_spi_reset(void)
+{
+}
+
+// Nothing is ever left in flight without DMA.
+static void spi_finish(void)
+{
+}
+
+static void lcd_draw_block(const u16 *data, unsigned int count)
+{
+    LCD_WriteData16_Block(data, count);
+}
+
 #else  /* not SLOW_SPI */
 
-// Write to an LCD "register"
-void LCD_WR_REG(uint8_t data)
+// Parameter blocks at least this long go out by DMA instead of by the CPU.
+#define LCD_DMA_MIN 8
+
+// SPI1 stays in 16-bit mode after pixel data and only drops back to 8 bits
+// when a command has to go out, so back-to-back pixel writes don't pay for
+// a BSY wait and a CR2 update each.
+static u8 spi_wide; // SPI1 is framing 16 bits
+static u8 dc_data;  // DC is high (data)
+
+//===========================================================================
+// Every byte sent to the display goes through spi_put8, spi_put16 or
+// spi_dma. A host build (-DLCD_HOST) supplies lcd_host_put/lcd_host_dma
+// instead of the SPI1 registers, so the exact byte stream can be captured
+// and compared on a PC.
+//===========================================================================
+#if defined(LCD_HOST)
+void lcd_host_put(u16 data, int wide);
+void lcd_host_dma(const void *buf, unsigned int count, int wide, int increment);
+u8 lcd_host_get(void);
+#endif
+
+// A DMA transfer can be left running while the caller composes the next
+// row (see LCD_DrawPictureAsync). Anything else that touches the SPI calls
+// spi_finish() first, which waits for it. The host build only captures the
+// bytes here, so a buffer changed while "in flight" shows up in the capture.
+static u8 dma_pending;
+#if defined(LCD_HOST)
+static struct
+{
+    const void *buf;
+    unsigned int count;
+    int wide;
+    int increment;
+} pending;
+#endif
+
+static void spi_finish(void)
+{
+    if (!dma_pending)
+        return;
+    dma_pending = 0;
+#if defined(LCD_HOST)
+    lcd_host_dma(pending.buf, pending.count, pending.wide, pending.increment);
+#else
+    while ((DMA1->ISR & DMA_ISR_TCIF3) == 0)
+        ;
+    DMA1->IFCR = DMA_IFCR_CGIF3;
+    DMA1_Channel3->CCR &= ~DMA_CCR_EN;
+    SPI->CR2 &= ~SPI_CR2_TXDMAEN;
+    while ((SPI->SR & SPI_SR_BSY) != 0)
+        ;
+#endif
+}
+
+static inline void spi_put8(uint8_t data)
+{
+    spi_finish();
+#if defined(LCD_HOST)
+    lcd_host_put(data, 0);
+#else
+    while ((SPI->SR & SPI_SR_TXE) == 0)
+        ;
+    *((volatile uint8_t *)&SPI->DR) = data;
+#endif
+    lcd_spi_bytes++;
+}
+
+static inline void spi_put16(u16 data)
+{
+    spi_finish();
+#if defined(LCD_HOST)
+    lcd_host_put(data, 1);
+#else
+    while ((SPI->SR & SPI_SR_TXE) == 0)
+        ;
+    SPI->DR = data;
+#endif
+    lcd_spi_bytes += 2;
+}
+
+// Clock one byte in from the display (8-bit mode, nothing else in flight).
+static uint8_t spi_get8(void)
+{
+#if defined(LCD_HOST)
+    return lcd_host_get();
+#else
+    while ((SPI->SR & SPI_SR_TXE) == 0)
+        ;
+    *((volatile uint8_t *)&SPI->DR) = 0;
+    while ((SPI->SR & SPI_SR_RXNE) == 0)
+        ;
+    return *((volatile uint8_t *)&SPI->DR);
+#endif
+}
+
+// Start sending count items (bytes, or halfwords if wide) from buf on DMA1
+// channel 3 and return while the last of them are still going out. If
+// increment is zero the same item is sent count times, which is how solid
+// fills are done. buf must not change until spi_finish().
+static void spi_dma_start(const void *buf, unsigned int count, int wide, int increment)
+{
+    spi_finish();
+    lcd_spi_bytes += wide ? 2 * count : count;
+#if defined(LCD_HOST)
+    pending.buf = buf;
+    pending.count = count;
+    pending.wide = wide;
+    pending.increment = increment;
+    dma_pending = 1;
+#else
+    const uint8_t *p = buf;
+    while (count > 0)
+    {
+        unsigned int n = count > 0xffff ? 0xffff : count; // CNDTR is 16 bits
+        spi_finish();
+        DMA1_Channel3->CCR = DMA_CCR_DIR | DMA_CCR_PL_1; // ahead of memory-to-memory copies
+        if (increment)
+            DMA1_Channel3->CCR |= DMA_CCR_MINC;
+        if (wide)
+            DMA1_Channel3->CCR |= DMA_CCR_MSIZE_0 | DMA_CCR_PSIZE_0;
+        DMA1_Channel3->CMAR = (uint32_t)p;
+        DMA1_Channel3->CNDTR = n;
+        SPI->CR2 |= SPI_CR2_TXDMAEN;
+        DMA1_Channel3->CCR |= DMA_CCR_EN;
+        dma_pending = 1;
+        if (increment)
+            p += wide ? 2 * n : n;
+        count -= n;
+    }
+#endif
+}
+
+// Send count items from buf on DMA1 channel 3 and wait for them to leave the SPI.
+static void spi_dma(const void *buf, unsigned int count, int wide, int increment)
+{
+    spi_dma_start(buf, count, wide, increment);
+    spi_finish();
+}
+
+// Point DMA1 channel 3 at the SPI1 transmit register.
+static void lcd_dma_init(void)
+{
+#if !defined(LCD_HOST)
+    RCC->AHBENR |= RCC_AHBENR_DMA1EN;
+    DMA1_CSELR->CSELR = (DMA1_CSELR->CSELR & ~DMA_CSELR_C3S) | DMA1_CSELR_CH3_SPI1_TX;
+    DMA1_Channel3->CCR &= ~DMA_CCR_EN;
+    DMA1_Channel3->CPAR = (uint32_t)&SPI->DR;
+#endif
+}
+
+// Wait for the SPI to go idle and put it back in 8-bit mode.
+static void spi_narrow(void)
 {
+    spi_finish();
     while ((SPI->SR & SPI_SR_BSY) != 0)
         ;
+    if (spi_wide)
+    {
+        spibus_bits(&lcd_spi, 8);
+        spi_wide = 0;
+    }
+}
+
+// Forget the SPI state, which init_lcd_spi() has just set up from scratch.
+static void lcd_spi_reset(void)
+{
+    spibus_bits(&lcd_spi, 8);
+    spi_wide = 0;
+    dc_data = 0;
+}
+
+// Write to an LCD "register"
+void LCD_WR_REG(uint8_t data)
+{
     // Don't clear RS until the previous operation is done.
+    spi_narrow();
     lcddev.reg_select(1);
-    *((volatile uint8_t *)&SPI->DR) = data;
+    dc_data = 0;
+    win.streaming = 0;
+    spi_put8(data);
 }
 
 // Write 8-bit data to the LCD
 void LCD_WR_DATA(uint8_t data)
 {
-    while ((SPI->SR & SPI_SR_BSY) != 0)
-        ;
     // Don't set RS until the previous operation is done.
+    spi_narrow();
     lcddev.reg_select(0);
-    *((volatile uint8_t *)&SPI->DR) = data;
+    dc_data = 1;
+    spi_put8(data);
 }
 
-// Prepare to write 16-bit data to the LCD
+// Write a block of 8-bit parameters to the LCD as one burst.
+// RS is set once, and the bytes go back to back instead of waiting on BSY each.
+void LCD_WriteParams(const uint8_t *data, unsigned int count)
+{
+    if (count == 0)
+        return;
+    spi_narrow();
+    lcddev.reg_select(0);
+    dc_data = 1;
+    if (count >= LCD_DMA_MIN)
+    {
+        spi_dma(data, count, 0, 1);
+        return;
+    }
+    for (unsigned int i = 0; i < count; i++)
+        spi_put8(data[i]);
+}
+
+// Send a read command and clock in count bytes of its reply, after the
+// dummy byte the controller sends first.
+static void lcd_read(uint8_t cmd, uint8_t *buf, unsigned int count)
+{
+    LCD_WR_REG(cmd);
+    spi_narrow();
+#if !defined(LCD_HOST)
+    // everything sent so far clocked a byte into the receive FIFO
+    while ((SPI->SR & SPI_SR_FRLVL) != 0)
+        (void)*((volatile uint8_t *)&SPI->DR);
+    (void)SPI->SR; // clears an overrun, with the reads above
+#endif
+    lcddev.reg_select(0);
+    dc_data = 1;
+    spi_get8();
+    for (unsigned int i = 0; i < count; i++)
+        buf[i] = spi_get8();
+    lcd_spi_bytes += count + 1;
+}
+
+// Prepare to write 16-bit data to the LCD.
+// Nothing to do if the last thing sent was pixel data.
 void LCD_WriteData16_Prepare()
 {
+    if (spi_wide && dc_data)
+        return;
+    spi_finish();
+    while ((SPI->SR & SPI_SR_BSY) != 0)
+        ;
     lcddev.reg_select(0);
-    SPI->CR2 |= SPI_CR2_DS;
+    dc_data = 1;
+    spibus_bits(&lcd_spi, 16);
+    spi_wide = 1;
 }
 
 // Write 16-bit data
 void LCD_WriteData16(u16 data)
 {
-    while ((SPI->SR & SPI_SR_TXE) == 0)
-        ;
-    SPI->DR = data;
+    spi_put16(data);
+    win.pos++;
 }
 
-// Finish writing 16-bit data
+// Write count 16-bit pixels from data (between Prepare and End)
+void LCD_WriteData16_Block(const u16 *data, unsigned int count)
+{
+    spi_dma(data, count, 1, 1);
+    win.pos += count;
+}
+
+// Start count 16-bit pixels from data going out and return (see spi_dma_start).
+static void lcd_draw_block(const u16 *data, unsigned int count)
+{
+    spi_dma_start(data, count, 1, 1);
+    win.pos += count;
+}
+
+// Write count copies of one 16-bit pixel (between Prepare and End)
+void LCD_WriteData16_Repeat(u16 data, unsigned int count)
+{
+    spi_dma(&data, count, 1, 0);
+    win.pos += count;
+}
+
+// Finish writing 16-bit data.
+// The SPI is left in 16-bit mode; the next command switches it back.
 void LCD_WriteData16_End()
 {
-    SPI->CR2 &= ~SPI_CR2_DS; // bad value forces it back to 8-bit mode
 }
 #endif /* not SLOW_SPI */
 
+// Send a command followed by its parameter block.
+void LCD_WriteCommand(uint8_t cmd, const uint8_t *params, unsigned int count)
+{
+    LCD_WR_REG(cmd);
+    LCD_WriteParams(params, count);
+}
+
 // Select an LCD "register" and write 8-bit data to it.
 void LCD_WriteReg(uint8_t LCD_Reg, uint16_t LCD_RegValue)
 {
@@ -232,152 +521,228 @@ void LCD_WriteReg(uint8_t LCD_Reg, uint16_t LCD_RegValue)
 void LCD_WriteRAM_Prepare(void)
 {
     LCD_WR_REG(lcddev.wramcmd);
+    win.pos = 0;
+    win.streaming = 1;
 }
 
+//===========================================================================
+// Initialization sequences, as command tables.
+// Each entry is: command, parameter count, parameters...
+// If LCD_DELAY is set in the count, one more byte follows the parameters
+// giving a delay in milliseconds to wait before the next command.
+// The table is chosen at build time by LCD_CONTROLLER (see lcd.h).
+//===========================================================================
+#define LCD_DELAY 0x80
+
+#if LCD_CONTROLLER == LCD_ILI9341
+
+// Initialization sequence for the 2.2inch ILI9341
+#define LCD_MADCTL_BGR (1 << 3)
+static const uint8_t lcd_init_table[] = {
+    0xCF, 3, 0x00, 0xD9, 0x30, // C1
+    0xED, 4, 0x64, 0x03, 0x12, 0x81,
+    0xE8, 3, 0x85, 0x10, 0x7A,
+    0xCB, 5, 0x39, 0x2C, 0x00, 0x34, 0x02,
+    0xF7, 1, 0x20,
+    0xEA, 2, 0x00, 0x00,
+    0xC0, 1, 0x21,       // Power control: VRH[5:0]  //1B
+    0xC1, 1, 0x12,       // Power control: SAP[2:0];BT[3:0] //01
+    0xC5, 2, 0x39, 0x37, // VCM control: 3F 3C
+    0xC7, 1, 0xAB,       // VCM control2: B0
+    0x36, 1, 0x48,       // Memory Access Control
+    0x3A, 1, 0x55,
+    0xB1, 2, 0x00, 0x1B, // 1A
+    0xB6, 2, 0x0A, 0xA2, // Display Function Control
+    0xF2, 1, 0x00,       // 3Gamma Function Disable
+    0x26, 1, 0x01,       // Gamma curve selected
+    0xE0, 15,            // Set Gamma
+    0x0F, 0x23, 0x1F, 0x0B, 0x0E, 0x08, 0x4B, 0xA8, 0x3B, 0x0A, 0x14, 0x06, 0x10, 0x09, 0x00,
+    0xE1, 15, // Set Gamma
+    0x00, 0x1C, 0x20, 0x04, 0x10, 0x08, 0x34, 0x47, 0x44, 0x05, 0x0B, 0x09, 0x2F, 0x36, 0x0F,
+    0x2B, 4, 0x00, 0x00, 0x01, 0x3f,
+    0x2A, 4, 0x00, 0x00, 0x00, 0xef,
+    0x11, LCD_DELAY | 0, 120, // Exit Sleep, wait 120 ms
+    0x29, 0,                  // Display on
+};
+
+#elif LCD_CONTROLLER == LCD_ST7789
+
+// Initialization sequence for 240x320 ST7789V modules (RGB panel order)
+#define LCD_MADCTL_BGR 0
+static const uint8_t lcd_init_table[] = {
+    0x01, LCD_DELAY | 0, 150, // Software reset
+    0x11, LCD_DELAY | 0, 120, // Exit Sleep
+    0x3A, 1, 0x55,            // 16 bits per pixel
+    0x36, 1, 0x00,            // Memory Access Control
+    0x2A, 4, 0x00, 0x00, 0x00, 0xef,
+    0x2B, 4, 0x00, 0x00, 0x01, 0x3f,
+    0x21, 0,                 // Display inversion on, which these panels need for normal colors
+    0x13, LCD_DELAY | 0, 10, // Normal display mode
+    0x29, 0,                 // Display on
+};
+
+#else
+#error "Unknown LCD_CONTROLLER"
+#endif
+
+// Width, height and Memory Access Control (0x36) value for each rotation.
+static const struct
+{
+    u16 width;
+    u16 height;
+    u8 madctl;
+} lcd_orientation[4] = {
+    {LCD_W, LCD_H, LCD_MADCTL_BGR},                       // MY==0,MX==0,MV==0
+    {LCD_H, LCD_W, LCD_MADCTL_BGR | (1 << 6) | (1 << 5)}, // MY==0,MX==1,MV==1
+    {LCD_W, LCD_H, LCD_MADCTL_BGR | (1 << 7) | (1 << 6)}, // MY==1,MX==1,MV==0
+    {LCD_H, LCD_W, LCD_MADCTL_BGR | (1 << 7) | (1 << 5)}, // MY==1,MX==0,MV==1
+};
+
 // Configure the lcddev fields for the display orientation.
 void LCD_direction(u8 direction)
 {
     lcddev.setxcmd = 0x2A;
     lcddev.setycmd = 0x2B;
     lcddev.wramcmd = 0x2C;
-    switch (direction)
+    if (direction >= 4)
+        return;
+    lcddev.width = lcd_orientation[direction].width;
+    lcddev.height = lcd_orientation[direction].height;
+    LCD_WriteCommand(0x36, &lcd_orientation[direction].madctl, 1);
+    win.valid = 0;
+}
+
+// Where the non-blocking initialization is up to.
+enum
+{
+    INIT_IDLE,
+    INIT_RESET_ASSERTED, // nRESET held low for 100 ms
+    INIT_RESET_RELEASED, // 50 ms for the controller to come out of reset
+    INIT_TABLE,          // running lcd_init_table[]
+};
+static int init_state = INIT_IDLE;
+static unsigned int init_pos;
+static uint32_t init_deadline;
+
+// Wait until at least ms milliseconds from now before the next step.
+static void init_wait(unsigned int ms)
+{
+    init_deadline = micros() + ms * 1000;
+}
+
+static void (*select_pin)(int);
+
+// Set by LCD_DrawPictureAsync, which leaves the display selected.
+static u8 held;
+
+// Deselecting the display ends a RAMWR stream: the next pixels need 0x3C.
+// After LCD_DrawPictureAsync the display is still selected, so the next
+// select just carries on, unless the card has taken the bus meanwhile,
+// which deselected it through LCD_Flush.
+static void lcd_select(int val)
+{
+    if (held)
+    {
+        held = 0;
+        if (val)
+        {
+            spibus_unpark(&lcd_spi);
+            return;
+        }
+    }
+    if (val == 0)
     {
-    case 0:
-        lcddev.width = LCD_W;
-        lcddev.height = LCD_H;
-        LCD_WriteReg(0x36, (1 << 3) | (0 << 6) | (0 << 7)); // BGR==1,MY==0,MX==0,MV==0
-        break;
-    case 1:
-        lcddev.width = LCD_H;
-        lcddev.height = LCD_W;
-        LCD_WriteReg(0x36, (1 << 3) | (0 << 7) | (1 << 6) | (1 << 5)); // BGR==1,MY==1,MX==0,MV==1
-        break;
-    case 2:
-        lcddev.width = LCD_W;
-        lcddev.height = LCD_H;
-        LCD_WriteReg(0x36, (1 << 3) | (1 << 6) | (1 << 7)); // BGR==1,MY==0,MX==0,MV==0
-        break;
-    case 3:
-        lcddev.width = LCD_H;
-        lcddev.height = LCD_W;
-        LCD_WriteReg(0x36, (1 << 3) | (1 << 7) | (1 << 5)); // BGR==1,MY==1,MX==0,MV==1
-        break;
-    default:
-        break;
+        spi_finish();
+        win.streaming = 0;
     }
+    select_pin(val);
 }
 
-// Do the initialization sequence for the display.
-void LCD_Init(void (*reset)(int), void (*select)(int), void (*reg_select)(int))
+static void lcd_attach(void (*reset)(int), void (*select)(int), void (*reg_select)(int))
 {
     lcddev.reset = tft_reset;
-    lcddev.select = tft_select;
+    select_pin = tft_select;
+    lcddev.select = lcd_select;
     lcddev.reg_select = tft_reg_select;
     if (reset)
         lcddev.reset = reset;
     if (select)
-        lcddev.select = select;
+        select_pin = select;
     if (reg_select)
         lcddev.reg_select = reg_select;
+}
+
+//===========================================================================
+// Start the initialization sequence without waiting for it.
+// The mandatory reset and sleep-out delays are spent returning to the
+// caller, who keeps calling LCD_InitPoll() (and doing other work in
+// between) until it returns non-zero. The display stays selected until then,
+// so nothing else may draw to it in the meantime.
+//===========================================================================
+void LCD_InitStart(void (*reset)(int), void (*select)(int), void (*reg_select)(int))
+{
+    lcd_attach(reset, select, reg_select);
+    lcd_spi_reset();
+    win.valid = 0;
+    win.streaming = 0;
+#if !defined(SLOW_SPI)
+    lcd_dma_init();
+#endif
     lcddev.select(1);
-    LCD_Reset();
-    // Initialization sequence for 2.2inch ILI9341
-    LCD_WR_REG(0xCF);
-    LCD_WR_DATA(0x00);
-    LCD_WR_DATA(0xD9); // C1
-    LCD_WR_DATA(0X30);
-    LCD_WR_REG(0xED);
-    LCD_WR_DATA(0x64);
-    LCD_WR_DATA(0x03);
-    LCD_WR_DATA(0X12);
-    LCD_WR_DATA(0X81);
-    LCD_WR_REG(0xE8);
-    LCD_WR_DATA(0x85);
-    LCD_WR_DATA(0x10);
-    LCD_WR_DATA(0x7A);
-    LCD_WR_REG(0xCB);
-    LCD_WR_DATA(0x39);
-    LCD_WR_DATA(0x2C);
-    LCD_WR_DATA(0x00);
-    LCD_WR_DATA(0x34);
-    LCD_WR_DATA(0x02);
-    LCD_WR_REG(0xF7);
-    LCD_WR_DATA(0x20);
-    LCD_WR_REG(0xEA);
-    LCD_WR_DATA(0x00);
-    LCD_WR_DATA(0x00);
-    LCD_WR_REG(0xC0);  // Power control
-    LCD_WR_DATA(0x21); // VRH[5:0]  //1B
-    LCD_WR_REG(0xC1);  // Power control
-    LCD_WR_DATA(0x12); // SAP[2:0];BT[3:0] //01
-    LCD_WR_REG(0xC5);  // VCM control
-    LCD_WR_DATA(0x39); // 3F
-    LCD_WR_DATA(0x37); // 3C
-    LCD_WR_REG(0xC7);  // VCM control2
-    LCD_WR_DATA(0XAB); // B0
-    LCD_WR_REG(0x36);  // Memory Access Control
-    LCD_WR_DATA(0x48);
-    LCD_WR_REG(0x3A);
-    LCD_WR_DATA(0x55);
-    LCD_WR_REG(0xB1);
-    LCD_WR_DATA(0x00);
-    LCD_WR_DATA(0x1B); // 1A
-    LCD_WR_REG(0xB6);  // Display Function Control
-    LCD_WR_DATA(0x0A);
-    LCD_WR_DATA(0xA2);
-    LCD_WR_REG(0xF2); // 3Gamma Function Disable
-    LCD_WR_DATA(0x00);
-    LCD_WR_REG(0x26); // Gamma curve selected
-    LCD_WR_DATA(0x01);
-
-    LCD_WR_REG(0xE0); // Set Gamma
-    LCD_WR_DATA(0x0F);
-    LCD_WR_DATA(0x23);
-    LCD_WR_DATA(0x1F);
-    LCD_WR_DATA(0x0B);
-    LCD_WR_DATA(0x0E);
-    LCD_WR_DATA(0x08);
-    LCD_WR_DATA(0x4B);
-    LCD_WR_DATA(0XA8);
-    LCD_WR_DATA(0x3B);
-    LCD_WR_DATA(0x0A);
-    LCD_WR_DATA(0x14);
-    LCD_WR_DATA(0x06);
-    LCD_WR_DATA(0x10);
-    LCD_WR_DATA(0x09);
-    LCD_WR_DATA(0x00);
-    LCD_WR_REG(0XE1); // Set Gamma
-    LCD_WR_DATA(0x00);
-    LCD_WR_DATA(0x1C);
-    LCD_WR_DATA(0x20);
-    LCD_WR_DATA(0x04);
-    LCD_WR_DATA(0x10);
-    LCD_WR_DATA(0x08);
-    LCD_WR_DATA(0x34);
-    LCD_WR_DATA(0x47);
-    LCD_WR_DATA(0x44);
-    LCD_WR_DATA(0x05);
-    LCD_WR_DATA(0x0B);
-    LCD_WR_DATA(0x09);
-    LCD_WR_DATA(0x2F);
-    LCD_WR_DATA(0x36);
-    LCD_WR_DATA(0x0F);
-    LCD_WR_REG(0x2B);
-    LCD_WR_DATA(0x00);
-    LCD_WR_DATA(0x00);
-    LCD_WR_DATA(0x01);
-    LCD_WR_DATA(0x3f);
-    LCD_WR_REG(0x2A);
-    LCD_WR_DATA(0x00);
-    LCD_WR_DATA(0x00);
-    LCD_WR_DATA(0x00);
-    LCD_WR_DATA(0xef);
-    LCD_WR_REG(0x11);     // Exit Sleep
-    nano_wait(120000000); // Wait 120 ms
-    LCD_WR_REG(0x29);     // Display on
+    lcddev.reset(1); // Assert reset
+    init_wait(100);
+    init_state = INIT_RESET_ASSERTED;
+}
+
+//===========================================================================
+// Send every initialization command that is due.
+// Returns non-zero once the display is fully initialized.
+//===========================================================================
+int LCD_InitPoll(void)
+{
+    if (init_state == INIT_IDLE)
+        return 1;
+    if ((int32_t)(micros() - init_deadline) < 0)
+        return 0; // still waiting on a delay
+
+    if (init_state == INIT_RESET_ASSERTED)
+    {
+        lcddev.reset(0); // De-assert reset
+        init_wait(50);
+        init_state = INIT_RESET_RELEASED;
+        return 0;
+    }
+    if (init_state == INIT_RESET_RELEASED)
+    {
+        init_pos = 0;
+        init_state = INIT_TABLE;
+    }
+
+    while (init_pos < sizeof lcd_init_table)
+    {
+        uint8_t cmd = lcd_init_table[init_pos++];
+        uint8_t count = lcd_init_table[init_pos++];
+        LCD_WriteCommand(cmd, &lcd_init_table[init_pos], count & ~LCD_DELAY);
+        init_pos += count & ~LCD_DELAY;
+        if (count & LCD_DELAY)
+        {
+            init_wait(lcd_init_table[init_pos++]);
+            return 0;
+        }
+    }
 
     LCD_direction(USE_HORIZONTAL);
     lcddev.select(0);
+    init_state = INIT_IDLE;
+    return 1;
+}
+
+// Do the initialization sequence for the display.
+void LCD_Init(void (*reset)(int), void (*select)(int), void (*reg_select)(int))
+{
+    LCD_InitStart(reset, select, reg_select);
+    while (!LCD_InitPoll())
+        ;
 }
 
 __attribute((weak)) void init_lcd_spi(void)
@@ -385,52 +750,229 @@ __attribute((weak)) void init_lcd_spi(void)
     printf("init_lcd_spi() not defined.");
 }
 
-void LCD_Setup()
+// Configure the SPI and pins and start the non-blocking initialization.
+void LCD_SetupStart()
 {
     init_lcd_spi();
-    tft_select(0);
+    spibus_attach(&lcd_spi); // also deselects the display
     tft_reset(0);
     tft_reg_select(0);
-    LCD_Init(tft_reset, tft_select, tft_reg_select);
+    LCD_InitStart(tft_reset, tft_select, tft_reg_select);
+}
+
+void LCD_Setup()
+{
+    LCD_SetupStart();
+    while (!LCD_InitPoll())
+        ;
+}
+
+// Put the panel to sleep (display off, then sleep in) or wake it up (sleep
+// out, the mandatory 120 ms, display on). Frame memory is kept while it
+// sleeps, so the picture comes back as it was. The backlight is wired
+// straight to the supply on this board, so this is the closest there is
+// to dimming it. The 120 ms are slept through with the bus released.
+void LCD_Sleep(int sleep)
+{
+    lcddev.select(1);
+    if (sleep)
+    {
+        LCD_WR_REG(0x28); // Display OFF
+        LCD_WR_REG(0x10); // Sleep IN
+        lcddev.select(0);
+        return;
+    }
+    LCD_WR_REG(0x11); // Sleep OUT
+    lcddev.select(0);
+    delay_ms(120);
+    lcddev.select(1);
+    LCD_WR_REG(0x29); // Display ON
+    lcddev.select(0);
+}
+
+// Can pixels for the window (xs,ys)-(xe,ye) just carry on from where the
+// RAM write cursor is now? True when the window starts at the cursor and
+// either is a single row that fits in the current one, or is whole rows of
+// the current window.
+static int lcd_window_continues(u16 xs, u16 ys, u16 xe, u16 ye)
+{
+    if (!win.valid)
+        return 0;
+    if (ys == ye)
+    {
+        if (xe > win.xe)
+            return 0;
+    }
+    else if (xs != win.xs || xe != win.xe || ye > win.ye)
+        return 0;
+
+    unsigned int w = win.xe - win.xs + 1;
+    unsigned int row = win.ys + win.pos / w;
+    unsigned int col = win.xs + win.pos % w;
+    return row == ys && col == xs && row <= win.ye;
 }
 
 //===========================================================================
 // Select a subset of the display to work on, and issue the "Write RAM"
 // command to prepare to send pixel data to it.
+// The caller then writes exactly (xEnd-xStart+1)*(yEnd-yStart+1) pixels.
+// The window actually programmed may be larger than asked for: a single row
+// extends to the right edge and every window extends to the bottom, so that
+// later requests are more likely to either continue from the cursor or
+// leave CASET/PASET unchanged. Only the commands that change something are
+// sent.
 //===========================================================================
 void LCD_SetWindow(uint16_t xStart, uint16_t yStart, uint16_t xEnd, uint16_t yEnd)
 {
-    LCD_WR_REG(lcddev.setxcmd);
-    LCD_WR_DATA(xStart >> 8);
-    LCD_WR_DATA(0x00FF & xStart);
-    LCD_WR_DATA(xEnd >> 8);
-    LCD_WR_DATA(0x00FF & xEnd);
+    if (!WINDOW_CACHE)
+        win.valid = 0;
+    else if (lcd_window_continues(xStart, yStart, xEnd, yEnd))
+    {
+        if (!win.streaming)
+        {
+            LCD_WR_REG(0x3C); // Memory Write Continue
+            win.streaming = 1;
+        }
+        return;
+    }
 
-    LCD_WR_REG(lcddev.setycmd);
-    LCD_WR_DATA(yStart >> 8);
-    LCD_WR_DATA(0x00FF & yStart);
-    LCD_WR_DATA(yEnd >> 8);
-    LCD_WR_DATA(0x00FF & yEnd);
+    if (WINDOW_CACHE)
+    {
+        if (yStart == yEnd && xEnd < lcddev.width - 1)
+            xEnd = lcddev.width - 1;
+        if (yEnd < lcddev.height - 1)
+            yEnd = lcddev.height - 1;
+    }
 
+    if (!win.valid || xStart != win.xs || xEnd != win.xe)
+    {
+        uint8_t x[4] = {xStart >> 8, 0x00FF & xStart, xEnd >> 8, 0x00FF & xEnd};
+        LCD_WriteCommand(lcddev.setxcmd, x, 4);
+    }
+    if (!win.valid || yStart != win.ys || yEnd != win.ye)
+    {
+        uint8_t y[4] = {yStart >> 8, 0x00FF & yStart, yEnd >> 8, 0x00FF & yEnd};
+        LCD_WriteCommand(lcddev.setycmd, y, 4);
+    }
+    win.xs = xStart;
+    win.xe = xEnd;
+    win.ys = yStart;
+    win.ye = yEnd;
+    win.valid = 1;
     LCD_WriteRAM_Prepare();
 }
 
 //===========================================================================
-// Set the entire display to one color
+// Link check. Pixels can go out faster than the controller promises to
+// take them: CLOCK_SPI1_FAST_HZ is the fastest divisor SPI1 has, and most
+// modules keep up with it, but not all. LCD_LinkTest() finds out for this
+// one. It reads the controller ID back over MISO, then for each clock from
+// the fastest down writes a row of test pixels at that clock and reads them
+// back, and keeps the first clock that gives them back intact. Reads are
+// always at LCD_READ_HZ, inside the controller's read cycle, so only the
+// writes are on trial. If the ID does not come back the link cannot be
+// checked (MISO may not even be wired), and if no clock gives the row back
+// it is the reads that are in doubt as much as the writes; either way the
+// display stays at CLOCK_SPI1_HZ, unverified. The test row is left at the
+// top left corner for the first frame to draw over.
 //===========================================================================
-void LCD_Clear(u16 Color)
+#define LCD_READ_HZ 6000000     // serial read cycle is at least 150 ns
+#define LCD_LINK_MIN_HZ 3000000 // slowest clock tried
+#define LCD_LINK_PIXELS 32
+
+lcd_link_t lcd_link = {0, CLOCK_SPI1_HZ, 0, 0};
+
+#if !defined(SLOW_SPI) && LCD_CONTROLLER == LCD_ILI9341
+// A walking one, then a walking zero, so every data line is seen both ways.
+static u16 link_pattern(int i)
 {
+    u16 bit = 1 << (i % 16);
+    return i < 16 ? bit : (u16)~bit;
+}
+
+// Write the test row at hz, read it back, and say whether it came back intact.
+static int link_try(uint32_t hz)
+{
+    uint8_t rgb[3 * LCD_LINK_PIXELS];
+
+    spibus_rate(&lcd_spi, hz);
     lcddev.select(1);
-    unsigned int i, m;
-    LCD_SetWindow(0, 0, lcddev.width - 1, lcddev.height - 1);
+    LCD_SetWindow(0, 0, LCD_LINK_PIXELS - 1, 0);
     LCD_WriteData16_Prepare();
-    for (i = 0; i < lcddev.height; i++)
+    for (int i = 0; i < LCD_LINK_PIXELS; i++)
+        LCD_WriteData16(link_pattern(i));
+    LCD_WriteData16_End();
+    lcddev.select(0);
+
+    // RAMRD starts over at the top left of the window just written
+    spibus_rate(&lcd_spi, LCD_READ_HZ);
+    lcddev.select(1);
+    lcd_read(0x2E, rgb, sizeof rgb); // 18 bits a pixel, each color left aligned in a byte
+    lcddev.select(0);
+    win.valid = 0;
+
+    for (int i = 0; i < LCD_LINK_PIXELS; i++)
+    {
+        const uint8_t *p = &rgb[3 * i];
+        u16 c = (p[0] >> 3) << 11 | (p[1] >> 2) << 5 | p[2] >> 3;
+        if (c != link_pattern(i))
+            return 0;
+    }
+    return 1;
+}
+
+uint32_t LCD_LinkTest(void)
+{
+    uint8_t id[3];
+
+    lcd_link.verified = 0;
+    lcd_link.tries = 0;
+    lcd_link.max_hz = CLOCK_SPI1_HZ;
+    spibus_rate(&lcd_spi, LCD_READ_HZ);
+    lcddev.select(1);
+    lcd_read(0xD3, id, sizeof id); // Read ID4: version, then 0x93 0x41
+    lcddev.select(0);
+    lcd_link.id = (uint32_t)id[0] << 16 | id[1] << 8 | id[2];
+
+    if (id[1] == 0x93 && id[2] == 0x41)
     {
-        for (m = 0; m < lcddev.width; m++)
+        for (uint32_t hz = CLOCK_SPI1_FAST_HZ; hz >= LCD_LINK_MIN_HZ; hz /= 2)
         {
-            LCD_WriteData16(Color);
+            lcd_link.tries++;
+            if (link_try(hz))
+            {
+                lcd_link.max_hz = hz;
+                lcd_link.verified = 1;
+                break;
+            }
         }
     }
+    spibus_rate(&lcd_spi, lcd_link.max_hz);
+    return lcd_link.max_hz;
+}
+#else
+// SLOW_SPI has no way to read, and the ST7789 has no Read ID4: keep the default.
+uint32_t LCD_LinkTest(void)
+{
+    return lcd_link.max_hz;
+}
+#endif
+
+// The clock the display gets now.
+uint32_t LCD_LinkHz(void)
+{
+    return spibus_hz(&lcd_spi);
+}
+
+//===========================================================================
+// Set the entire display to one color
+//===========================================================================
+void LCD_Clear(u16 Color)
+{
+    lcddev.select(1);
+    LCD_SetWindow(0, 0, lcddev.width - 1, lcddev.height - 1);
+    LCD_WriteData16_Prepare();
+    LCD_WriteData16_Repeat(Color, (unsigned int)lcddev.width * lcddev.height);
     LCD_WriteData16_End();
     lcddev.select(0);
 }
@@ -453,14 +995,82 @@ void LCD_DrawPoint(u16 x, u16 y, u16 c)
     lcddev.select(0);
 }
 
+//===========================================================================
+// Fill a rectangle with color c from (x1,y1) to (x2,y2).
+//===========================================================================
+static void _LCD_Fill(u16 sx, u16 sy, u16 ex, u16 ey, u16 color)
+{
+    u16 width = ex - sx + 1;
+    u16 height = ey - sy + 1;
+    LCD_SetWindow(sx, sy, ex, ey);
+    LCD_WriteData16_Prepare();
+    LCD_WriteData16_Repeat(color, (unsigned int)width * height);
+    LCD_WriteData16_End();
+}
+
+// Fill the rectangle (x0,y0)-(x1,y1), clipped to the display.
+// The shape rasterisers below work in signed coordinates and go through here.
+static void _LCD_Span(int x0, int y0, int x1, int y1, u16 c)
+{
+    if (x0 < 0)
+        x0 = 0;
+    if (y0 < 0)
+        y0 = 0;
+    if (x1 >= lcddev.width)
+        x1 = lcddev.width - 1;
+    if (y1 >= lcddev.height)
+        y1 = lcddev.height - 1;
+    if (x0 > x1 || y0 > y1)
+        return;
+    _LCD_Fill(x0, y0, x1, y1, c);
+}
+
+// A straight run of pixels in one row or one column, drawn as one window.
+struct run
+{
+    int x0, y0; // first pixel
+    int x1, y1; // last pixel
+};
+
+static void run_flush(const struct run *r, u16 c)
+{
+    int xa = r->x0 < r->x1 ? r->x0 : r->x1;
+    int xb = r->x0 < r->x1 ? r->x1 : r->x0;
+    int ya = r->y0 < r->y1 ? r->y0 : r->y1;
+    int yb = r->y0 < r->y1 ? r->y1 : r->y0;
+    _LCD_Fill(xa, ya, xb, yb, c);
+}
+
+// Add the pixel (x,y) to the run, flushing the run first if it can't be extended.
+static void run_add(struct run *r, int x, int y, u16 c)
+{
+    int dx = x - r->x1;
+    int dy = y - r->y1;
+    if (dx == 0 && dy == 0)
+        return;
+    if ((dy == 0 && (dx == 1 || dx == -1) && r->y0 == r->y1) ||
+        (dx == 0 && (dy == 1 || dy == -1) && r->x0 == r->x1))
+    {
+        r->x1 = x;
+        r->y1 = y;
+        return;
+    }
+    run_flush(r, c);
+    r->x0 = r->x1 = x;
+    r->y0 = r->y1 = y;
+}
+
 //===========================================================================
 // Draw a line of color c from (x1,y1) to (x2,y2).
+// The pixels are the same as stepping a point along the line, but each
+// horizontal or vertical run of them is sent as one window, so an
+// axis-aligned line is a single fill.
 //===========================================================================
 static void _LCD_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
 {
-    u16 t;
-    volatile int xerr = 0, yerr = 0, delta_x, delta_y, distance;
-    volatile int incx, incy, uRow, uCol;
+    int xerr = 0, yerr = 0, delta_x, delta_y, distance;
+    int incx, incy, uRow, uCol;
+    struct run run = {x1, y1, x1, y1};
 
     delta_x = x2 - x1;
     delta_y = y2 - y1;
@@ -488,9 +1098,9 @@ static void _LCD_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
         distance = delta_x;
     else
         distance = delta_y;
-    for (t = 0; t <= distance + 1; t++)
+    for (int t = 0; t <= distance + 1; t++)
     {
-        _LCD_DrawPoint(uRow, uCol, c);
+        run_add(&run, uRow, uCol, c);
         xerr += delta_x;
         yerr += delta_y;
         if (xerr > distance)
@@ -504,6 +1114,7 @@ static void _LCD_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
             uCol += incy;
         }
     }
+    run_flush(&run, c);
 }
 
 void LCD_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
@@ -526,24 +1137,6 @@ void LCD_DrawRectangle(u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
     lcddev.select(0);
 }
 
-//===========================================================================
-// Fill a rectangle with color c from (x1,y1) to (x2,y2).
-//===========================================================================
-static void _LCD_Fill(u16 sx, u16 sy, u16 ex, u16 ey, u16 color)
-{
-    u16 i, j;
-    u16 width = ex - sx + 1;
-    u16 height = ey - sy + 1;
-    LCD_SetWindow(sx, sy, ex, ey);
-    LCD_WriteData16_Prepare();
-    for (i = 0; i < height; i++)
-    {
-        for (j = 0; j < width; j++)
-            LCD_WriteData16(color);
-    }
-    LCD_WriteData16_End();
-}
-
 //===========================================================================
 // Draw a filled rectangle of lines of color c from (x1,y1) to (x2,y2).
 //===========================================================================
@@ -554,63 +1147,63 @@ void LCD_DrawFillRectangle(u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
     lcddev.select(0);
 }
 
-static void _draw_circle_8(int xc, int yc, int x, int y, u16 c)
-{
-    _LCD_DrawPoint(xc + x, yc + y, c);
-    _LCD_DrawPoint(xc - x, yc + y, c);
-    _LCD_DrawPoint(xc + x, yc - y, c);
-    _LCD_DrawPoint(xc - x, yc - y, c);
-    _LCD_DrawPoint(xc + y, yc + x, c);
-    _LCD_DrawPoint(xc - y, yc + x, c);
-    _LCD_DrawPoint(xc + y, yc - x, c);
-    _LCD_DrawPoint(xc - y, yc - x, c);
-}
-
 //===========================================================================
 // Draw a circle of color c and radius r at center (xc,yc).
 // The fill parameter indicates if it is to be filled.
+//
+// This walks one octant with the midpoint algorithm. While y stays the same
+// the octant's points form a run along x, and that run is mirrored into the
+// other seven octants as four horizontal and four vertical spans. A filled
+// circle is one horizontal span per row: rows yc+-x reach out to +-y, and
+// rows yc+-y (sent once, when y is about to change) reach out to +-x.
 //===========================================================================
 void LCD_Circle(u16 xc, u16 yc, u16 r, u16 fill, u16 c)
 {
     lcddev.select(1);
-    int x = 0, y = r, yi, d;
-    d = 3 - 2 * r;
+    int x = 0, y = r, d = 3 - 2 * r;
+    int xs = 0; // where the current run of the octant at this y started
 
-    if (fill)
+    while (x <= y)
     {
-        while (x <= y)
+        int ny = y;
+        if (d < 0)
+        {
+            d = d + 4 * x + 6;
+        }
+        else
         {
-            for (yi = x; yi <= y; yi++)
-                _draw_circle_8(xc, yc, x, yi, c);
+            d = d + 4 * (x - y) + 10;
+            ny--;
+        }
 
-            if (d < 0)
-            {
-                d = d + 4 * x + 6;
-            }
-            else
-            {
-                d = d + 4 * (x - y) + 10;
-                y--;
-            }
-            x++;
+        if (fill)
+        {
+            _LCD_Span(xc - y, yc + x, xc + y, yc + x, c);
+            _LCD_Span(xc - y, yc - x, xc + y, yc - x, c);
         }
-    }
-    else
-    {
-        while (x <= y)
+        if (ny != y || x + 1 > ny)
         {
-            _draw_circle_8(xc, yc, x, y, c);
-            if (d < 0)
+            // the run at this y ends here
+            if (fill)
             {
-                d = d + 4 * x + 6;
+                _LCD_Span(xc - x, yc + y, xc + x, yc + y, c);
+                _LCD_Span(xc - x, yc - y, xc + x, yc - y, c);
             }
             else
             {
-                d = d + 4 * (x - y) + 10;
-                y--;
+                _LCD_Span(xc + xs, yc + y, xc + x, yc + y, c);
+                _LCD_Span(xc - x, yc + y, xc - xs, yc + y, c);
+                _LCD_Span(xc + xs, yc - y, xc + x, yc - y, c);
+                _LCD_Span(xc - x, yc - y, xc - xs, yc - y, c);
+                _LCD_Span(xc + y, yc + xs, xc + y, yc + x, c);
+                _LCD_Span(xc - y, yc + xs, xc - y, yc + x, c);
+                _LCD_Span(xc + y, yc - x, xc + y, yc - xs, c);
+                _LCD_Span(xc - y, yc - x, xc - y, yc - xs, c);
             }
-            x++;
+            xs = x + 1;
         }
+        y = ny;
+        x++;
     }
     lcddev.select(0);
 }
@@ -635,16 +1228,51 @@ static void _swap(u16 *a, u16 *b)
     *b = tmp;
 }
 
+// One edge of a filled triangle: x0 + dx*k/dy (truncated) for row k,
+// stepped with a running quotient and remainder instead of a division per
+// row, which the Cortex-M0 has to do in software.
+struct edge
+{
+    int x0, dir;
+    unsigned int q, rem;
+    unsigned int step_q, step_r, dy;
+};
+
+static void edge_start(struct edge *e, int x0, int dx, int dy, int k)
+{
+    unsigned int adx = dx < 0 ? -dx : dx;
+    e->x0 = x0;
+    e->dir = dx < 0 ? -1 : 1;
+    e->dy = dy;
+    e->step_q = adx / dy;
+    e->step_r = adx % dy;
+    e->q = adx * k / dy;
+    e->rem = adx * k % dy;
+}
+
+static int edge_next(struct edge *e)
+{
+    int x = e->x0 + e->dir * (int)e->q;
+    e->q += e->step_q;
+    e->rem += e->step_r;
+    if (e->rem >= e->dy)
+    {
+        e->rem -= e->dy;
+        e->q++;
+    }
+    return x;
+}
+
 //===========================================================================
 // Draw a filled triangle of color c with vertices at (x0,y0), (x1,y1), (x2,y2).
+// Each row is one span between the long edge (0-2) and the short edge
+// (0-1 above y1, 1-2 below).
 //===========================================================================
 void LCD_DrawFillTriangle(u16 x0, u16 y0, u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
 {
     lcddev.select(1);
-    u16 a, b, y, last;
-    int dx01, dy01, dx02, dy02, dx12, dy12;
-    long sa = 0;
-    long sb = 0;
+    int a, b, y, last;
+    struct edge e01, e02, e12;
     if (y0 > y1)
     {
         _swap(&y0, &y1);
@@ -680,14 +1308,9 @@ void LCD_DrawFillTriangle(u16 x0, u16 y0, u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
             b = x2;
         }
         _LCD_Fill(a, y0, b, y0, c);
+        lcddev.select(0);
         return;
     }
-    dx01 = x1 - x0;
-    dy01 = y1 - y0;
-    dx02 = x2 - x0;
-    dy02 = y2 - y0;
-    dx12 = x2 - x1;
-    dy12 = y2 - y1;
 
     if (y1 == y2)
     {
@@ -697,29 +1320,32 @@ void LCD_DrawFillTriangle(u16 x0, u16 y0, u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
     {
         last = y1 - 1;
     }
+    edge_start(&e02, x0, x2 - x0, y2 - y0, 0);
+    if (y0 <= last)
+        edge_start(&e01, x0, x1 - x0, y1 - y0, 0);
     for (y = y0; y <= last; y++)
     {
-        a = x0 + sa / dy01;
-        b = x0 + sb / dy02;
-        sa += dx01;
-        sb += dx02;
+        a = edge_next(&e01);
+        b = edge_next(&e02);
         if (a > b)
         {
-            _swap(&a, &b);
+            int t = a;
+            a = b;
+            b = t;
         }
         _LCD_Fill(a, y, b, y, c);
     }
-    sa = dx12 * (y - y1);
-    sb = dx02 * (y - y0);
+    if (y <= y2)
+        edge_start(&e12, x1, x2 - x1, y2 - y1, y - y1);
     for (; y <= y2; y++)
     {
-        a = x1 + sa / dy12;
-        b = x0 + sb / dy02;
-        sa += dx12;
-        sb += dx02;
+        a = edge_next(&e12);
+        b = edge_next(&e02);
         if (a > b)
         {
-            _swap(&a, &b);
+            int t = a;
+            a = b;
+            b = t;
         }
         _LCD_Fill(a, y, b, y, c);
     }
@@ -925,54 +1551,147 @@ const unsigned char asc2_1608[95][16] = {
 };
 
 //===========================================================================
-// Display a single character at position x,y on the screen.
-// fc,bc are the foreground,background colors
-// num is the ASCII character number
-// size is the height of the character (either 12 or 16)
-// When mode is set, the background will be transparent.
+// Text is drawn a whole string at a time: one window covering every
+// character, filled a pixel row at a time from a line buffer. Each font row
+// byte is expanded with text_lut, which turns a nibble into four pixel
+// masks (two per word), so a glyph row becomes a few word writes instead of
+// a branch per pixel.
 //===========================================================================
-void _LCD_DrawChar(u16 x, u16 y, u16 fc, u16 bc, char num, u8 size, u8 mode)
+
+// Pixel masks for the four bits of a nibble, lowest bit leftmost.
+static const uint32_t text_lut[16][2] = {
+    {0x00000000, 0x00000000}, {0x0000ffff, 0x00000000}, {0xffff0000, 0x00000000}, {0xffffffff, 0x00000000},
+    {0x00000000, 0x0000ffff}, {0x0000ffff, 0x0000ffff}, {0xffff0000, 0x0000ffff}, {0xffffffff, 0x0000ffff},
+    {0x00000000, 0xffff0000}, {0x0000ffff, 0xffff0000}, {0xffff0000, 0xffff0000}, {0xffffffff, 0xffff0000},
+    {0x00000000, 0xffffffff}, {0x0000ffff, 0xffffffff}, {0xffff0000, 0xffffffff}, {0xffffffff, 0xffffffff},
+};
+
+// Supplies the screen background that transparent text is composited over, if any.
+static void (*text_bg)(int x, int y, int n, u16 *out);
+
+//===========================================================================
+// Register a function that fills out[] with the n background pixels at
+// (x,y)..(x+n-1,y), i.e. what is on the screen behind transparent text.
+// It must be able to supply any pixel on the display. With one registered,
+// transparent text is sent as opaque rows of background and glyph pixels.
+// Without one, only the glyph's pixels are drawn, as horizontal spans.
+// Pass 0 to unregister.
+//===========================================================================
+void LCD_SetTextBackground(void (*row)(int x, int y, int n, u16 *out))
 {
-    u8 temp;
-    u8 pos, t;
-    num = num - ' ';
-    LCD_SetWindow(x, y, x + size / 2 - 1, y + size - 1);
-    if (!mode)
+    text_bg = row;
+}
+
+static const unsigned char *glyph_row(char ch, u8 size, u8 pos)
+{
+    if (size == 12)
+        return &asc2_1206[ch - ' '][pos];
+    return &asc2_1608[ch - ' '][pos];
+}
+
+// Draw count characters of s at (x,y), clipped to the display.
+static void _LCD_DrawText(u16 x, u16 y, u16 fc, u16 bc, const char *s, unsigned int count, u8 size, u8 mode)
+{
+    if (size != 12)
+        size = 16;
+    unsigned int w = size / 2;
+    unsigned int width = count * w;
+    unsigned int rows = size;
+    if (x >= lcddev.width || y >= lcddev.height || count == 0)
+        return;
+    if (x + width > lcddev.width)
+        width = lcddev.width - x;
+    if (y + rows > lcddev.height)
+        rows = lcddev.height - y;
+
+    if (mode && !text_bg)
     {
-        LCD_WriteData16_Prepare();
-        for (pos = 0; pos < size; pos++)
+        // No background to composite over: just the lit pixels, as runs.
+        for (unsigned int pos = 0; pos < rows; pos++)
         {
-            if (size == 12)
-                temp = asc2_1206[(int)num][pos];
-            else
-                temp = asc2_1608[(int)num][pos];
-            for (t = 0; t < size / 2; t++)
+            int start = -1;
+            unsigned int i = 0;
+            for (unsigned int c = 0; i < width; c++)
             {
-                if (temp & 0x01)
-                    LCD_WriteData16(fc);
-                else
-                    LCD_WriteData16(bc);
-                temp >>= 1;
+                unsigned char bits = *glyph_row(s[c], size, pos);
+                for (unsigned int t = 0; t < w && i < width; t++, i++, bits >>= 1)
+                {
+                    if (bits & 1)
+                    {
+                        if (start < 0)
+                            start = i;
+                    }
+                    else if (start >= 0)
+                    {
+                        _LCD_Fill(x + start, y + pos, x + i - 1, y + pos, fc);
+                        start = -1;
+                    }
+                }
             }
+            if (start >= 0)
+                _LCD_Fill(x + start, y + pos, x + width - 1, y + pos, fc);
         }
-        LCD_WriteData16_End();
+        return;
     }
-    else
+
+    // One row of the string's window, from frame_arena. Glyphs are 6 or 8 pixels
+    // wide, so every glyph starts on a word boundary, and the last one may run
+    // up to 7 pixels past the window.
+    uint32_t mark = arena_mark(&frame_arena);
+    uint32_t *text_line = (uint32_t *)arena_line(&frame_arena, width + 8);
+    if (!text_line)
+        return;
+
+    uint32_t f = fc | (uint32_t)fc << 16;
+    uint32_t b = bc | (uint32_t)bc << 16;
+    LCD_SetWindow(x, y, x + width - 1, y + rows - 1);
+    LCD_WriteData16_Prepare();
+    for (unsigned int pos = 0; pos < rows; pos++)
     {
-        for (pos = 0; pos < size; pos++)
+        if (mode)
+        {
+            // Start from the background row and drop the glyph pixels in.
+            text_bg(x, y + pos, width, (u16 *)text_line);
+        }
+        uint32_t *d = text_line;
+        for (unsigned int c = 0; c * w < width; c++, d += w / 2)
         {
-            if (size == 12)
-                temp = asc2_1206[(int)num][pos];
+            unsigned char bits = *glyph_row(s[c], size, pos);
+            const uint32_t *lo = text_lut[bits & 15];
+            const uint32_t *hi = text_lut[bits >> 4];
+            if (mode)
+            {
+                d[0] ^= (d[0] ^ f) & lo[0];
+                d[1] ^= (d[1] ^ f) & lo[1];
+                d[2] ^= (d[2] ^ f) & hi[0];
+                if (w == 8)
+                    d[3] ^= (d[3] ^ f) & hi[1];
+            }
             else
-                temp = asc2_1608[(int)num][pos];
-            for (t = 0; t < size / 2; t++)
             {
-                if (temp & 0x01)
-                    _LCD_DrawPoint(x + t, y + pos, fc);
-                temp >>= 1;
+                d[0] = b ^ ((b ^ f) & lo[0]);
+                d[1] = b ^ ((b ^ f) & lo[1]);
+                d[2] = b ^ ((b ^ f) & hi[0]);
+                if (w == 8)
+                    d[3] = b ^ ((b ^ f) & hi[1]);
             }
         }
+        LCD_WriteData16_Block((const u16 *)text_line, width);
     }
+    LCD_WriteData16_End();
+    arena_release(&frame_arena, mark);
+}
+
+//===========================================================================
+// Display a single character at position x,y on the screen.
+// fc,bc are the foreground,background colors
+// num is the ASCII character number
+// size is the height of the character (either 12 or 16)
+// When mode is set, the background will be transparent.
+//===========================================================================
+void _LCD_DrawChar(u16 x, u16 y, u16 fc, u16 bc, char num, u8 size, u8 mode)
+{
+    _LCD_DrawText(x, y, fc, bc, &num, 1, size, mode);
 }
 
 void LCD_DrawChar(u16 x, u16 y, u16 fc, u16 bc, char num, u8 size, u8 mode)
@@ -985,28 +1704,25 @@ void LCD_DrawChar(u16 x, u16 y, u16 fc, u16 bc, char num, u8 size, u8 mode)
 //===========================================================================
 // Display a string of characters starting at location x,y.
 // fc,bc are the foreground,background colors.
-// p is the pointer to the string.
+// p is the pointer to the string, which ends at the first character that
+// isn't printable ASCII.
 // size is the height of the character (either 12 or 16)
 // When mode is set, the background will be transparent.
 //===========================================================================
 void LCD_DrawString(u16 x, u16 y, u16 fc, u16 bg, const char *p, u8 size, u8 mode)
 {
+    unsigned int count = 0;
+    while (p[count] <= '~' && p[count] >= ' ')
+        count++;
     lcddev.select(1);
-    while ((*p <= '~') && (*p >= ' '))
-    {
-        if (x > (lcddev.width - 1) || y > (lcddev.height - 1))
-            return;
-        _LCD_DrawChar(x, y, fc, bg, *p, size, mode);
-        x += size / 2;
-        p++;
-    }
+    _LCD_DrawText(x, y, fc, bg, p, count, size, mode);
     lcddev.select(0);
 }
 
 //===========================================================================
 // Draw a picture with upper left corner at (x0,y0).
 //===========================================================================
-void LCD_DrawPicture(u16 x0, u16 y0, const Picture *pic)
+static void draw_picture(u16 x0, u16 y0, const Picture *pic)
 {
     lcddev.select(1);
     u16 x1 = x0 + pic->width - 1;
@@ -1023,14 +1739,33 @@ void LCD_DrawPicture(u16 x0, u16 y0, const Picture *pic)
     LCD_SetWindow(x0, y0, x1, y1);
     LCD_WriteData16_Prepare();
 
-    u16 *data = (u16 *)pic->pixel_data;
-    for (int y = 0; y < pic->height; y++)
-    {
-        u16 *row = &data[y * pic->width];
-        for (int x = 0; x < pic->width; x++)
-            LCD_WriteData16(*row++);
-    }
+    lcd_draw_block(pic->pix2, pic->width * pic->height);
 
     LCD_WriteData16_End();
+}
+
+void LCD_DrawPicture(u16 x0, u16 y0, const Picture *pic)
+{
+    draw_picture(x0, y0, pic);
     lcddev.select(0);
 }
+
+//===========================================================================
+// Draw a picture like LCD_DrawPicture, but return while its pixels are
+// still going out, so the caller can get on with the next one. pic must
+// not change until the next LCD call or LCD_Flush(), which wait for them.
+// Without DMA (SLOW_SPI) this is just LCD_DrawPicture.
+//===========================================================================
+void LCD_DrawPictureAsync(u16 x0, u16 y0, const Picture *pic)
+{
+    draw_picture(x0, y0, pic);
+    held = 1;
+    spibus_park(&lcd_spi);
+}
+
+// Wait for an LCD_DrawPictureAsync to finish and deselect the display.
+void LCD_Flush(void)
+{
+    if (held)
+        lcddev.select(0);
+}
@@ -33,6 +33,16 @@ typedef struct
 // is defined properly for the rotation.
 extern lcd_dev_t lcddev;
 
+// Bytes sent to the display so far (wraps around). Sample it before and after
+// a drawing call to see what the call cost on the wire.
+extern volatile uint32_t lcd_spi_bytes;
+
+#if defined(LCD_HOST)
+// 0 makes LCD_SetWindow send every window as asked for, with CASET, PASET
+// and RAMWR each time, so a test can check the cache against it.
+extern u8 lcd_host_window_cache;
+#endif
+
 // Rotation:
 // 0: rotate 0
 // 1: rotate: 90
@@ -40,6 +50,14 @@ extern lcd_dev_t lcddev;
 // 3: rotate 270
 #define USE_HORIZONTAL 0
 
+// Display controller the initialization tables are built for.
+// Override with -DLCD_CONTROLLER=LCD_ST7789 in build_flags.
+#define LCD_ILI9341 1
+#define LCD_ST7789 2
+#ifndef LCD_CONTROLLER
+#define LCD_CONTROLLER LCD_ILI9341
+#endif
+
 // The dimensions of the display.
 #define LCD_W 240
 #define LCD_H 320
@@ -67,7 +85,25 @@ extern lcd_dev_t lcddev;
 #define LBBLUE 0X2B12
 
 void LCD_Setup(void);
+void LCD_SetupStart(void);
 void LCD_Init(void (*reset)(int), void (*select)(int), void (*reg_select)(int));
+void LCD_InitStart(void (*reset)(int), void (*select)(int), void (*reg_select)(int));
+int LCD_InitPoll(void);
+void LCD_Sleep(int sleep);
+
+// What LCD_LinkTest() found out about the display's SPI link.
+typedef struct
+{
+    uint32_t id;     // Read ID4 reply (version, 0x93, 0x41 for an ILI9341)
+    uint32_t max_hz; // fastest clock the display is given
+    u8 verified;     // a test pattern came back intact at max_hz
+    u8 tries;        // clocks tried
+} lcd_link_t;
+
+extern lcd_link_t lcd_link;
+
+uint32_t LCD_LinkTest(void);
+uint32_t LCD_LinkHz(void);
 void LCD_Clear(u16 Color);
 void LCD_DrawPoint(u16 x, u16 y, u16 c);
 void LCD_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2, u16 c);
@@ -97,5 +133,8 @@ typedef struct
 } Picture;
 
 void LCD_DrawPicture(u16 x0, u16 y0, const Picture *pic);
+void LCD_DrawPictureAsync(u16 x0, u16 y0, const Picture *pic);
+void LCD_Flush(void);
+void LCD_SetTextBackground(void (*row)(int x, int y, int n, u16 *out));
 
 #endif
@@ -0,0 +1,119 @@
+/**
+ * @file m2m.c
+ * @brief DMA memory-to-memory copies. See m2m.h.
+ */
+
+#include "m2m.h"
+
+#if defined(M2M_HOST)
+
+#include <string.h>
+#include <time.h>
+
+M2mHost m2m_host;
+
+static struct
+{
+    unsigned short *dst;
+    const unsigned short *src;
+    unsigned int count;
+    unsigned long long done_ns; // when the engine finishes it
+} pending;
+
+static unsigned long long now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+void m2m_init(void)
+{
+    pending.count = 0;
+}
+
+void m2m_copy(unsigned short *dst, const unsigned short *src, unsigned int count)
+{
+    m2m_wait();
+    if (count == 0)
+        return;
+    memset(dst, 0xa5, 2 * count); // in between, the destination holds neither old nor new
+    pending.dst = dst;
+    pending.src = src;
+    pending.count = count;
+    unsigned long long takes = (unsigned long long)count * m2m_host.ns_per_halfword;
+    pending.done_ns = takes ? now_ns() + takes : 0;
+    m2m_host.copies++;
+    m2m_host.busy_ns += takes;
+}
+
+void m2m_wait(void)
+{
+    if (!pending.count)
+        return;
+    if (pending.done_ns)
+    {
+        unsigned long long t = now_ns(), until = pending.done_ns;
+        if (t < until)
+            m2m_host.stalled_ns += until - t;
+        while (t < until) // as the real one polls TCIF1
+            t = now_ns();
+    }
+    memcpy(pending.dst, pending.src, 2 * pending.count);
+    pending.count = 0;
+}
+
+#else
+
+#include "stm32f0xx.h"
+
+static int busy;
+
+/**
+ * @brief Set up DMA1 channel 1 for halfword copies.
+ * @return void
+ */
+void m2m_init(void)
+{
+    RCC->AHBENR |= RCC_AHBENR_DMA1EN;
+    DMA1_Channel1->CCR = 0;
+    busy = 0;
+}
+
+/**
+ * @brief Start copying halfwords. Waits for the previous copy first.
+ * @param dst Where to copy them to.
+ * @param src Where to copy them from, RAM or flash.
+ * @param count How many, at most 65535.
+ * @return void
+ */
+void m2m_copy(unsigned short *dst, const unsigned short *src, unsigned int count)
+{
+    m2m_wait();
+    if (count == 0)
+        return;
+    // the "peripheral" side is the source
+    DMA1_Channel1->CCR = DMA_CCR_MEM2MEM | DMA_CCR_MSIZE_0 | DMA_CCR_PSIZE_0 | DMA_CCR_MINC | DMA_CCR_PINC;
+    DMA1_Channel1->CPAR = (uint32_t)src;
+    DMA1_Channel1->CMAR = (uint32_t)dst;
+    DMA1_Channel1->CNDTR = count;
+    DMA1_Channel1->CCR |= DMA_CCR_EN;
+    busy = 1;
+}
+
+/**
+ * @brief Wait for the copy in progress, if any, to finish.
+ * @return void
+ */
+void m2m_wait(void)
+{
+    if (!busy)
+        return;
+    while ((DMA1->ISR & DMA_ISR_TCIF1) == 0)
+        ;
+    DMA1->IFCR = DMA_IFCR_CGIF1;
+    DMA1_Channel1->CCR &= ~DMA_CCR_EN;
+    busy = 0;
+}
+
+#endif /* M2M_HOST */
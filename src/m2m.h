@@ -0,0 +1,42 @@
+#ifndef M2M_H
+#define M2M_H
+
+/*
+ * Memory-to-memory copies on DMA1 channel 1, for moving rows of pixels
+ * while the CPU gets on with something else. m2m_copy() starts a copy and
+ * returns at once; m2m_wait() returns when it is done. There is one copy
+ * at a time, and the destination must not be read, nor the source
+ * changed, until the wait.
+ *
+ * The channel has the lowest DMA priority, so the display's SPI channel
+ * always wins the bus. Copying halfwords from flash costs the DMA about
+ * the same bus cycles as the CPU's own loop would, but the CPU is free
+ * meanwhile, apart from the bus cycles the two share.
+ *
+ * Build with -DM2M_HOST to run on a PC: m2m_copy() scribbles over the
+ * destination and m2m_wait() makes the copy, so reading the destination
+ * too early, or starting a copy into a buffer something else is still
+ * reading, shows up as wrong pixels. With m2m_host.ns_per_halfword set,
+ * the simulated engine also takes that long: a copy is done that long
+ * after it starts, and m2m_wait() spins until then, so how much of the
+ * engine's time the CPU spent on other work can be measured.
+ */
+
+#if defined(M2M_HOST)
+typedef struct
+{
+    unsigned int ns_per_halfword;  // the engine's completion latency; 0 for none
+    unsigned int copies;
+    unsigned long long busy_ns;    // time the engine spent copying
+    unsigned long long stalled_ns; // of that, time m2m_wait() spent waiting for it
+} M2mHost;
+
+extern M2mHost m2m_host;
+#endif
+
+/* Function Prototypes */
+void m2m_init(void);
+void m2m_copy(unsigned short *dst, const unsigned short *src, unsigned int count);
+void m2m_wait(void);
+
+#endif /* M2M_H */
@@ -9,149 +9,87 @@
 #include "stm32f0xx.h"
 
 #include "lcd.h"
+#include "picture.h"
+#include "assets.h"
+#include "obstacle.h"
+#include "physics.h"
+#include "governor.h"
+#include "power.h"
+#include "clock.h"
+#include "snapshot.h"
+#include "sched.h"
+#include "m2m.h"
+#include "pins.h"
+#include "spibus.h"
+#include "store.h"
 #include "utils.h"
 #include "eeprom.h"
 #include "score_display.h"
+#include "telemetry.h"
+#include "boot.h"
+#include "ramfunc.h"
+#include "stack.h"
+#include "arena.h"
+#include "autopilot.h"
+#include "game.h"
 
 /* Create a pointer to a picture object with an internal pix2 array holding pixel data */
 #define TempPicturePtr(name, width, height) Picture name[(width) * (height) / 6 + 2] = {{width, height, 2}}
 
-extern const Picture background; // load the background from background.c
-extern const Picture bird;       // load the bird from bird.c
-extern const Picture barrier;    // load the barrier from barrier.c
-
-#define BIRD_WIDTH 19                // bird width
-#define BIRD_HEIGHT 19               // bird height
-#define PADDING 5                    // padding
-#define GAP_WIDTH 80                 // gap width
-#define GAP_RANGE 140                // gap range
-#define BARRIER_WIDTH 220            // barrier width
-#define BARRIER_HEIGHT 20            // barrier height
-#define GAP_HEIGHT 20                // gap height
-#define BIRD_V0 0                    // bird initial velocity
-#define BARRIER_V0 2                 // barrier initial velocity
-#define BIRD_X0 100                  // bird initial x position
-#define BIRD_Y0 140                  // bird initial y position
-#define BARRIER_Y0 (320 - (30 / 2))  // barrier initial y position
-#define BARRIER_X0 (240 - (230 / 2)) // barrier initial x position
-#define BARRIER_Y_RESET 100          // barrier min y position before new barrier
-#define BIRD_MIN_X 50                // bird min x position
-#define BIRD_MAX_X 200               // bird max x position
+#define CARD_BACKGROUND "BACKGROU.565" // used instead of the built-in background if it is on the SD card
 
 // boolean values so we don't have to include stdbool.h
 #define FALSE 0
 #define TRUE 1
 
-/* Get picture pointers for bird and barrier, include padding for translation */
-TempPicturePtr(bird_ptr, BIRD_WIDTH + 2 * PADDING, BIRD_HEIGHT + 2 * PADDING);
-TempPicturePtr(barrier_ptr, BARRIER_WIDTH + 2 * PADDING, BARRIER_HEIGHT + 2 * PADDING);
+/* Interrupt priorities, 0 the most urgent (the M0 has four levels). Only a more urgent
+   handler preempts, so the physics step always gets in, even in the middle of a frame. */
+#define PRIO_PHYSICS 0 // TIM16: the physics step, which publishes the game state
+#define PRIO_IO 1      // SysTick, EXTI0 (button wakeup), DMA1 channels 4-7 (telemetry), TIM17 (posts frames)
+#define PRIO_TASKS 3   // PendSV: runs the posted tasks (see sched.h), drawing frames among them
 
-/* Define initial values */
-int barrier_x = BARRIER_X0;
-int barrier_y = BARRIER_Y0;
-int bird_x = BIRD_X0;
-int bird_y = BIRD_Y0;
-int barrier_v = BARRIER_V0;
-int bird_v = BIRD_V0;
-int bird_a = -3;
-
-int game_over = FALSE;
-int y_gap = GAP_RANGE << 2;
-int score = 0;
-int in_barrier = FALSE;
-uint32_t high_score = 0;
-
-/**
- * @brief Initialize the SPI1 peripheral to run at 12MHz.
- * @return void
- */
-void init_spi_slow()
-{
-    // configure SPI1
-    // pb3 sck, pb4 miso, pb5 mosi
-    RCC->AHBENR |= RCC_AHBENR_GPIOBEN;
-    GPIOB->MODER &= ~(GPIO_MODER_MODER3 | GPIO_MODER_MODER4 | GPIO_MODER_MODER5);
-    GPIOB->MODER |= GPIO_MODER_MODER3_1 | GPIO_MODER_MODER4_1 | GPIO_MODER_MODER5_1;
-    GPIOB->AFR[0] &= ~(GPIO_AFRL_AFRL3 | GPIO_AFRL_AFRL4 | GPIO_AFRL_AFRL5);
-
-    // enable the clock to SPI1
-    RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
-
-    // disable SPI1
-    SPI1->CR1 &= ~SPI_CR1_SPE;
-
-    // set the baud rate divisor to the max possible
-    SPI1->CR1 |= SPI_CR1_BR;
+#define READOUT_DEADLINE_US 20000                 // 8-segment readout tasks
+#define SAVE_DEADLINE_US 100000                   // high score saves, a few EEPROM write cycles
+#define AUTOPILOT_DEADLINE_US (1000000 / PHYS_HZ) // the autopilot's decision, before the next physics step
 
-    // master mode
-    SPI1->CR1 |= SPI_CR1_MSTR;
+/* Get a picture pointer for the bird */
+TempPicturePtr(bird_ptr, BIRD_WIDTH, BIRD_HEIGHT);
 
-    // 8 bit data size
-    SPI1->CR2 |= SPI_CR2_DS_0 | SPI_CR2_DS_1 | SPI_CR2_DS_2 | SPI_CR2_DS_3;
-    SPI1->CR2 &= ~SPI_CR2_DS_3;
+/* The barriers on the display, drawn by the renderer (the physics step's are in game.c) */
+ObstacleScreen barrier_screen;
 
-    // software slave management and internal slave select
-    SPI1->CR1 |= SPI_CR1_SSM | SPI_CR1_SSI;
-
-    // set fifo reception bit
-    SPI1->CR2 |= SPI_CR2_FRXTH;
-
-    // enable SPI1
-    SPI1->CR1 |= SPI_CR1_SPE;
-}
+/* The background everything is drawn over: the built-in one, or one streamed from the SD card */
+const Asset *backdrop = &background;
+StoreFile card_file;
+AssetStream card_stream;
+Asset card_background;
 
-/**
- * @brief Enable the SD card in the TFT display.
- * @return void
- */
-void enable_sdcard()
-{
-    GPIOB->ODR &= ~GPIO_ODR_2;
-}
-
-/**
- * @brief Disable the SD card in the TFT display.
- * @return void
- */
-void disable_sdcard()
-{
-    GPIOB->ODR |= GPIO_ODR_2;
-}
-
-/**
- * @brief Initialize the SD card I/O.
- * @return void
- */
-void init_sdcard_io()
-{
-    // call init_spi_slow()
-    init_spi_slow();
-
-    // configure pb2 as output
-    RCC->AHBENR |= RCC_AHBENR_GPIOBEN;
-    GPIOB->MODER &= ~GPIO_MODER_MODER2;
-    GPIOB->MODER |= GPIO_MODER_MODER2_0;
-
-    // call disable_sdcard()
-    disable_sdcard();
-}
-
-/**
- * @brief Set the SPI1 peripheral to run at 48MHz.
- * @return void
- */
-void sdcard_io_high_speed()
-{
-    // disable SPI1
-    SPI1->CR1 &= ~SPI_CR1_SPE;
-
-    // set the baud rate register to achieve 12MHz (divide by 4)
-    SPI1->CR1 &= ~SPI_CR1_BR;
-    SPI1->CR1 |= SPI_CR1_BR_0;
+/* Define initial values */
+int bird_drawn_x = BIRD_X0; // where the bird is on the display
 
-    // enable SPI1
-    SPI1->CR1 |= SPI_CR1_SPE;
-}
+volatile int playing = FALSE;        // the physics step runs only during a game
+uint32_t high_score = 0;
+int button_down = FALSE;             // last sampled state of PA0, for input edge telemetry
+uint16_t frame_count = 0;            // frames rendered, for telemetry
+Governor governor;                   // picks the frame period
+int readout = TLM_CMD_SCORE;         // what the 8-segment displays show
+Autopilot autopilot;                 // flies demo games
+volatile int demo = FALSE;           // the game in progress is the autopilot's
+volatile int autopilot_down = FALSE; // the autopilot's button, for the next physics step
+uint32_t idle_since;                 // start of the idle time on the title screen, which demo games do not end
+
+void draw_frame();
+void show_readout();
+void report_memory();
+void save_high_score();
+void fly_demo();
+
+/* Work posted by the interrupt handlers, run by PendSV */
+Task frame_task = TASK(draw_frame, SCHED_URGENT, 0); // deadline is the frame period, set by init_tim17()
+Task readout_task = TASK(show_readout, SCHED_BACKGROUND, READOUT_DEADLINE_US);
+Task memory_task = TASK(report_memory, SCHED_BACKGROUND, READOUT_DEADLINE_US);
+Task save_task = TASK(save_high_score, SCHED_BACKGROUND, SAVE_DEADLINE_US);
+Task autopilot_task = TASK(fly_demo, SCHED_BACKGROUND, AUTOPILOT_DEADLINE_US);
 
 // initialize the LCD
 /**
@@ -162,144 +100,73 @@ void sdcard_io_high_speed()
 void init_lcd_spi()
 {
 
-    // configure pb8, 11, 14 as ouptut
+    // configure pb11 (reset) and pb14 (dc) as output; pb8 (cs) is set up by the bus
+    pin_claim(PIN('B', 11), "lcd");
+    pin_claim(PIN('B', 14), "lcd");
     RCC->AHBENR |= RCC_AHBENR_GPIOBEN;
-    GPIOB->MODER &= ~(GPIO_MODER_MODER8 | GPIO_MODER_MODER11 | GPIO_MODER_MODER14);
-    GPIOB->MODER |= GPIO_MODER_MODER8_0 | GPIO_MODER_MODER11_0 | GPIO_MODER_MODER14_0;
-
-    // call init_spi_slow()
-    init_spi_slow();
+    GPIOB->MODER &= ~(GPIO_MODER_MODER11 | GPIO_MODER_MODER14);
+    GPIOB->MODER |= GPIO_MODER_MODER11_0 | GPIO_MODER_MODER14_0;
 
-    // call sdcard_io_high_speed()
-    sdcard_io_high_speed();
+    // SPI1, shared with the SD card
+    spibus_init();
 }
 
-/**
- * @brief Copy a subset of a large source picture into a smaller destination.
- * @param dst The destination picture.
- * @param src The source picture.
- * @param sx The x offset into the source picture.
- * @param sy The y offset into the source picture.
- * @return void
- */
-void pic_subset(Picture *dst, const Picture *src, int sx, int sy)
+/* Where update_bird_pos() is drawing the bird */
+typedef struct
 {
-    int dw = dst->width;
-    int dh = dst->height;
-    for (int y = 0; y < dh; y++)
-    {
-        if (y + sy < 0)
-            continue;
-        if (y + sy >= src->height)
-            break;
-        for (int x = 0; x < dw; x++)
-        {
-            if (x + sx < 0)
-                continue;
-            if (x + sx >= src->width)
-                break;
-            dst->pix2[dw * y + x] = src->pix2[src->width * (y + sy) + x + sx];
-        }
-    }
-}
+    int x;   // left edge
+    int top; // top row
+} BirdPlace;
 
-/**
- * @brief Overlay a picture onto a destination picture.
- * @param dst The destination picture.
- * @param xoffset The x offset into the destination picture.
- * @param yoffset The y offset into the destination picture.
- * @param src The source picture.
- * @param transparent The color in the source picture that will not be copied.
- * @return void
- */
-void pic_overlay(Picture *dst, int xoffset, int yoffset, const Picture *src, int transparent)
+/* asset_compose() overlay for update_bird_pos(): the barriers, then the bird's row */
+static void bird_overlay(void *ctx, int x, int y, Picture *line)
 {
-    for (int y = 0; y < src->height; y++)
-    {
-        int dy = y + yoffset;
-        if (dy < 0)
-            continue;
-        if (dy >= dst->height)
-            break;
-        for (int x = 0; x < src->width; x++)
-        {
-            int dx = x + xoffset;
-            if (dx < 0)
-                continue;
-            if (dx >= dst->width)
-                break;
-            unsigned short int p = src->pix2[y * src->width + x];
-            if (p != transparent)
-                dst->pix2[dy * dst->width + dx] = p;
-        }
-    }
+    const BirdPlace *at = ctx;
+    obstacles_overlay(&barrier_screen, x, y, line->width, line->pix2);
+    pic_overlay(line, at->x - x, at->top - y, bird_ptr, 0xffff);
 }
 
 /**
- * @brief Update the bird object position.
+ * @brief Update the bird object position. The rows from where it was last drawn to where it
+ * is now are redrawn over the background and barriers, so it may move any distance.
  * @param x The x position of new center of the bird.
  * @param y The y position of new center of the bird.
  * @return void
  */
 void update_bird_pos(int x, int y)
 {
-    TempPicturePtr(tmp, 29, 29);                                           // Create a temporary 29x29 image.
-    pic_subset(tmp, &background, x - tmp->width / 2, y - tmp->height / 2); // Copy the background
-    pic_overlay(tmp, 0, 0, bird_ptr, 0xffff);                              // Overlay the object
-    LCD_DrawPicture(x - tmp->width / 2, y - tmp->height / 2, tmp);         // Re-draw it to the screen
+    int x0 = (x < bird_drawn_x ? x : bird_drawn_x) - bird_ptr->width / 2;
+    int x1 = (x > bird_drawn_x ? x : bird_drawn_x) + bird_ptr->width / 2;
+    if (x0 < 0)
+        x0 = 0;
+    if (x1 > 239)
+        x1 = 239;
+
+    BirdPlace at = {x - bird_ptr->width / 2, y - bird_ptr->height / 2};
+    asset_compose(x0, at.top, x1 - x0 + 1, bird_ptr->height, backdrop, x0, at.top, bird_overlay, &at);
+    bird_drawn_x = x;
 }
 
 /**
- * @brief Initialize the bird object.
+ * @brief Compose the bird sprite into its buffer.
  * @return void
  */
-void init_bird()
+void prepare_bird()
 {
-    for (int i = 0; i < 29 * 29; i++)
+    for (int i = 0; i < BIRD_WIDTH * BIRD_HEIGHT; i++)
         bird_ptr->pix2[i] = 0xffff;
 
-    pic_overlay(bird_ptr, PADDING, PADDING, &bird, 0xffff);
-
-    update_bird_pos(BIRD_X0, BIRD_Y0);
-}
-
-/**
- * @brief Create a barrier object with a gap at y_gap.
- * @param y_gap The y position of the gap.
- * @return void
- */
-void create_barrier(int y_gap)
-{
-
-    int total_pixels = (BARRIER_WIDTH + 2 * PADDING) * (BARRIER_HEIGHT + 2 * PADDING);
-    for (int i = 0; i < total_pixels; i++)
-        barrier_ptr->pix2[i] = 0xffff;
-
-    pic_overlay(barrier_ptr, PADDING, PADDING, &barrier, 0xffff);
-
-    // overwrite the barrier obj for a gap
-    for (int i = 0; i < total_pixels; i++)
-    {
-        int mod = i % (BARRIER_WIDTH + 2 * PADDING);
-        if (mod > y_gap && mod < y_gap + GAP_WIDTH)
-        {
-            barrier_ptr->pix2[i] = 0xffff;
-        }
-    }
+    asset_overlay(bird_ptr, 0, 0, &bird, 0);
 }
 
 /**
- * @brief Update the barrier object position.
- * @param x The x position of the center of the barrier.
- * @param y The y position of the center of the barrier.
+ * @brief Draw the bird at its initial position.
  * @return void
  */
-void update_barrier_pos(int x, int y)
+void init_bird()
 {
-    TempPicturePtr(tmp, 230, 30);                                          // Create a temporary 30x110 image.
-    pic_subset(tmp, &background, x - tmp->width / 2, y - tmp->height / 2); // Copy the background
-    pic_overlay(tmp, 0, 0, barrier_ptr, 0xffff);                           // Overlay the object
-    LCD_DrawPicture(x - tmp->width / 2, y - tmp->height / 2, tmp);         // Re-draw it to the screen
+    bird_drawn_x = BIRD_X0;
+    update_bird_pos(BIRD_X0, BIRD_Y0);
 }
 
 /**
@@ -308,6 +175,9 @@ void update_barrier_pos(int x, int y)
  */
 void init_input()
 {
+    // PA0 is the button
+    pin_claim(PIN('A', 0), "button");
+
     // Enable clock to GPIOA
     RCC->AHBENR |= RCC_AHBENR_GPIOAEN;
 
@@ -317,16 +187,6 @@ void init_input()
     // Set PA0 as pull-down
     GPIOA->PUPDR &= ~GPIO_PUPDR_PUPDR0;
     GPIOA->PUPDR |= GPIO_PUPDR_PUPDR0_1;
-
-    // enable the clock to GPIOB
-    RCC->AHBENR |= RCC_AHBENR_GPIOBEN;
-
-    // Set PB2 as input
-    GPIOB->MODER &= ~GPIO_MODER_MODER2;
-
-    // Set PB2 as pull-down
-    GPIOB->PUPDR &= ~GPIO_PUPDR_PUPDR2;
-    GPIOB->PUPDR |= GPIO_PUPDR_PUPDR2_1;
 }
 
 /**
@@ -339,11 +199,11 @@ void init_tim16()
     // RCC->APB1ENR |= RCC_APB1ENR_TIM1;
     RCC->APB2ENR |= RCC_APB2ENR_TIM16EN;
 
-    // Set prescaler value for interrupt every half second (interval can be adjusted)
-    TIM16->PSC = 3000 - 1;
+    // Count at 16 kHz
+    TIM16->PSC = clock_timing()->tim16_psc;
 
-    // Set refresh value for interrupt every half second
-    TIM16->ARR = 2000 - 1;
+    // One update (physics step) every 1/PHYS_HZ seconds
+    TIM16->ARR = CLOCK_TIM16_HZ / PHYS_HZ - 1;
 
     // Enable the update interrupt
     TIM16->DIER |= TIM_DIER_UIE;
@@ -355,27 +215,91 @@ void init_tim16()
     NVIC_EnableIRQ(TIM16_IRQn);
 }
 
+/**
+ * @brief The button as the physics step sees it: PA0, or the autopilot's during a demo game.
+ * @return Non-zero while it is held.
+ */
+int read_button()
+{
+    return demo ? autopilot_down : GPIOA->IDR & 1;
+}
+
+/**
+ * @brief Copy out the newest game state, and how far through the physics step after it the game is.
+ * @param view Where to put the state.
+ * @return The elapsed fraction of the step, from 0 to FIX_ONE.
+ */
+fix read_game(GameView *view)
+{
+    for (;;)
+    {
+        uint32_t gen = snapshot_read(&game, view);
+        // an update whose step has not run yet has already wrapped the count
+        fix alpha = (TIM16->SR & TIM_SR_UIF) ? FIX_ONE : (fix)(TIM16->CNT << FIX_SHIFT) / (fix)(TIM16->ARR + 1);
+        if (game.published == gen)
+            return alpha; // no step in between, so they go together
+    }
+}
+
+/**
+ * @brief Timer 16 interrupt handler. Samples the button and runs the physics step at PHYS_HZ.
+ * @return void
+ */
 void TIM16_IRQHandler()
 {
     // acknowledge the interrupt
     TIM16->SR &= ~TIM_SR_UIF;
 
-    bird_v += bird_a;
-
-    // max velocity is padding (anything more than padding ruins graphics)
-    if (bird_v < -1 * PADDING)
+    // report button edges
+    if (read_button() != button_down)
     {
-        bird_v = -1 * PADDING;
+        button_down = read_button();
+        telemetry_input(button_down);
     }
-    // Check if button pushed
-    if (GPIOA->IDR & 1)
-    {
 
-        // Button is pressed, give velocity boost
-        bird_v = 5;
+    if (playing && !game_over)
+    {
+        if (game_step(read_button()))
+        {
+            telemetry_score(score);
+            sched_post(&readout_task);
+        }
+        publish_game();
+        if (game_over && !demo) // demo scores are not high scores
+            sched_post(&save_task);
+        else if (demo && !game_over)
+            sched_post(&autopilot_task); // the button for the next step, from what was just published
     }
 }
 
+/**
+ * @brief Task: in a demo game, the autopilot decides whether the button is held for the next physics step,
+ * looking ahead from the state the last one published. Its look-ahead is too long for the physics interrupt.
+ * If it runs late, the step goes on with the last decision.
+ * @return void
+ */
+void fly_demo()
+{
+    GameView view;
+    snapshot_read(&game, &view);
+    if (!view.game_over)
+        autopilot_down = autopilot_press(&autopilot, &view.bird, &view.barriers);
+}
+
+/**
+ * @brief Set the interrupt priorities (see PRIO_PHYSICS), before the interrupts start.
+ * @return void
+ */
+void init_priorities()
+{
+    NVIC_SetPriority(TIM16_IRQn, PRIO_PHYSICS);
+    NVIC_SetPriority(SysTick_IRQn, PRIO_IO); // SysTick_Config() leaves it least urgent, so frames would eat ticks
+    NVIC_SetPriority(EXTI0_1_IRQn, PRIO_IO);
+    NVIC_SetPriority(DMA1_Ch4_7_DMA2_Ch3_5_IRQn, PRIO_IO);
+    NVIC_SetPriority(TIM17_IRQn, PRIO_IO);
+    NVIC_SetPriority(PendSV_IRQn, PRIO_TASKS);
+}
+
 /**
  * @brief Initialize timer 17 and enable it to generate interrupts.
  * @return void
@@ -385,11 +309,14 @@ void init_tim17()
     // enable the clock to TIM17
     RCC->APB2ENR |= RCC_APB2ENR_TIM17EN;
 
-    // set the prescaler to 48
-    TIM17->PSC = 48;
+    // count microseconds
+    TIM17->PSC = clock_timing()->us_psc;
 
-    // set the auto-reload register to 1000
-    TIM17->ARR = 1000;
+    // start at the governor's initial frame period; later changes take effect at the next update
+    governor_reset(&governor);
+    TIM17->ARR = governor.period_us - 1;
+    frame_task.deadline_us = governor.period_us;
+    TIM17->CR1 |= TIM_CR1_ARPE;
 
     // enable the update interrupt
     TIM17->DIER |= TIM_DIER_UIE;
@@ -401,7 +328,7 @@ void init_tim17()
 }
 
 /**
- * @brief Timer 17 interrupt handler. Used to update position of bird, barriers, control the flow of the game.
+ * @brief Timer 17 interrupt handler. Asks for a frame to be drawn.
  * @return void
  */
 void TIM17_IRQHandler()
@@ -409,163 +336,322 @@ void TIM17_IRQHandler()
     // acknowledge the interrupt
     TIM17->SR &= ~TIM_SR_UIF;
 
-    // move the bird
-    bird_x += bird_v;
+    sched_post(&frame_task); // if the last one is still waiting, this frame is dropped
+}
 
-    // check if bird hit ground
-    if (bird_x < BIRD_MIN_X)
+/**
+ * @brief Task: draw a frame, the barriers and bird where the physics step has them.
+ * @return void
+ */
+void draw_frame()
+{
+    uint32_t frame_start = micros();
+    uint32_t spi_start = lcd_spi_bytes;
+    arena_reset(&frame_arena); // nothing drawn last frame still holds any of it
+
+    // draw everything where it is part way through the current physics step
+    GameView view;
+    fix alpha = read_game(&view);
+    obstacles_draw(&barrier_screen, &view.barriers, alpha);
+    update_bird_pos(FIX_ROUND(body_lerp(&view.bird, alpha)), bird_y);
+
+    // pick up a readout change from the host
+    int cmd = telemetry_command();
+    if (cmd == TLM_CMD_SCORE || cmd == TLM_CMD_RATE || cmd == TLM_CMD_MISSES || cmd == TLM_CMD_STACK)
     {
-        game_over = TRUE;
-        return;
+        readout = cmd;
+        sched_post(&readout_task);
     }
 
-    // check if bird is crossing a barrier
-    if (bird_y > barrier_y - (BARRIER_HEIGHT >> 1) && bird_y < barrier_y + (BARRIER_HEIGHT >> 1))
-    {
-        in_barrier = TRUE;
-
-        // bird is in barrier, check if not in gap (crashing)
-        if ((bird_x < y_gap || bird_x > y_gap + GAP_WIDTH)) // bird outside of gap (either below or above)
-        {
-            game_over = TRUE;
-            return;
-        }
+    // every timer tick that elapsed while this frame was being drawn was lost
+    uint32_t render_us = micros() - frame_start;
+    uint32_t tick_us = TIM17->ARR + 1; // TIM17 counts microseconds
+    telemetry_frame(frame_count++, render_us, lcd_spi_bytes - spi_start, render_us / tick_us);
 
-        // bird passed barrier, get one point
-    }
-    else
+    // let the governor settle the frame period from what frames actually cost
+    if (governor_frame(&governor, render_us))
     {
-
-        if (in_barrier)
-            score++;
-
-        in_barrier = FALSE;
+        TIM17->ARR = governor.period_us - 1;
+        frame_task.deadline_us = governor.period_us;
     }
-
-    // bird can't go above the ceiling
-    if (bird_x > BIRD_MAX_X)
+    if (governor.frames == 0)
     {
-        bird_x = BIRD_MAX_X;
+        telemetry_rate(governor.period_us, governor.last_peak, governor.misses);
+        sched_post(&memory_task);
+        if (readout != TLM_CMD_SCORE)
+            sched_post(&readout_task);
     }
+}
 
-    // update the bird's position
-    update_bird_pos(bird_x, bird_y);
+/**
+ * @brief Task: show the chosen readout on the 8-segment displays.
+ * @return void
+ */
+void show_readout()
+{
+    GameView view;
+    snapshot_read(&game, &view);
 
-    /* Barrier physics */
-    barrier_y -= barrier_v; // update barrier position based on velocity
+    char buf[9];
+    if (readout == TLM_CMD_RATE)
+        snprintf(buf, 9, "Fps% 5d", (int)governor_rate(&governor));
+    else if (readout == TLM_CMD_MISSES)
+        snprintf(buf, 9, "Miss% 4d", (int)governor.misses);
+    else if (readout == TLM_CMD_STACK)
+        snprintf(buf, 9, "St% 6d", (int)stack_margin());
+    else
+        snprintf(buf, 9, "Score% 3d", view.score);
+    print(buf);
+}
 
-    /* If barrier at end of the screen, erase it and make a new barrier with a new gap location */
-    if (barrier_y < BARRIER_Y_RESET)
-    {
-        // reset the screen
-        LCD_DrawPicture(0, 0, &background);
-        barrier_y = BARRIER_Y0;
-        // get new gap
-        y_gap = rand() % GAP_RANGE;
+/**
+ * @brief Task: send the stack high-water mark and frame_arena's peak, once per governor window.
+ * @return void
+ */
+void report_memory()
+{
+    telemetry_stack(stack_used(), stack_margin());
+    telemetry_arena(frame_arena.peak, frame_arena.size, frame_arena.overflows);
+}
 
-        // make new barrier
-        create_barrier(y_gap);
-    }
+/**
+ * @brief Task: save the score of the game just over if it is a new high score.
+ * @return void
+ */
+void save_high_score()
+{
+    GameView view;
+    snapshot_read(&game, &view);
 
-    /* If barrier not at end of screen, just keep moving it */
-    else
+    if (view.score > high_score)
     {
-        update_barrier_pos(BARRIER_X0, barrier_y);
+        eeprom_save_high_score(view.score);
+        high_score = view.score;
     }
+}
 
+/**
+ * @brief Display the high score, cached from the EEPROM at boot, on the 8-segment displays.
+ * @return void
+ */
+void print_high_score()
+{
     char buf[9];
-    snprintf(buf, 9, "Score% 3d", score);
+    snprintf(buf, 9, "High% 3d", (int)high_score);
     print(buf);
 }
 
-void wait_for_start()
+/**
+ * @brief Wait on the title screen for the button, sleeping between interrupts. After
+ * ATTRACT_DEMO_MS the autopilot plays a demo game instead, and once ATTRACT_STOP_MS have passed
+ * without a press (demo games count as idle) the displays are turned off and the MCU stops until the button is pressed.
+ * With AUTOPILOT_SOAK every game is the autopilot's, started straight away.
+ * @return TRUE if the button was pressed, FALSE for a demo game.
+ */
+int wait_for_start()
 {
+#ifdef AUTOPILOT_SOAK
+    return FALSE;
+#else
+    uint32_t shown = millis();
+    if (!demo)
+        idle_since = shown; // after a demo game, the idle time goes on from before it
+    power_button_event();   // forget presses from before
+
     // wait for button press
-    while (1)
+    while (!(GPIOA->IDR & 1))
     {
-        if (GPIOA->IDR & 1)
+        attract_t next = power_attract(millis(), shown, idle_since);
+        if (next == ATTRACT_DEMO)
+            return FALSE;
+        if (next == ATTRACT_WAIT)
         {
-            break;
+            power_sleep(); // a press wakes it through EXTI0
+            continue;
         }
+
+        print("");     // blank the 8-segment displays, their refresh stops with the clocks
+        delay_ms(2);   // let the blank digits go out
+        LCD_Sleep(1);
+        power_stop();  // until the button is pressed
+        LCD_Sleep(0);
+        print_high_score();
+        idle_since = millis();
+        shown = idle_since;
+    }
+    return TRUE;
+#endif
+}
+
+/**
+ * @brief Whether a demo game should give way to the title screen: the button has been pressed,
+ * or the idle time before stop mode is up. A soak run's games go on until the bird crashes.
+ * @return TRUE to end the game.
+ */
+int demo_over()
+{
+#ifdef AUTOPILOT_SOAK
+    return FALSE;
+#else
+    if (!demo)
+        return FALSE;
+    if (GPIOA->IDR & 1)
+    {
+        idle_since = millis(); // someone is there: no stop mode for a while
+        return TRUE;
     }
+    uint32_t now = millis();
+    return power_attract(now, now, idle_since) == ATTRACT_STOP; // shown just now, so never ATTRACT_DEMO
+#endif
 }
 
 void reset_params()
 {
-    barrier_x = BARRIER_X0;
-    barrier_y = BARRIER_Y0;
-    bird_x = BIRD_X0;
-    bird_y = BIRD_Y0;
-    barrier_v = BARRIER_V0;
-    bird_v = BIRD_V0;
-    bird_a = -3;
-
-    game_over = FALSE;
-    y_gap = 100;
-    score = 0;
-
-    in_barrier = FALSE;
+    game_reset();
+    autopilot_down = FALSE;
+}
+
+/**
+ * @brief Supply background pixels for transparent text (see LCD_SetTextBackground).
+ * @param x The first column.
+ * @param y The row.
+ * @param n The number of pixels.
+ * @param out Where to put them.
+ * @return void
+ */
+static void background_row(int x, int y, int n, u16 *out)
+{
+    asset_row(backdrop, x, y, n, out);
 }
 
 void play()
 {
-    // print("PressPB2");
-    init_spi2();
-    spi2_setup_dma();
-    spi2_enable_dma();
+    // print("PressPA0");
     init_tim17();
+    // transparent text is composited over the background, unless that needs the SPI, which the text is using
+    LCD_SetTextBackground(backdrop->format == ASSET_STREAM ? 0 : background_row);
+
+    GameView view;
+    game_init();
+    autopilot_init(&autopilot, BIRD_GRAVITY, BIRD_FLAP, BIRD_MIN_X, BIRD_MAX_X, BIRD_Y0);
 
     // play game forever
     for (;;)
     {
 
         // reset the screen
-        LCD_DrawPicture(0, 0, &background); // redraw background
-        init_bird();                        // reset bird position
-        create_barrier(70);                 // first barrier needs to be created outside of the interrupt handler
+        asset_draw(0, 0, backdrop); // redraw background
+        obstacles_clear_screen(&barrier_screen, backdrop);
+        if (!boot_trace[BOOT_FIRST_FRAME])
+            boot_mark(BOOT_FIRST_FRAME);
+
+        // first barrier needs to be created outside of the interrupt handler
+        obstacles_reset(&barriers, OBSTACLE_MAX, BARRIER_SPACING);
+        obstacle_spawn(&barriers, FIX(BARRIER_Y0), FIX(BARRIER_V0), FIRST_GAP);
 
-        // get and display high score
-        eeprom_get_high_score(&high_score);
-        char buf[9];
-        snprintf(buf, 9, "High% 3d", (int)high_score);
-        print(buf);
+        init_bird(); // reset bird position
 
-        wait_for_start(); // wait for user to press PB2 to start
+        print_high_score();
+
+        clock_set(CLOCK_LOW);     // the title screen mostly sleeps
+        demo = !wait_for_start(); // wait for user to press PA0 to start, or for a demo game
+        clock_set(CLOCK_FULL);    // full speed for the game
 
         reset_params(); // reset all parameters
+        publish_game(); // the state the first frames are drawn from
+        playing = TRUE; // start the physics step, which publishes from now on
+        sched_post(&readout_task);
+        if (demo)
+            sched_post(&autopilot_task); // the first step's button
 
         NVIC_EnableIRQ(TIM17_IRQn); // enable tim17 interrupt to allow graphics to start updating
 
-        // keep playing until game over
+        // keep playing until game over, asleep whenever no interrupt handler is running
         for (;;)
         {
-            // check if game over
-            if (game_over)
+            // check if game over; the high score has been saved by then, since tasks preempt play()
+            snapshot_read(&game, &view);
+            if (view.game_over || demo_over())
             {
 
                 // stop updating display: disable tim17 interrupt
                 NVIC_DisableIRQ(TIM17_IRQn);
-
-                // update high score
-                if (score > high_score)
-                {
-                    eeprom_save_high_score(score);
-                }
+                playing = FALSE;
+                telemetry_game(view.score, demo);
                 break;
             }
+            power_sleep();
         }
     }
 }
 
+/**
+ * @brief Boot job: initialize the EEPROM and cache the high score.
+ * @return void
+ */
+static void boot_load_eeprom()
+{
+    eeprom_init();
+    eeprom_get_high_score(&high_score);
+}
+
+/**
+ * @brief Boot job: start the 8-segment displays.
+ * @return void
+ */
+static void boot_score_display()
+{
+    init_spi2();
+    spi2_setup_dma();
+    spi2_enable_dma();
+}
+
+/**
+ * @brief Use the background on the SD card, if there is a card with one the size of the display.
+ * The card shares SPI1 with the display, so this waits until the display is initialized.
+ * @return void
+ */
+static void load_card_assets()
+{
+    if (store_mount() == STORE_OK &&
+        store_asset(CARD_BACKGROUND, &card_file, &card_stream, &card_background) == STORE_OK &&
+        card_background.width == LCD_W && card_background.height == LCD_H)
+        backdrop = &card_background;
+    boot_mark(BOOT_SDCARD);
+}
+
+/* Work that runs while the display sits in its reset and sleep-out delays. */
+static const boot_job_t boot_jobs[] = {
+    {boot_load_eeprom, BOOT_EEPROM},
+    {prepare_bird, BOOT_ASSETS},
+    {boot_score_display, BOOT_SCORE_DISPLAY},
+};
+
 int main(void)
 {
 
-    internal_clock(); // HSI to 48MHz
-    eeprom_init();    // initialize eeprom
-    init_tim17();     // setup screen refresh
-    init_input();     // enable user input via PA0, PB2
-    init_tim16();     // bird velocity update and user input
-    LCD_Setup();      // enable TFT display
-    play();           // play the game forever
+    stack_paint();         // fill the free stack, so the deepest it gets can be read back
+    clock_init();          // HSI to 48MHz, and the peripheral timing for it
+    timebase_init();       // microsecond timebase on TIM2
+    power_init();          // SysTick, button wakeup and the RTC for sleep accounting
+    telemetry_init();      // binary telemetry on USART2
+    init_priorities();     // physics step over I/O over tasks
+    sched_init();          // tasks run by PendSV
+    m2m_init();            // DMA for background row copies
+    boot_mark(BOOT_START); // start of the boot timeline
+    init_tim17();          // setup screen refresh, at a rate the governor adjusts
+    init_input();          // enable user input via PA0
+    init_tim16();          // physics step and user input
+
+    // enable TFT display, with the eeprom, sprites and 8-segment displays set up during its delays
+    boot_run(boot_jobs, sizeof boot_jobs / sizeof boot_jobs[0]);
+    load_card_assets(); // a background from the SD card, if there is one
+    ramfunc_bench();    // with -DRAMFUNC_BENCH, time the SRAM kernels against their flash copies
+
+    // two inits set up the same pin: stop here, where a debugger shows pin_conflict
+    while (pin_conflict.claimant)
+        ;
+
+    play(); // play the game forever
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,280 @@
+/**
+ * @file obstacle.c
+ * @brief Fixed pool of scrolling barriers, their spawn scheduler, collisions and band rendering.
+ */
+
+#include <stdlib.h>
+
+#include "obstacle.h"
+#include "picture.h"
+#include "assets.h"
+
+#define BAND_X0 (BARRIER_X0 - 115)                             // left edge of the area a barrier redraws
+#define BAND_WIDTH (240 - BAND_X0)                             // out to the right edge, so rows stream into one window
+#define BARRIER_LEFT (BARRIER_X0 - BARRIER_WIDTH / 2)          // first display column of a barrier
+
+/**
+ * @brief Empty the pool.
+ * @param pool The pool.
+ * @param capacity How many barriers may be active at once, at most OBSTACLE_MAX.
+ * @param spacing Rows the newest barrier scrolls before the next one spawns.
+ * @return void
+ */
+void obstacles_reset(ObstaclePool *pool, int capacity, int spacing)
+{
+    if (capacity > OBSTACLE_MAX)
+        capacity = OBSTACLE_MAX;
+    pool->capacity = capacity;
+    pool->spacing = spacing;
+    pool->nactive = 0;
+    pool->nfree = 0;
+    for (int i = capacity - 1; i >= 0; i--)
+        pool->free[pool->nfree++] = i;
+}
+
+/**
+ * @brief Take a barrier from the pool and make it the newest active one.
+ * @param pool The pool.
+ * @param y The center row to start at.
+ * @param v The rows it scrolls per step.
+ * @param gap The start of its gap.
+ * @return The barrier, or 0 if the pool is exhausted.
+ */
+Obstacle *obstacle_spawn(ObstaclePool *pool, fix y, fix v, int gap)
+{
+    if (pool->nfree == 0)
+        return 0;
+    int s = pool->free[--pool->nfree];
+    Obstacle *o = &pool->slot[s];
+    o->y = y;
+    o->prev_y = y;
+    o->v = v;
+    o->gap = gap;
+    o->id = pool->next_id++;
+    o->inside = 0;
+    pool->active[pool->nactive++] = s;
+    return o;
+}
+
+/**
+ * @brief Scroll every active barrier, free the ones past BARRIER_Y_RESET and spawn new ones.
+ * Does not touch the display; barriers that are gone are erased by the next obstacles_draw().
+ * @param pool The pool.
+ * @return void
+ */
+void obstacles_step(ObstaclePool *pool)
+{
+    int kept = 0;
+    for (int i = 0; i < pool->nactive; i++)
+    {
+        int s = pool->active[i];
+        Obstacle *o = &pool->slot[s];
+        o->prev_y = o->y;
+        o->y -= o->v;
+        if (FIX_INT(o->y) < BARRIER_Y_RESET)
+            pool->free[pool->nfree++] = s;
+        else
+            pool->active[kept++] = s;
+    }
+    pool->nactive = kept;
+
+    // start the next barrier once the newest one is far enough along
+    if (pool->nactive == 0 || pool->slot[pool->active[pool->nactive - 1]].y <= FIX(BARRIER_Y0 - pool->spacing))
+        obstacle_spawn(pool, FIX(BARRIER_Y0), FIX(BARRIER_V0), rand() % GAP_RANGE);
+}
+
+/**
+ * @brief Check the bird against the active barriers.
+ * @param pool The pool.
+ * @param x The bird's x position.
+ * @param y The bird's y position.
+ * @param passed Set to the number of barriers the bird has just finished crossing.
+ * @return 1 if the bird is inside a barrier and outside its gap, otherwise 0.
+ */
+int obstacles_collide(ObstaclePool *pool, int x, int y, int *passed)
+{
+    *passed = 0;
+    for (int i = 0; i < pool->nactive; i++)
+    {
+        Obstacle *o = &pool->slot[pool->active[i]];
+        int oy = FIX_INT(o->y);
+        if (y > oy - (BARRIER_HEIGHT >> 1) && y < oy + (BARRIER_HEIGHT >> 1))
+        {
+            o->inside = 1;
+            if (x < o->gap || x > o->gap + GAP_WIDTH) // bird outside of gap (either below or above)
+                return 1;
+        }
+        else
+        {
+            if (o->inside)
+                (*passed)++;
+            o->inside = 0;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Copy the part of a barrier row between two display columns that is also inside [x, x + n).
+ * @param row The barrier row.
+ * @param from The first display column.
+ * @param to One past the last display column.
+ * @param x The display column of out[0].
+ * @param n The number of pixels in out.
+ * @param out The row being composed.
+ * @return void
+ */
+static void copy_barrier(int row, int from, int to, int x, int n, unsigned short *out)
+{
+    if (from < x)
+        from = x;
+    if (to > x + n)
+        to = x + n;
+    if (from < to)
+        asset_row(&barrier, from - BARRIER_LEFT, row, to - from, &out[from - x]);
+}
+
+/**
+ * @brief Draw the part of a barrier that covers display row y into a row being composed.
+ * @param b The barrier, where it is on the display.
+ * @param x The display column of out[0].
+ * @param y The display row.
+ * @param n The number of pixels in out.
+ * @param out The row being composed.
+ * @return void
+ */
+static void barrier_row(const Band *b, int x, int y, int n, unsigned short *out)
+{
+    int row = y - (b->y - (BARRIER_HEIGHT >> 1));
+    if (row < 0 || row >= BARRIER_HEIGHT)
+        return;
+
+    // the gap is open between band columns gap and gap + GAP_WIDTH, exclusive
+    int left = BARRIER_LEFT;
+    int right = BARRIER_LEFT + BARRIER_WIDTH;
+    copy_barrier(row, left, BAND_X0 + b->gap + 1 < right ? BAND_X0 + b->gap + 1 : right, x, n, out);
+    copy_barrier(row, BAND_X0 + b->gap + GAP_WIDTH > left ? BAND_X0 + b->gap + GAP_WIDTH : left, right, x, n, out);
+}
+
+/**
+ * @brief Draw every drawn barrier's part of a display row over the background already in it.
+ * Together they are the row as the barriers last left it, which sprites drawn over them use as their background.
+ * @param screen What the display shows.
+ * @param x The first column.
+ * @param y The row.
+ * @param n The number of pixels.
+ * @param out The row, holding the background.
+ * @return void
+ */
+void obstacles_overlay(const ObstacleScreen *screen, int x, int y, int n, unsigned short *out)
+{
+    for (int i = 0; i < screen->count; i++)
+        barrier_row(&screen->band[i], x, y, n, out);
+}
+
+/* asset_compose() overlay: one barrier's part of the row */
+static void band_overlay(void *ctx, int x, int y, Picture *line)
+{
+    barrier_row(ctx, x, y, line->width, line->pix2);
+}
+
+/**
+ * @brief Redraw display rows [top, bottom) of a band.
+ * @param backdrop What the barrier is drawn over.
+ * @param b The barrier, or 0 to erase.
+ * @param top The first row.
+ * @param bottom One past the last row.
+ * @return void
+ */
+static void draw_band(const Asset *backdrop, const Band *b, int top, int bottom)
+{
+    if (top < 0)
+        top = 0;
+    if (bottom > 320)
+        bottom = 320;
+    asset_compose(BAND_X0, top, BAND_WIDTH, bottom - top, backdrop, BAND_X0, top,
+                  b ? band_overlay : 0, (void *)b);
+}
+
+/**
+ * @brief Copy out what the renderer needs of the active barriers.
+ * @param pool The pool.
+ * @param view Where to put it.
+ * @return void
+ */
+void obstacles_view(const ObstaclePool *pool, ObstacleView *view)
+{
+    for (int i = 0; i < pool->nactive; i++)
+    {
+        const Obstacle *o = &pool->slot[pool->active[i]];
+        BarrierView *b = &view->barrier[i];
+        b->y = o->y;
+        b->prev_y = o->prev_y;
+        b->gap = o->gap;
+        b->id = o->id;
+    }
+    view->count = pool->nactive;
+}
+
+/**
+ * @brief Forget every barrier on the display, after the background has been drawn over them.
+ * @param screen What the display shows.
+ * @param backdrop The background that was drawn, for the barriers to be drawn over.
+ * @return void
+ */
+void obstacles_clear_screen(ObstacleScreen *screen, const Asset *backdrop)
+{
+    screen->count = 0;
+    screen->backdrop = backdrop;
+}
+
+/**
+ * @brief Bring the display up to date: erase barriers that are gone, then redraw the rows each active one moved over.
+ * @param screen What the display shows, updated.
+ * @param view The active barriers.
+ * @param alpha The elapsed fraction of the current step, from 0 to FIX_ONE.
+ * @return void
+ */
+void obstacles_draw(ObstacleScreen *screen, const ObstacleView *view, fix alpha)
+{
+    // a barrier is on the display once at most, so match by id; there are only a handful
+    const Band *old[OBSTACLE_MAX] = {0};
+    for (int i = 0; i < screen->count; i++)
+    {
+        const Band *d = &screen->band[i];
+        int j = 0;
+        while (j < view->count && view->barrier[j].id != d->id)
+            j++;
+        if (j < view->count)
+            old[j] = d;
+        else
+            draw_band(screen->backdrop, 0, d->y - (BARRIER_HEIGHT >> 1), d->y + (BARRIER_HEIGHT >> 1));
+    }
+
+    Band drawn[OBSTACLE_MAX];
+    for (int i = 0; i < view->count; i++)
+    {
+        const BarrierView *b = &view->barrier[i];
+        Band *d = &drawn[i];
+        d->y = FIX_ROUND(fix_lerp(b->prev_y, b->y, alpha));
+        d->gap = b->gap;
+        d->id = b->id;
+        int top = d->y - (BARRIER_HEIGHT >> 1);
+        int bottom = d->y + (BARRIER_HEIGHT >> 1);
+        if (old[i])
+        {
+            if (old[i]->y == d->y)
+                continue;
+            // include the rows it has just uncovered
+            if (old[i]->y - (BARRIER_HEIGHT >> 1) < top)
+                top = old[i]->y - (BARRIER_HEIGHT >> 1);
+            if (old[i]->y + (BARRIER_HEIGHT >> 1) > bottom)
+                bottom = old[i]->y + (BARRIER_HEIGHT >> 1);
+        }
+        draw_band(screen->backdrop, d, top, bottom);
+    }
+
+    for (int i = 0; i < view->count; i++)
+        screen->band[i] = drawn[i];
+    screen->count = view->count;
+}
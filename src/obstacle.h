@@ -0,0 +1,105 @@
+#ifndef OBSTACLE_H
+#define OBSTACLE_H
+
+#include "physics.h"
+#include "picture.h"
+
+/*
+ * Barriers. Every barrier on screen lives in a fixed pool of OBSTACLE_MAX
+ * slots; nothing is allocated at run time. The active set is kept oldest
+ * first, and a spawn scheduler starts a new barrier at BARRIER_Y0 once the
+ * newest one has scrolled `spacing` rows away from it. A barrier that
+ * passes BARRIER_Y_RESET is erased and its slot recycled.
+ *
+ * Barriers are not kept as pictures. Each frame, a barrier redraws only the
+ * band it covers now plus the rows it uncovered, composing one row at a
+ * time from the background and barrier assets, so the RAM used is a single
+ * line buffer and the SPI traffic per barrier does not depend on how many
+ * there are. Positions are fixed point and drawn interpolated between
+ * steps (see physics.h). Bands must not overlap: spacing has to be at least
+ * BARRIER_HEIGHT plus the fastest barrier's velocity.
+ *
+ * The pool belongs to the physics step. The renderer works from an
+ * ObstacleView copied out of it, and keeps what it has drawn in its own
+ * ObstacleScreen, so neither side writes anything the other one reads.
+ * Barriers are matched between the two by id, since a slot can be reused
+ * before the renderer has seen its old barrier go.
+ */
+
+#define OBSTACLE_MAX 8 // pool capacity
+
+#define GAP_WIDTH 80                 // gap width
+#define GAP_RANGE 140                // gap range
+#define BARRIER_WIDTH 220            // barrier width
+#define BARRIER_HEIGHT 20            // barrier height
+#define BARRIER_V0 2                 // barrier initial velocity
+#define BARRIER_Y0 (320 - (30 / 2))  // barrier initial y position
+#define BARRIER_X0 (240 - (230 / 2)) // barrier initial x position
+#define BARRIER_Y_RESET 100          // barrier min y position before it is recycled
+#define BARRIER_SPACING 104          // rows between barriers (two on screen)
+
+typedef struct
+{
+    fix y;                // center row
+    fix prev_y;           // center row before the last step
+    fix v;                // rows scrolled per step, toward y = 0
+    int gap;              // start of the gap
+    unsigned short id;    // tells apart the barriers that use a slot in turn
+    unsigned char inside; // the bird is between its edges
+} Obstacle;
+
+typedef struct
+{
+    Obstacle slot[OBSTACLE_MAX];
+    unsigned char active[OBSTACLE_MAX]; // slot numbers, oldest first
+    unsigned char free[OBSTACLE_MAX];   // stack of unused slot numbers
+    unsigned char nactive;
+    unsigned char nfree;
+    unsigned char capacity; // at most OBSTACLE_MAX
+    unsigned short next_id;
+    int spacing;
+} ObstaclePool;
+
+/* A barrier as the renderer needs it */
+typedef struct
+{
+    fix y;
+    fix prev_y;
+    short gap;
+    unsigned short id;
+} BarrierView;
+
+/* The active barriers, oldest first */
+typedef struct
+{
+    BarrierView barrier[OBSTACLE_MAX];
+    unsigned char count;
+} ObstacleView;
+
+/* A barrier on the display */
+typedef struct
+{
+    short y; // center row
+    short gap;
+    unsigned short id;
+} Band;
+
+/* What the display shows, oldest first */
+typedef struct
+{
+    Band band[OBSTACLE_MAX];
+    unsigned char count;
+    const Asset *backdrop; // what the barriers are drawn over
+} ObstacleScreen;
+
+/* Function Prototypes */
+void obstacles_reset(ObstaclePool *pool, int capacity, int spacing);
+Obstacle *obstacle_spawn(ObstaclePool *pool, fix y, fix v, int gap);
+void obstacles_step(ObstaclePool *pool);
+int obstacles_collide(ObstaclePool *pool, int x, int y, int *passed);
+void obstacles_view(const ObstaclePool *pool, ObstacleView *view);
+void obstacles_clear_screen(ObstacleScreen *screen, const Asset *backdrop);
+void obstacles_draw(ObstacleScreen *screen, const ObstacleView *view, fix alpha);
+void obstacles_overlay(const ObstacleScreen *screen, int x, int y, int n, unsigned short *out);
+
+#endif /* OBSTACLE_H */
@@ -0,0 +1,68 @@
+/**
+ * @file physics.c
+ * @brief Q16.16 fixed-step motion with interpolation for rendering. See physics.h.
+ */
+
+#include "physics.h"
+
+/**
+ * @brief Multiply two Q16.16 numbers.
+ * @param a The first factor.
+ * @param b The second factor.
+ * @return a * b, rounded toward minus infinity.
+ */
+fix fix_mul(fix a, fix b)
+{
+    return (fix)(((int64_t)a * b) >> FIX_SHIFT);
+}
+
+/**
+ * @brief Interpolate between two Q16.16 values.
+ * @param from The value at alpha = 0.
+ * @param to The value at alpha = FIX_ONE.
+ * @param alpha How far along, from 0 to FIX_ONE.
+ * @return from + (to - from) * alpha.
+ */
+fix fix_lerp(fix from, fix to, fix alpha)
+{
+    return from + fix_mul(to - from, alpha);
+}
+
+/**
+ * @brief Place a body, at rest between steps.
+ * @param b The body.
+ * @param pos Its position.
+ * @param vel Its velocity.
+ * @return void
+ */
+void body_reset(Body *b, fix pos, fix vel)
+{
+    b->pos = pos;
+    b->prev = pos;
+    b->vel = vel;
+}
+
+/**
+ * @brief Advance a body by one step (semi-implicit Euler: velocity first, then position).
+ * After n steps from rest at p0 with velocity v0, pos is p0 + n*v0 + acc*n*(n+1)/2 exactly.
+ * @param b The body.
+ * @param acc Its acceleration during the step.
+ * @return void
+ */
+void body_step(Body *b, fix acc)
+{
+    b->prev = b->pos;
+    b->vel += acc;
+    b->pos += b->vel;
+}
+
+/**
+ * @brief Where to draw a body part way through the current step.
+ * @param b The body.
+ * @param alpha The elapsed fraction of the step, from 0 to FIX_ONE.
+ * @return The position between the last two steps.
+ */
+fix body_lerp(const Body *b, fix alpha)
+{
+    return fix_lerp(b->prev, b->pos, alpha);
+}
@@ -0,0 +1,44 @@
+#ifndef PHYSICS_H
+#define PHYSICS_H
+
+#include <stdint.h>
+
+/*
+ * Fixed-point motion. Positions, velocities and accelerations are Q16.16
+ * pixels, pixels per step and pixels per step squared, so sub-pixel speeds
+ * accumulate exactly and nothing needs floating point or a divide.
+ *
+ * The game state advances in fixed steps of 1/PHYS_HZ seconds (TIM16)
+ * regardless of how long a frame takes to draw. Each body keeps its
+ * position before the last step, and the renderer draws it at
+ * body_lerp(b, alpha), where alpha is the fraction of the current step
+ * that has elapsed. Motion is then as smooth as the frame rate allows, and
+ * the game runs at the same speed at any frame rate.
+ */
+
+#define PHYS_HZ 64 // simulation steps per second
+
+typedef int32_t fix; // Q16.16
+
+#define FIX_SHIFT 16
+#define FIX_ONE ((fix)1 << FIX_SHIFT)
+#define FIX(n) ((fix)(n) * FIX_ONE)                               // from a whole number
+#define FIX_FRAC(num, den) ((fix)(num) * FIX_ONE / (den))         // num/den, for constants
+#define FIX_INT(f) ((int)((f) >> FIX_SHIFT))                      // rounded down to a whole number
+#define FIX_ROUND(f) ((int)(((f) + (FIX_ONE >> 1)) >> FIX_SHIFT)) // rounded to the nearest
+
+typedef struct
+{
+    fix pos;  // after the last step
+    fix prev; // before the last step
+    fix vel;
+} Body;
+
+/* Function Prototypes */
+fix fix_mul(fix a, fix b);
+fix fix_lerp(fix from, fix to, fix alpha);
+void body_reset(Body *b, fix pos, fix vel);
+void body_step(Body *b, fix acc);
+fix body_lerp(const Body *b, fix alpha);
+
+#endif /* PHYSICS_H */
@@ -0,0 +1,416 @@
+/**
+ * @file picture.c
+ * @brief Software compositing of Picture and IndexedPicture images in RAM.
+ */
+
+#include "picture.h"
+#include "m2m.h"
+#include "ramfunc.h"
+#include "arena.h"
+
+/**
+ * @brief Copy a subset of a large source picture into a smaller destination.
+ * @param dst The destination picture.
+ * @param src The source picture.
+ * @param sx The x offset into the source picture.
+ * @param sy The y offset into the source picture.
+ * @return void
+ */
+RAMFUNC void pic_subset(Picture *dst, const Picture *src, int sx, int sy)
+{
+    int dw = dst->width;
+    int dh = dst->height;
+    for (int y = 0; y < dh; y++)
+    {
+        if (y + sy < 0)
+            continue;
+        if (y + sy >= src->height)
+            break;
+        for (int x = 0; x < dw; x++)
+        {
+            if (x + sx < 0)
+                continue;
+            if (x + sx >= src->width)
+                break;
+            dst->pix2[dw * y + x] = src->pix2[src->width * (y + sy) + x + sx];
+        }
+    }
+}
+
+/**
+ * @brief Overlay a picture onto a destination picture.
+ * @param dst The destination picture.
+ * @param xoffset The x offset into the destination picture.
+ * @param yoffset The y offset into the destination picture.
+ * @param src The source picture.
+ * @param transparent The color in the source picture that will not be copied.
+ * @return void
+ */
+RAMFUNC void pic_overlay(Picture *dst, int xoffset, int yoffset, const Picture *src, int transparent)
+{
+    for (int y = 0; y < src->height; y++)
+    {
+        int dy = y + yoffset;
+        if (dy < 0)
+            continue;
+        if (dy >= dst->height)
+            break;
+        for (int x = 0; x < src->width; x++)
+        {
+            int dx = x + xoffset;
+            if (dx < 0)
+                continue;
+            if (dx >= dst->width)
+                break;
+            unsigned short int p = src->pix2[y * src->width + x];
+            if (p != transparent)
+                dst->pix2[dy * dst->width + dx] = p;
+        }
+    }
+}
+
+/* Pixel index at column x of a packed row, most significant bits first. */
+RAMFUNC static inline unsigned int index_at(const unsigned char *row, unsigned int x, unsigned int bpp)
+{
+    if (bpp == 8)
+        return row[x];
+    unsigned int bit = x * bpp;
+    return (row[bit >> 3] >> (8 - bpp - (bit & 7))) & ((1u << bpp) - 1);
+}
+
+/**
+ * @brief Overlay an indexed picture onto a destination picture, expanding it through a palette.
+ * @param dst The destination picture.
+ * @param xoffset The x offset into the destination picture.
+ * @param yoffset The y offset into the destination picture.
+ * @param src The indexed source picture. Pixels with index 0 are not copied.
+ * @param palette The palette to expand through, or 0 for the picture's own. Passing another palette recolors the sprite (e.g. a damage flash) at no extra cost.
+ * @return void
+ */
+RAMFUNC void pic_overlay_indexed(Picture *dst, int xoffset, int yoffset, const IndexedPicture *src, const unsigned short *palette)
+{
+    unsigned int bpp = src->bits_per_pixel;
+    unsigned int stride = INDEXED_STRIDE(src->width, bpp);
+    if (!palette)
+        palette = src->palette;
+    for (int y = 0; y < src->height; y++)
+    {
+        int dy = y + yoffset;
+        if (dy < 0)
+            continue;
+        if (dy >= dst->height)
+            break;
+        const unsigned char *row = &src->index_data[y * stride];
+        unsigned short *out = &dst->pix2[dy * dst->width];
+        for (int x = 0; x < src->width; x++)
+        {
+            int dx = x + xoffset;
+            if (dx < 0)
+                continue;
+            if (dx >= dst->width)
+                break;
+            unsigned int i = index_at(row, x, bpp);
+            if (i != 0)
+                out[dx] = palette[i];
+        }
+    }
+}
+
+/**
+ * @brief Copy an indexed picture into a destination picture, expanding it through a palette.
+ * @param dst The destination picture.
+ * @param xoffset The x offset into the destination picture.
+ * @param yoffset The y offset into the destination picture.
+ * @param src The indexed source picture.
+ * @param palette The palette to expand through, or 0 for the picture's own.
+ * @param transparent The color written for index 0, e.g. the key color a later pic_overlay skips.
+ * @return void
+ */
+RAMFUNC void pic_blit_indexed(Picture *dst, int xoffset, int yoffset, const IndexedPicture *src, const unsigned short *palette, int transparent)
+{
+    unsigned int bpp = src->bits_per_pixel;
+    unsigned int stride = INDEXED_STRIDE(src->width, bpp);
+    if (!palette)
+        palette = src->palette;
+    for (int y = 0; y < src->height; y++)
+    {
+        int dy = y + yoffset;
+        if (dy < 0)
+            continue;
+        if (dy >= dst->height)
+            break;
+        const unsigned char *row = &src->index_data[y * stride];
+        unsigned short *out = &dst->pix2[dy * dst->width];
+        for (int x = 0; x < src->width; x++)
+        {
+            int dx = x + xoffset;
+            if (dx < 0)
+                continue;
+            if (dx >= dst->width)
+                break;
+            unsigned int i = index_at(row, x, bpp);
+            out[dx] = i ? palette[i] : transparent;
+        }
+    }
+}
+
+/* Decode pixels [x, x+n) of row y of a run-length encoded asset. */
+RAMFUNC static void rle_row(const Asset *src, int x, int y, int n, unsigned short *out)
+{
+    const unsigned short *run = &src->pixels[2 * ((const unsigned short *)src->index)[y]];
+    int pos = 0;
+    // skip the runs that end before x
+    while (pos + run[0] <= x)
+    {
+        pos += run[0];
+        run += 2;
+    }
+    int left = pos + run[0] - x; // of the current run
+    for (;;)
+    {
+        int k = left < n ? left : n;
+        for (int i = 0; i < k; i++)
+            *out++ = run[1];
+        n -= k;
+        if (n <= 0)
+            break;
+        run += 2;
+        left = run[0];
+    }
+}
+
+/* Decode pixels [x, x+n) of row y of a tiled asset, a tile row at a time. */
+RAMFUNC static void tiled_row(const Asset *src, int x, int y, int n, unsigned short *out)
+{
+    unsigned int shift = src->param;
+    unsigned int edge = 1u << shift;
+    unsigned int tiles_across = src->width >> shift;
+    const unsigned char *map = &((const unsigned char *)src->index)[(y >> shift) * tiles_across];
+    unsigned int ty = y & (edge - 1);
+    while (n > 0)
+    {
+        unsigned int tx = x & (edge - 1);
+        int k = edge - tx < n ? edge - tx : n;
+        const unsigned short *p = &src->pixels[(map[x >> shift] << (2 * shift)) + (ty << shift) + tx];
+        for (int i = 0; i < k; i++)
+            *out++ = p[i];
+        x += k;
+        n -= k;
+    }
+}
+
+/**
+ * @brief Decode part of one row of an asset to RGB565.
+ * @param src The asset.
+ * @param x The first column, which must be inside the asset.
+ * @param y The row, which must be inside the asset.
+ * @param n How many pixels to decode; x + n must not pass the right edge.
+ * @param out Where to put them. Transparent pixels come out as the key color, or palette[0] when indexed.
+ * @return void
+ */
+RAMFUNC void asset_row(const Asset *src, int x, int y, int n, unsigned short *out)
+{
+    switch (src->format)
+    {
+    case ASSET_RAW:
+    {
+        const unsigned short *p = &src->pixels[y * src->width + x];
+        for (int i = 0; i < n; i++)
+            out[i] = p[i];
+        break;
+    }
+    case ASSET_RLE:
+        rle_row(src, x, y, n, out);
+        break;
+    case ASSET_TILED:
+        tiled_row(src, x, y, n, out);
+        break;
+    case ASSET_INDEXED:
+    {
+        const unsigned char *row = &((const unsigned char *)src->index)[y * INDEXED_STRIDE(src->width, src->param)];
+        for (int i = 0; i < n; i++)
+            out[i] = src->pixels[index_at(row, x + i, src->param)];
+        break;
+    }
+    case ASSET_STREAM:
+    {
+        const AssetStream *s = src->index;
+        uint32_t offset = s->base + 2 * ((uint32_t)y * src->width + x);
+        if (s->read(s->source, offset, 2 * n, out) != 2 * n)
+            for (int i = 0; i < n; i++)
+                out[i] = 0; // black where it could not be read
+        break;
+    }
+    }
+}
+
+/**
+ * @brief Copy a subset of a large asset into a smaller destination, like pic_subset.
+ * @param dst The destination picture.
+ * @param src The source asset.
+ * @param sx The x offset into the source asset.
+ * @param sy The y offset into the source asset.
+ * @return void
+ */
+void asset_subset(Picture *dst, const Asset *src, int sx, int sy)
+{
+    int dw = dst->width;
+    int dh = dst->height;
+    int x0 = sx < 0 ? -sx : 0;
+    int x1 = sx + dw > src->width ? src->width - sx : dw;
+    if (x0 >= x1)
+        return;
+    for (int y = 0; y < dh; y++)
+    {
+        if (y + sy < 0)
+            continue;
+        if (y + sy >= src->height)
+            break;
+        asset_row(src, x0 + sx, y + sy, x1 - x0, &dst->pix2[dw * y + x0]);
+    }
+}
+
+/**
+ * @brief Overlay an asset onto a destination picture, skipping its transparent pixels.
+ * @param dst The destination picture.
+ * @param xoffset The x offset into the destination picture.
+ * @param yoffset The y offset into the destination picture.
+ * @param src The source asset.
+ * @param palette For an indexed asset, a palette to use instead of its own (or 0).
+ * @return void
+ */
+void asset_overlay(Picture *dst, int xoffset, int yoffset, const Asset *src, const unsigned short *palette)
+{
+    if (src->format == ASSET_INDEXED)
+    {
+        IndexedPicture view = {src->width, src->height, src->param, src->pixels, src->index};
+        pic_overlay_indexed(dst, xoffset, yoffset, &view, palette);
+        return;
+    }
+
+    int dw = dst->width;
+    int dh = dst->height;
+    unsigned short chunk[32];
+    for (int y = 0; y < src->height; y++)
+    {
+        int dy = y + yoffset;
+        if (dy < 0)
+            continue;
+        if (dy >= dh)
+            break;
+        int x0 = 0, x1 = src->width - 1;
+        if (src->spans)
+        {
+            x0 = src->spans[2 * y];
+            x1 = src->spans[2 * y + 1];
+        }
+        if (x0 < -xoffset)
+            x0 = -xoffset;
+        if (x1 >= dw - xoffset)
+            x1 = dw - xoffset - 1;
+        unsigned short *out = &dst->pix2[dy * dw + xoffset];
+        for (int x = x0; x <= x1; x += 32)
+        {
+            int n = x1 - x + 1 < 32 ? x1 - x + 1 : 32;
+            asset_row(src, x, y, n, chunk);
+            for (int i = 0; i < n; i++)
+                if (chunk[i] != src->key)
+                    out[x + i] = chunk[i];
+        }
+    }
+}
+
+/* Start fetching part of a row of an asset. A raw row is one run in memory, so DMA copies it;
+   anything else is decoded now. Returns non-zero if m2m_wait() is needed before it is read. */
+static int fetch_row(const Asset *src, int x, int y, int n, unsigned short *out)
+{
+    if (src->format == ASSET_RAW)
+    {
+        m2m_copy(out, &src->pixels[y * src->width + x], n);
+        return 1;
+    }
+    asset_row(src, x, y, n, out);
+    return 0;
+}
+
+/**
+ * @brief Draw a rectangle of the display a row at a time, each row an asset's pixels with an overlay on top.
+ * Three rows are in hand at once: while the CPU runs the overlay on one, the next one's asset pixels are
+ * fetched (by DMA if the asset is raw) and the previous one goes out to the display by DMA. The rows come
+ * from frame_arena; if it cannot hold them, nothing is drawn.
+ * @param x The first display column.
+ * @param y The first display row.
+ * @param n The width.
+ * @param rows The height.
+ * @param bg The asset under everything.
+ * @param sx The asset column at display column x.
+ * @param sy The asset row at display row y.
+ * @param overlay Called for each row after its asset pixels are in, with ctx, the row's display position and the row as a one row Picture; or 0.
+ * @param ctx Passed to overlay.
+ * @return void
+ */
+void asset_compose(u16 x, u16 y, int n, int rows, const Asset *bg, int sx, int sy,
+                   void (*overlay)(void *ctx, int x, int y, Picture *line), void *ctx)
+{
+    if (rows <= 0 || n <= 0)
+        return;
+    uint32_t mark = arena_mark(&frame_arena);
+    Picture *line[3];
+    for (int i = 0; i < 3; i++)
+    {
+        line[i] = arena_picture(&frame_arena, n, 1);
+        if (!line[i])
+        {
+            arena_release(&frame_arena, mark);
+            return;
+        }
+    }
+
+    int dma = fetch_row(bg, sx, sy, n, line[0]->pix2);
+    for (int r = 0; r < rows; r++)
+    {
+        Picture *cur = line[r % 3];
+        if (dma)
+            m2m_wait();
+        // the buffer two rows back was sent before the previous row started going out
+        if (r + 1 < rows)
+            dma = fetch_row(bg, sx, sy + r + 1, n, line[(r + 1) % 3]->pix2);
+        if (overlay)
+            overlay(ctx, x, y + r, cur);
+        LCD_DrawPictureAsync(x, y + r, cur);
+    }
+    LCD_Flush();
+    arena_release(&frame_arena, mark);
+}
+
+/**
+ * @brief Draw an asset on the display with its upper left corner at (x0,y0), a row at a time.
+ * @param x0 The x position.
+ * @param y0 The y position.
+ * @param src The asset, which must fit on the display.
+ * @return void
+ */
+void asset_draw(u16 x0, u16 y0, const Asset *src)
+{
+    asset_compose(x0, y0, src->width, src->height, src, 0, 0, 0, 0);
+}
+
+/**
+ * @brief Test whether a pixel of an asset is solid, using its collision mask if it has one.
+ * @param src The asset.
+ * @param x The column.
+ * @param y The row.
+ * @return Non-zero if (x,y) is inside the asset and not transparent.
+ */
+int asset_hit(const Asset *src, int x, int y)
+{
+    if (x < 0 || y < 0 || x >= src->width || y >= src->height)
+        return 0;
+    if (src->mask)
+        return index_at(&src->mask[y * INDEXED_STRIDE(src->width, 1)], x, 1);
+    if (src->format == ASSET_INDEXED)
+        return index_at(&((const unsigned char *)src->index)[y * INDEXED_STRIDE(src->width, src->param)], x, src->param) != 0;
+    unsigned short p;
+    asset_row(src, x, y, 1, &p);
+    return p != src->key;
+}
@@ -0,0 +1,88 @@
+#ifndef PICTURE_H
+#define PICTURE_H
+
+#include <stdint.h>
+#include "lcd.h"
+
+/*
+ * Palette-indexed sprite. Each pixel is a 2, 4 or 8 bit index into an
+ * RGB565 palette of 1 << bits_per_pixel entries, and index 0 is always
+ * transparent. Rows are packed most significant bits first (the first
+ * pixel of a byte is in its top bits) and padded to a whole byte.
+ * utils/indexed.py generates these from RGB565 Picture sources.
+ */
+typedef struct
+{
+    unsigned int width;
+    unsigned int height;
+    unsigned int bits_per_pixel;   // 2, 4 or 8
+    const unsigned short *palette; // RGB565, palette[0] is unused (transparent)
+    const unsigned char *index_data;
+} IndexedPicture;
+
+/* Bytes in one packed row of an indexed picture */
+#define INDEXED_STRIDE(width, bpp) (((width) * (bpp) + 7) / 8)
+
+/*
+ * Image compiled from assets/ by utils/assetc.py, in whichever storage
+ * format came out smallest. The generated src/assets.h declares them.
+ *
+ *   ASSET_RAW      pixels: width*height RGB565 values.
+ *   ASSET_RLE      pixels: (count, color) pairs; index: height+1 unsigned
+ *                  shorts, the offset in pairs of each row's first run.
+ *   ASSET_TILED    pixels: the distinct tiles, each (1<<param)^2 RGB565
+ *                  values; index: one unsigned char tile number per tile,
+ *                  row by row. Width and height are multiples of the tile.
+ *   ASSET_INDEXED  pixels: the palette; index: packed rows exactly as in
+ *                  IndexedPicture, with param bits per pixel.
+ *   ASSET_STREAM   index: an AssetStream that reads RGB565 rows, stored as
+ *                  in ASSET_RAW, from somewhere else (see store.h). Not
+ *                  made by assetc.py.
+ *
+ * Pixels of the key color (or index 0 when indexed) are transparent when
+ * the asset is overlaid. spans and mask are optional derived data: the
+ * first and last non-transparent column of each row (last < first for an
+ * empty row), and a one bit per pixel collision mask packed like a 1 bpp
+ * IndexedPicture.
+ */
+#define ASSET_RAW 0
+#define ASSET_RLE 1
+#define ASSET_TILED 2
+#define ASSET_INDEXED 3
+#define ASSET_STREAM 4
+
+typedef struct
+{
+    unsigned short width;
+    unsigned short height;
+    unsigned char format;          // ASSET_*
+    unsigned char param;           // log2 of the tile edge (TILED) or bits per pixel (INDEXED)
+    int key;                       // transparent color, or -1 for none
+    const unsigned short *pixels;
+    const void *index;
+    const unsigned short *spans;   // 2 per row, or 0
+    const unsigned char *mask;     // or 0
+} Asset;
+
+/* Where an ASSET_STREAM asset's pixels come from */
+typedef struct
+{
+    int32_t (*read)(void *source, uint32_t offset, uint32_t n, void *out); // bytes read, or negative
+    void *source;
+    uint32_t base; // offset of the first pixel
+} AssetStream;
+
+/* Function Prototypes */
+void pic_subset(Picture *dst, const Picture *src, int sx, int sy);
+void pic_overlay(Picture *dst, int xoffset, int yoffset, const Picture *src, int transparent);
+void pic_overlay_indexed(Picture *dst, int xoffset, int yoffset, const IndexedPicture *src, const unsigned short *palette);
+void pic_blit_indexed(Picture *dst, int xoffset, int yoffset, const IndexedPicture *src, const unsigned short *palette, int transparent);
+void asset_row(const Asset *src, int x, int y, int n, unsigned short *out);
+void asset_subset(Picture *dst, const Asset *src, int sx, int sy);
+void asset_overlay(Picture *dst, int xoffset, int yoffset, const Asset *src, const unsigned short *palette);
+void asset_compose(u16 x, u16 y, int n, int rows, const Asset *bg, int sx, int sy,
+                   void (*overlay)(void *ctx, int x, int y, Picture *line), void *ctx);
+void asset_draw(u16 x0, u16 y0, const Asset *src);
+int asset_hit(const Asset *src, int x, int y);
+
+#endif /* PICTURE_H */
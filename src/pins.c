@@ -0,0 +1,47 @@
+/**
+ * @file pins.c
+ * @brief GPIO pin ownership. See pins.h.
+ */
+
+#include <string.h>
+#include "pins.h"
+
+PinConflict pin_conflict;
+
+static const char *owners[PIN_PORTS * 16];
+
+/**
+ * @brief Claim a pin before setting it up.
+ * @param pin The pin, PIN(port, n).
+ * @param owner Who is claiming it, a name that lasts.
+ * @return PIN_OK if it was free or already the owner's, or PIN_ERROR if it belongs to someone else,
+ * which is recorded in pin_conflict (the first such, if several).
+ */
+int8_t pin_claim(uint8_t pin, const char *owner)
+{
+    if (PIN_PORT(pin) >= PIN_PORTS)
+        return PIN_ERROR;
+    const char *had = owners[pin];
+    if (had == 0 || strcmp(had, owner) == 0)
+    {
+        owners[pin] = owner;
+        return PIN_OK;
+    }
+    if (pin_conflict.claimant == 0)
+    {
+        pin_conflict.pin = pin;
+        pin_conflict.owner = had;
+        pin_conflict.claimant = owner;
+    }
+    return PIN_ERROR;
+}
+
+/**
+ * @brief Who owns a pin.
+ * @param pin The pin, PIN(port, n).
+ * @return The owner's name, or 0 if the pin has not been claimed.
+ */
+const char *pin_owner(uint8_t pin)
+{
+    return PIN_PORT(pin) < PIN_PORTS ? owners[pin] : 0;
+}
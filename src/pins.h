@@ -0,0 +1,42 @@
+#ifndef PINS_H
+#define PINS_H
+
+#include <stdint.h>
+
+/*
+ * Who owns each GPIO pin. Every init that sets up a pin claims it first,
+ * naming itself, so two pieces of code driving the same pin (as the
+ * button setup once did to the SD card's chip select on PB2) are caught
+ * when the second one starts, not later as a card that sometimes does not
+ * answer. Claiming a pin again under the same name is fine, so inits may
+ * run more than once.
+ *
+ * A refused claim is kept in pin_conflict, where a debugger shows both
+ * names; main() stops on it once everything is set up.
+ */
+
+#define PIN_PORTS 3 // A to C
+
+/* A pin as one byte: PIN('B', 2) is PB2 */
+#define PIN(port, n) ((uint8_t)(((port) - 'A') << 4 | (n)))
+#define PIN_PORT(pin) ((pin) >> 4)
+#define PIN_NUM(pin) ((pin) & 0x0f)
+
+typedef struct
+{
+    uint8_t pin;
+    const char *owner;    // who has it
+    const char *claimant; // who was refused it, or 0 if nobody has been
+} PinConflict;
+
+extern PinConflict pin_conflict;
+
+// Status codes
+#define PIN_OK 0
+#define PIN_ERROR -1
+
+/* Function Prototypes */
+int8_t pin_claim(uint8_t pin, const char *owner);
+const char *pin_owner(uint8_t pin);
+
+#endif /* PINS_H */
@@ -0,0 +1,296 @@
+/**
+ * @file power.c
+ * @brief Sleep-instead-of-spin waits, stop mode on the attract screen, and sleep accounting. See power.h.
+ */
+
+#include "power.h"
+#include "telemetry.h"
+#include "utils.h"
+#include "clock.h"
+
+#if !defined(POWER_HOST)
+#include "stm32f0xx.h"
+#endif
+
+#define RTC_PREDIV_A 99  // LSI (~40 kHz) / 100 = 400 Hz
+#define RTC_PREDIV_S 399 // 400 Hz / 400 = 1 Hz, so the sub-second counter has 2.5 ms steps
+#define DAY_MS 86400000u
+
+static volatile uint32_t ms_ticks;
+static volatile uint8_t button_event;
+static PowerStats total;    // since power_init()
+static PowerStats window;   // since the last TLM_POWER record
+static uint32_t awake_from; // micros() when the core last woke up
+
+#if defined(POWER_HOST)
+
+#define DISABLE_IRQ() power_host_irq(0)
+#define ENABLE_IRQ() power_host_irq(1)
+
+void power_init(void)
+{
+    awake_from = micros();
+}
+
+static void wait_for_interrupt(void)
+{
+    power_host_wfi(0);
+}
+
+static void enter_stop(void)
+{
+    power_host_wfi(1);
+}
+
+static uint32_t rtc_ms(void)
+{
+    return power_host_rtc_us() / 1000 % DAY_MS;
+}
+
+#else
+
+#define DISABLE_IRQ() __disable_irq()
+#define ENABLE_IRQ() __enable_irq()
+
+/**
+ * @brief Start the 1 kHz SysTick, the button wakeup on EXTI0 and the LSI-clocked RTC.
+ * @return void
+ */
+void power_init(void)
+{
+    SysTick_Config(clock_timing()->systick_reload); // 1 ms
+
+    // rising edge on PA0 (the default EXTI0 source) raises EXTI0, which also wakes from stop
+    RCC->APB2ENR |= RCC_APB2ENR_SYSCFGCOMPEN;
+    SYSCFG->EXTICR[0] &= ~SYSCFG_EXTICR1_EXTI0;
+    EXTI->RTSR |= EXTI_RTSR_TR0;
+    EXTI->IMR |= EXTI_IMR_MR0;
+    NVIC_EnableIRQ(EXTI0_1_IRQn);
+
+    // the RTC keeps counting in stop mode, TIM2 does not
+    RCC->APB1ENR |= RCC_APB1ENR_PWREN;
+    PWR->CR |= PWR_CR_DBP;
+    RCC->CSR |= RCC_CSR_LSION;
+    while (!(RCC->CSR & RCC_CSR_LSIRDY))
+        ;
+    RCC->BDCR |= RCC_BDCR_RTCSEL_LSI | RCC_BDCR_RTCEN;
+    RTC->WPR = 0xCA;
+    RTC->WPR = 0x53;
+    RTC->ISR |= RTC_ISR_INIT;
+    while (!(RTC->ISR & RTC_ISR_INITF))
+        ;
+    RTC->PRER = (RTC_PREDIV_A << 16) | RTC_PREDIV_S;
+    RTC->TR = 0;
+    RTC->ISR &= ~RTC_ISR_INIT;
+    RTC->WPR = 0xFF;
+
+    awake_from = micros();
+}
+
+static void wait_for_interrupt(void)
+{
+    __WFI();
+}
+
+/* Stop mode with the regulator in low power. The core wakes on the HSI at 8 MHz. */
+static void enter_stop(void)
+{
+    PWR->CR = (PWR->CR & ~PWR_CR_PDDS) | PWR_CR_LPDS;
+    SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+    __WFI();
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+    clock_resume(); // back to the profile's clock
+}
+
+static uint32_t bcd(uint32_t v)
+{
+    return (v >> 4) * 10 + (v & 0xf);
+}
+
+/* RTC time of day in milliseconds */
+static uint32_t rtc_ms(void)
+{
+    // the shadow registers are stale after stop mode: wait for a fresh copy
+    RTC->WPR = 0xCA;
+    RTC->WPR = 0x53;
+    RTC->ISR &= ~RTC_ISR_RSF;
+    RTC->WPR = 0xFF;
+    while (!(RTC->ISR & RTC_ISR_RSF))
+        ;
+    uint32_t ss = RTC->SSR;
+    uint32_t tr = RTC->TR;
+    (void)RTC->DR; // reading SSR/TR locks the shadow registers until DR is read
+    uint32_t s = bcd(tr & 0x7f) + 60 * bcd((tr >> 8) & 0x7f) + 3600 * bcd((tr >> 16) & 0x3f);
+    return s * 1000 + (RTC_PREDIV_S - ss) * 1000 / (RTC_PREDIV_S + 1);
+}
+
+#endif /* POWER_HOST */
+
+/**
+ * @brief SysTick interrupt: the millisecond count.
+ * @return void
+ */
+void SysTick_Handler(void)
+{
+    ms_ticks++;
+}
+
+/**
+ * @brief EXTI0 interrupt: the button was pressed.
+ * @return void
+ */
+void EXTI0_1_IRQHandler(void)
+{
+#if !defined(POWER_HOST)
+    EXTI->PR = EXTI_PR_PR0;
+#endif
+    button_event = 1;
+}
+
+/**
+ * @brief Milliseconds since power_init().
+ * @return The SysTick count (wraps around).
+ */
+uint32_t millis(void)
+{
+    return ms_ticks;
+}
+
+/**
+ * @brief Take and clear the button event.
+ * @return Non-zero if the button has been pressed since the last call.
+ */
+int power_button_event(void)
+{
+    int e = button_event;
+    button_event = 0;
+    return e;
+}
+
+/* Account time in each state, charged at the current clock profile's currents. */
+static void add_stats(uint32_t awake_us, uint32_t sleep_us, uint32_t stop_us)
+{
+    const ClockProfile *p = &clock_profiles[clock_profile()];
+    uint64_t charge = (uint64_t)awake_us * p->run_ua + (uint64_t)sleep_us * p->sleep_ua +
+                      (uint64_t)stop_us * POWER_STOP_UA;
+    total.awake_us += awake_us;
+    total.sleep_us += sleep_us;
+    total.stop_us += stop_us;
+    total.charge += charge;
+    window.awake_us += awake_us;
+    window.sleep_us += sleep_us;
+    window.stop_us += stop_us;
+    window.charge += charge;
+}
+
+/* Send a TLM_POWER record once the window covers POWER_REPORT_MS. */
+static void report(void)
+{
+    uint64_t us = (uint64_t)window.awake_us + window.sleep_us + window.stop_us;
+    if (us < POWER_REPORT_MS * 1000u)
+        return;
+    telemetry_power((uint32_t)(us / 1000), (uint32_t)(window.sleep_us * 1000ull / us),
+                    (uint32_t)(window.stop_us * 1000ull / us), power_estimate_ua(&window));
+    window.awake_us = window.sleep_us = window.stop_us = 0;
+    window.sleeps = window.stops = 0;
+    window.charge = 0;
+}
+
+/**
+ * @brief Sleep until the next interrupt. The interrupt's handler counts as awake time.
+ * @return void
+ */
+void power_sleep(void)
+{
+    // with interrupts masked, WFI still wakes on a pending one but its handler waits for ENABLE_IRQ
+    DISABLE_IRQ();
+    uint32_t start = micros();
+    wait_for_interrupt();
+    uint32_t end = micros();
+    add_stats(start - awake_from, end - start, 0);
+    total.sleeps++;
+    window.sleeps++;
+    awake_from = end;
+    report(); // still masked: tasks sleep too (delay_ms), and must not preempt the accounting
+    ENABLE_IRQ();
+}
+
+/**
+ * @brief Sleep for at least ms milliseconds.
+ * @param ms How long.
+ * @return void
+ */
+void delay_ms(uint32_t ms)
+{
+    uint32_t start = ms_ticks;
+    // a tick may be about to land, so wait for one more than asked
+    while (ms_ticks - start <= ms)
+        power_sleep();
+}
+
+/**
+ * @brief Stop every clock until the button is pressed (or was, since the last power_button_event()).
+ * SysTick, TIM2 and everything clocked from the PLL halt; the clock profile's clock is restored before returning.
+ * @return void
+ */
+void power_stop(void)
+{
+    uint32_t start = micros();
+    add_stats(start - awake_from, 0, 0);
+    uint32_t from = rtc_ms();
+    // masked, a press between the check and stop stays pending and wakes stop at once
+    DISABLE_IRQ();
+    while (!button_event)
+    {
+        enter_stop();
+        ENABLE_IRQ(); // the wakeup's handler runs here; other wakeups go back to stop
+        DISABLE_IRQ();
+    }
+    ENABLE_IRQ();
+    uint32_t ms = (rtc_ms() + DAY_MS - from) % DAY_MS;
+    add_stats(0, 0, ms * 1000);
+    total.stops++;
+    window.stops++;
+    awake_from = micros();
+    report();
+}
+
+/**
+ * @brief What the title screen should do next, if the button is not pressed.
+ * @param now millis() now.
+ * @param shown millis() when the title screen was last shown.
+ * @param idle_since millis() when the button was last pressed, or the MCU last woke from stop.
+ * @return ATTRACT_STOP once ATTRACT_STOP_MS have been idle, otherwise ATTRACT_DEMO once the title
+ * screen has been up for ATTRACT_DEMO_MS, otherwise ATTRACT_WAIT.
+ */
+attract_t power_attract(uint32_t now, uint32_t shown, uint32_t idle_since)
+{
+    if (now - idle_since >= ATTRACT_STOP_MS)
+        return ATTRACT_STOP;
+    if (now - shown >= ATTRACT_DEMO_MS)
+        return ATTRACT_DEMO;
+    return ATTRACT_WAIT;
+}
+
+/**
+ * @brief Copy the totals since power_init().
+ * @param out Where to put them.
+ * @return void
+ */
+void power_stats(PowerStats *out)
+{
+    *out = total;
+}
+
+/**
+ * @brief Estimate the average supply current over some stats.
+ * @param s The stats.
+ * @return Microamps, or 0 if no time is covered.
+ */
+uint32_t power_estimate_ua(const PowerStats *s)
+{
+    uint64_t us = (uint64_t)s->awake_us + s->sleep_us + s->stop_us;
+    if (us == 0)
+        return 0;
+    return (uint32_t)(s->charge / us);
+}
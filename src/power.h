@@ -0,0 +1,78 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include <stdint.h>
+
+/*
+ * Idle and power management. Waits sleep instead of spinning:
+ *
+ *   power_sleep()  WFI (sleep mode) until the next interrupt. SysTick
+ *                  ticks at 1 kHz, so it never sleeps longer than 1 ms.
+ *   delay_ms()     sleeps until SysTick has counted the milliseconds.
+ *   power_stop()   stop mode (every clock off, regulator in low power)
+ *                  until the button (PA0, EXTI0) is pressed, then brings
+ *                  the clock profile's clock back.
+ *
+ * power_attract() is the title screen's policy: after ATTRACT_DEMO_MS on
+ * it, a demo game; after ATTRACT_STOP_MS without a press, demo games
+ * included, stop mode.
+ *
+ * Time spent awake and asleep is measured with micros() (TIM2). TIM2 halts
+ * in stop mode, so stop time is read from the RTC, clocked by the LSI,
+ * which is only good to the LSI's tolerance. Once a second the shares of
+ * each and an estimate of the average supply current, from the approximate
+ * figures in the clock profile table (clock.c) and POWER_STOP_UA, go out as
+ * a TLM_POWER telemetry record.
+ *
+ * Build with -DPOWER_HOST to run the logic on a PC: WFI and stop become
+ * calls to power_host_wfi(), which the host program supplies to advance
+ * its clock and raise interrupts by calling the handlers, and masking
+ * interrupts becomes power_host_irq(0), so it can hold them until
+ * power_host_irq(1).
+ */
+
+#define POWER_STOP_UA 25 // approximate MCU supply current in stop mode
+
+#define POWER_REPORT_MS 1000 // how often a TLM_POWER record is sent
+
+#define ATTRACT_DEMO_MS 10000 // time on the title screen before the autopilot plays a demo game
+#define ATTRACT_STOP_MS 30000 // idle time on the title screen before stop mode
+
+/* What the title screen does next */
+typedef enum
+{
+    ATTRACT_WAIT, // sleep until the next interrupt and ask again
+    ATTRACT_DEMO, // start a demo game
+    ATTRACT_STOP, // turn the displays off and stop until the button is pressed
+} attract_t;
+
+typedef struct
+{
+    uint32_t awake_us;
+    uint32_t sleep_us;
+    uint32_t stop_us;
+    uint32_t sleeps; // WFIs in sleep mode
+    uint32_t stops;  // times stop mode was entered
+    uint64_t charge; // microamp-microseconds, estimated
+} PowerStats;
+
+/* Function Prototypes */
+void power_init(void);
+uint32_t millis(void);
+void delay_ms(uint32_t ms);
+void power_sleep(void);
+void power_stop(void);
+int power_button_event(void);
+void power_stats(PowerStats *out);
+uint32_t power_estimate_ua(const PowerStats *s);
+attract_t power_attract(uint32_t now, uint32_t shown, uint32_t idle_since);
+void SysTick_Handler(void);
+void EXTI0_1_IRQHandler(void);
+
+#if defined(POWER_HOST)
+void power_host_wfi(int stop);
+void power_host_irq(int enable);
+uint32_t power_host_rtc_us(void);
+#endif
+
+#endif /* POWER_H */
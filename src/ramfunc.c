@@ -0,0 +1,120 @@
+/**
+ * @file ramfunc.c
+ * @brief The SRAM-resident code section: its size, and timing its kernels from flash and from SRAM.
+ *
+ * The startup code leaves the flash image of .ramfunc where it was loaded,
+ * so every RAMFUNC can still be run from flash at its load address. Built
+ * with -DRAMFUNC_BENCH (the nucleo_f091rc_ramfunc_bench env), main() runs
+ * ramfunc_bench() after boot, which times each pixel kernel both ways and
+ * sends the results as TLM_RAMFUNC records for utils/telemetry.py.
+ */
+
+#include "ramfunc.h"
+
+// From stm32f091rc.ld: where .ramfunc runs, and where it is stored in flash
+extern char _sramfunc[], _eramfunc[], _siramfunc[];
+
+/**
+ * @brief The SRAM taken by RAMFUNC code.
+ * @return Bytes in .ramfunc.
+ */
+uint32_t ramfunc_size(void)
+{
+    return _eramfunc - _sramfunc;
+}
+
+#if defined(RAMFUNC_BENCH) && RAMFUNC_ENABLE
+
+#include "picture.h"
+#include "telemetry.h"
+#include "utils.h"
+
+#define BENCH_W 24    // the pictures the kernels work on are BENCH_W square
+#define BENCH_REPS 20 // calls per timed run
+#define BENCH_RUNS 5  // timed runs each way, of which the fastest counts
+
+/* The same function, at its load address in flash instead of in SRAM. */
+#define IN_FLASH(fn) ((__typeof__(&(fn)))((uintptr_t)(fn) - (uintptr_t)_sramfunc + (uintptr_t)_siramfunc))
+
+#define TempPicturePtr(name, width, height) Picture name[(width) * (height) / 6 + 2] = {{width, height, 2}}
+
+// All in SRAM, so only where the code is fetched from differs
+TempPicturePtr(bench_dst, BENCH_W, BENCH_W);
+TempPicturePtr(bench_src, BENCH_W + 8, BENCH_W + 8);
+static unsigned char bench_index[INDEXED_STRIDE(BENCH_W, 4) * BENCH_W];
+static unsigned short bench_palette[16];
+static const IndexedPicture bench_indexed = {BENCH_W, BENCH_W, 4, bench_palette, bench_index};
+static const Asset bench_asset = {BENCH_W + 8, BENCH_W + 8, ASSET_RAW, 0, -1, bench_src->pix2, 0, 0, 0};
+
+/* Run a kernel BENCH_REPS times on the bench pictures, from flash or from SRAM. */
+static void run_kernel(int kernel, int flash)
+{
+    for (int i = 0; i < BENCH_REPS; i++)
+    {
+        switch (kernel)
+        {
+        case RAMFUNC_PIC_SUBSET:
+            (flash ? IN_FLASH(pic_subset) : pic_subset)(bench_dst, bench_src, 4, 4);
+            break;
+        case RAMFUNC_PIC_OVERLAY:
+            (flash ? IN_FLASH(pic_overlay) : pic_overlay)(bench_dst, -4, -4, bench_src, 0);
+            break;
+        case RAMFUNC_PIC_OVERLAY_INDEXED:
+            (flash ? IN_FLASH(pic_overlay_indexed) : pic_overlay_indexed)(bench_dst, 0, 0, &bench_indexed, 0);
+            break;
+        case RAMFUNC_PIC_BLIT_INDEXED:
+            (flash ? IN_FLASH(pic_blit_indexed) : pic_blit_indexed)(bench_dst, 0, 0, &bench_indexed, 0, 0xffff);
+            break;
+        case RAMFUNC_ASSET_ROW:
+            for (int y = 0; y < BENCH_W; y++)
+                (flash ? IN_FLASH(asset_row) : asset_row)(&bench_asset, 4, y, BENCH_W, &bench_dst->pix2[y * BENCH_W]);
+            break;
+        }
+    }
+}
+
+/* The fastest of BENCH_RUNS timed runs, so an interrupt landing in one does not count. */
+static uint32_t best_us(int kernel, int flash)
+{
+    uint32_t best = 0xffffffff;
+    for (int r = 0; r < BENCH_RUNS; r++)
+    {
+        uint32_t t0 = micros();
+        run_kernel(kernel, flash);
+        uint32_t us = micros() - t0;
+        if (us < best)
+            best = us;
+    }
+    return best;
+}
+
+/**
+ * @brief Time each pixel kernel run from flash and from SRAM, and send a TLM_RAMFUNC record for each.
+ * Takes a few tens of milliseconds and does not touch the display.
+ * @return void
+ */
+void ramfunc_bench(void)
+{
+    // about half the source pixels are the transparent 0, and a quarter of the indices
+    for (int i = 0; i < (BENCH_W + 8) * (BENCH_W + 8); i++)
+        bench_src->pix2[i] = (i * 7) & 8 ? 0 : 0x1234 + i;
+    for (unsigned int i = 0; i < sizeof bench_index; i++)
+        bench_index[i] = (unsigned char)(i * 37 + 11);
+    for (int i = 0; i < 16; i++)
+        bench_palette[i] = 0x0841 * i;
+
+    for (int k = 0; k < RAMFUNC_KERNEL_COUNT; k++)
+    {
+        uint32_t flash_us = best_us(k, 1);
+        uint32_t sram_us = best_us(k, 0);
+        telemetry_ramfunc(k, flash_us, sram_us, BENCH_W * BENCH_W * BENCH_REPS);
+    }
+}
+
+#else
+
+void ramfunc_bench(void)
+{
+}
+
+#endif /* RAMFUNC_BENCH */
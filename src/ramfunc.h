@@ -0,0 +1,53 @@
+#ifndef RAMFUNC_H
+#define RAMFUNC_H
+
+#include <stdint.h>
+
+/*
+ * Functions that run from SRAM instead of flash. At 48 MHz the flash needs
+ * a wait state (see internal_clock()), which the prefetch buffer hides on
+ * straight-line code but not on the taken branch that closes every pass of
+ * a pixel loop. SRAM has none.
+ *
+ * Put RAMFUNC in front of a function's definition and stm32f091rc.ld links
+ * it into .ramfunc, which the startup code copies into SRAM with .data.
+ * Each costs its size in SRAM for good, so only the pixel kernels are marked.
+ *
+ * A RAMFUNC must only call other RAMFUNCs (or through function pointers):
+ * a call out to flash is too far for a BL and goes through a linker
+ * veneer, and ramfunc_bench() runs the flash copy of the section, where
+ * only calls within it still land in the right place.
+ *
+ * Build with -DRAMFUNC_ENABLE=0 to leave everything in flash. Host builds
+ * (anything but ARM) leave it off.
+ */
+
+#ifndef RAMFUNC_ENABLE
+#if defined(__arm__)
+#define RAMFUNC_ENABLE 1
+#else
+#define RAMFUNC_ENABLE 0
+#endif
+#endif
+
+#if RAMFUNC_ENABLE
+#define RAMFUNC __attribute__((section(".ramfunc")))
+#else
+#define RAMFUNC
+#endif
+
+/* The kernels ramfunc_bench() times, in the order of its TLM_RAMFUNC records */
+enum ramfunc_kernel
+{
+    RAMFUNC_PIC_SUBSET,
+    RAMFUNC_PIC_OVERLAY,
+    RAMFUNC_PIC_OVERLAY_INDEXED,
+    RAMFUNC_PIC_BLIT_INDEXED,
+    RAMFUNC_ASSET_ROW,
+    RAMFUNC_KERNEL_COUNT
+};
+
+uint32_t ramfunc_size(void);
+void ramfunc_bench(void);
+
+#endif /* RAMFUNC_H */
@@ -0,0 +1,206 @@
+/**
+ * @file sched.c
+ * @brief Run-to-completion task queues drained by PendSV. See sched.h.
+ */
+
+#include "sched.h"
+
+#define QUEUE_MASK (SCHED_QUEUE_LEN - 1)
+
+/* Producers advance head with interrupts masked; only the drain advances tail. Both are
+   free-running, so head - tail is the number of queued tasks. */
+typedef struct
+{
+    Task *item[SCHED_QUEUE_LEN];
+    uint8_t head;
+    uint8_t tail;
+} Queue;
+
+static Queue queues[SCHED_PRIORITIES];
+static volatile uint32_t overruns;
+
+/* Plain loads and stores on the M0, ordered with respect to the task slots */
+#define LOAD(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define STORE(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+
+#if defined(SCHED_HOST)
+
+#include <pthread.h>
+#include <time.h>
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake = PTHREAD_COND_INITIALIZER;
+static pthread_t pendsv;
+static int pending;
+static int stopping;
+
+#define ENTER_CRITICAL() pthread_mutex_lock(&lock)
+#define EXIT_CRITICAL() pthread_mutex_unlock(&lock)
+
+static uint32_t now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000u + ts.tv_nsec / 1000);
+}
+
+static void pend(void)
+{
+    pthread_mutex_lock(&lock);
+    pending = 1;
+    pthread_cond_signal(&wake);
+    pthread_mutex_unlock(&lock);
+}
+
+/* The PendSV stand-in: one thread, so tasks still run one at a time. */
+static void *pendsv_thread(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&lock);
+    for (;;)
+    {
+        while (!pending && !stopping)
+            pthread_cond_wait(&wake, &lock);
+        if (!pending)
+            break;
+        pending = 0;
+        pthread_mutex_unlock(&lock);
+        sched_run();
+        pthread_mutex_lock(&lock);
+    }
+    pthread_mutex_unlock(&lock);
+    return 0;
+}
+
+static void port_init(void)
+{
+    stopping = 0;
+    pthread_create(&pendsv, 0, pendsv_thread, 0);
+}
+
+/**
+ * @brief Run whatever is still queued, then end the PendSV thread.
+ * @return void
+ */
+void sched_host_stop(void)
+{
+    pthread_mutex_lock(&lock);
+    stopping = 1;
+    pthread_cond_signal(&wake);
+    pthread_mutex_unlock(&lock);
+    pthread_join(pendsv, 0);
+}
+
+#else
+
+#include "stm32f0xx.h"
+#include "utils.h"
+
+#define ENTER_CRITICAL()                  \
+    uint32_t primask = __get_PRIMASK(); \
+    __disable_irq()
+#define EXIT_CRITICAL() __set_PRIMASK(primask)
+
+static uint32_t now(void)
+{
+    return micros();
+}
+
+static void pend(void)
+{
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+static void port_init(void)
+{
+}
+
+/**
+ * @brief PendSV exception: run the posted tasks. Its priority is set with the others, in main.c.
+ * @return void
+ */
+void PendSV_Handler(void)
+{
+    sched_run();
+}
+
+#endif /* SCHED_HOST */
+
+/**
+ * @brief Empty the queues and start the port.
+ * @return void
+ */
+void sched_init(void)
+{
+    for (int p = 0; p < SCHED_PRIORITIES; p++)
+        queues[p].head = queues[p].tail = 0;
+    overruns = 0;
+    port_init();
+}
+
+/**
+ * @brief Queue a task to run, unless it is already queued. Safe from any handler.
+ * @param t The task.
+ * @return 1 if it was queued, 0 if it already was (or its queue is full).
+ */
+int sched_post(Task *t)
+{
+    int queued = 0;
+    Queue *q = &queues[t->prio];
+
+    ENTER_CRITICAL();
+    if (!LOAD(&t->queued) && (uint8_t)(q->head - LOAD(&q->tail)) < SCHED_QUEUE_LEN)
+    {
+        t->queued = 1;
+        t->posted_at = now();
+        q->item[q->head & QUEUE_MASK] = t;
+        STORE(&q->head, (uint8_t)(q->head + 1));
+        queued = 1;
+    }
+    EXIT_CRITICAL();
+
+    if (queued)
+        pend();
+    return queued;
+}
+
+/**
+ * @brief Run queued tasks, most urgent first, until every queue is empty. Called by PendSV only.
+ * @return void
+ */
+void sched_run(void)
+{
+    for (;;)
+    {
+        Queue *q = queues;
+        while (q < queues + SCHED_PRIORITIES && LOAD(&q->head) == q->tail)
+            q++;
+        if (q == queues + SCHED_PRIORITIES)
+            return;
+
+        Task *t = q->item[q->tail & QUEUE_MASK];
+        uint32_t posted_at = t->posted_at;
+        STORE(&q->tail, (uint8_t)(q->tail + 1));
+        STORE(&t->queued, 0); // posts from here on run it again
+        t->run();
+
+        uint32_t took = now() - posted_at;
+        t->runs++;
+        if (took > t->worst_us)
+            t->worst_us = took;
+        if (took > t->deadline_us)
+        {
+            t->overruns++;
+            overruns++;
+        }
+    }
+}
+
+/**
+ * @brief Count of task runs that finished past their deadline.
+ * @return The count since sched_init().
+ */
+uint32_t sched_overruns(void)
+{
+    return overruns;
+}
@@ -0,0 +1,54 @@
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <stdint.h>
+
+/*
+ * Run-to-completion scheduler for work that is too long for an interrupt
+ * handler. Handlers post a Task; PendSV, the least urgent exception, runs
+ * posted tasks one at a time, most urgent queue first, each to completion.
+ * Anything a handler does stays quick, and the work it posts runs as soon
+ * as no handler needs the CPU.
+ *
+ * A task is queued at most once: posting one that is already queued does
+ * nothing, so a redraw requested twice is drawn once. Posting takes a slot
+ * with interrupts masked for a few instructions, since the M0 has no
+ * exclusive loads for a lock-free multi-producer queue; the drain never
+ * masks them. Each task has a deadline, counted from being posted to
+ * finishing; finishing later is counted as an overrun.
+ *
+ * Build with -DSCHED_HOST to run the same queues on a PC: a mutex stands
+ * in for masking interrupts and a thread for PendSV.
+ */
+
+#define SCHED_URGENT 0     // queue drained first
+#define SCHED_BACKGROUND 1 // runs when the urgent queue is empty
+#define SCHED_PRIORITIES 2
+#define SCHED_QUEUE_LEN 8 // tasks per priority; must be a power of two
+
+typedef struct
+{
+    void (*run)(void);
+    uint32_t deadline_us; // from being posted to finishing
+    uint8_t prio;         // SCHED_URGENT or SCHED_BACKGROUND
+    volatile uint8_t queued;
+    uint32_t posted_at;
+    uint32_t runs;
+    uint32_t overruns; // runs that finished past the deadline
+    uint32_t worst_us; // longest from being posted to finishing
+} Task;
+
+#define TASK(run, prio, deadline_us) {run, deadline_us, prio, 0, 0, 0, 0, 0}
+
+/* Function Prototypes */
+void sched_init(void);
+int sched_post(Task *t);
+void sched_run(void);
+uint32_t sched_overruns(void);
+void PendSV_Handler(void);
+
+#if defined(SCHED_HOST)
+void sched_host_stop(void);
+#endif
+
+#endif /* SCHED_H */
@@ -3,6 +3,8 @@
 #include <stdlib.h> // for srandom() and random()
 #include <stdio.h>
 #include "utils.h"
+#include "clock.h"
+#include "pins.h"
 #include "lcd.h"
 
 /* 8 byte message array for DMA transfer to the 8 segment displays */
@@ -77,6 +79,9 @@ void init_spi2(void)
 {
     RCC->APB1ENR |= RCC_APB1ENR_SPI2EN;
     RCC->AHBENR |= RCC_AHBENR_GPIOBEN;
+    pin_claim(PIN('B', 12), "spi2");
+    pin_claim(PIN('B', 13), "spi2");
+    pin_claim(PIN('B', 15), "spi2");
     // Set the mode of PB12, PB13, PB15 to alternate function mode for each of the Timer 3 channels.
     GPIOB->MODER &= ~(GPIO_MODER_MODER12 | GPIO_MODER_MODER13 | GPIO_MODER_MODER15);
     GPIOB->MODER |= (GPIO_MODER_MODER12_1 | GPIO_MODER_MODER13_1 | GPIO_MODER_MODER15_1);
@@ -92,8 +97,8 @@ void init_spi2(void)
     GPIOB->AFR[1] |= 0x0 << (4 * (15 - 8));    // set bits to 0 for AF0
     // Ensure that the CR1_SPE bit is clear first.
     SPI2->CR1 &= ~SPI_CR1_SPE;
-    // Set the baud rate as low as possible (maximum divisor for BR).
-    SPI2->CR1 |= (SPI_CR1_BR_2 | SPI_CR1_BR_1 | SPI_CR1_BR_0);
+    // Set the baud rate for the clock profile (the maximum divisor at 48 MHz).
+    SPI2->CR1 = (SPI2->CR1 & ~SPI_CR1_BR) | clock_timing()->spi2_br << SPI_CR1_BR_Pos;
     // Configure the interface for a 16-bit word size.
     SPI2->CR2 |= (SPI_CR2_DS_1 | SPI_CR2_DS_2 | SPI_CR2_DS_3);
     // Configure the SPI channel to be in "master configuration".
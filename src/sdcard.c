@@ -0,0 +1,283 @@
+/**
+ * @file sdcard.c
+ * @brief SD card block reads over the shared SPI1 bus. See sdcard.h.
+ */
+
+#include "sdcard.h"
+
+SdStats sd_stats;
+
+#if defined(SD_HOST)
+
+#include <stdio.h>
+
+static const char *image_path;
+static FILE *image;
+
+/**
+ * @brief Name the disk image that stands in for the card.
+ * @param path The image file.
+ * @return void
+ */
+void sd_host_image(const char *path)
+{
+    image_path = path;
+}
+
+int8_t sd_init(void)
+{
+    if (image)
+        fclose(image);
+    image = image_path ? fopen(image_path, "rb") : 0;
+    return image ? SD_OK : SD_ERROR;
+}
+
+int8_t sd_read(uint32_t lba, uint32_t count, void *buf)
+{
+    sd_stats.commands++;
+    if (count > 1)
+        sd_stats.multi++;
+    if (!image || fseek(image, (long)lba * SD_BLOCK, SEEK_SET) != 0 ||
+        fread(buf, SD_BLOCK, count, image) != count)
+    {
+        sd_stats.errors++;
+        return SD_ERROR;
+    }
+    sd_stats.blocks += count;
+    return SD_OK;
+}
+
+#else
+
+#include "stm32f0xx.h"
+#include "clock.h"
+#include "spibus.h"
+#include "lcd.h"
+#include "utils.h"
+
+#define CMD0 0    // GO_IDLE_STATE
+#define CMD8 8    // SEND_IF_COND
+#define CMD12 12  // STOP_TRANSMISSION
+#define CMD16 16  // SET_BLOCKLEN
+#define CMD17 17  // READ_SINGLE_BLOCK
+#define CMD18 18  // READ_MULTIPLE_BLOCK
+#define CMD55 55  // APP_CMD
+#define CMD58 58  // READ_OCR
+#define ACMD41 41 // SD_SEND_OP_COND
+
+#define R1_IDLE 0x01
+#define TOKEN_START 0xfe
+
+static uint8_t block_addressed; // SDHC/SDXC: the argument is a block number, not a byte offset
+static uint8_t ready;
+
+// The card on the SPI1 bus, less urgent than the display
+static SpiDevice sd_spi = SPIBUS_DEVICE("sdcard", PIN('B', 2), 8, 1, CLOCK_SPI1_SLOW_HZ, 0, 0);
+
+/* Send a byte and return the one received at the same time. */
+static uint8_t xfer(uint8_t out)
+{
+    while ((SPI1->SR & SPI_SR_TXE) == 0)
+        ;
+    *((volatile uint8_t *)&SPI1->DR) = out;
+    while ((SPI1->SR & SPI_SR_RXNE) == 0)
+        ;
+    return *((volatile uint8_t *)&SPI1->DR);
+}
+
+/* Take the bus, which a parked display lets go of, and select the card. */
+static int8_t card_select(void)
+{
+    return spibus_acquire(&sd_spi) ? SD_OK : SD_ERROR;
+}
+
+/* Deselect the card, then clock out a byte so it lets go of MISO, and give up the bus. */
+static void card_deselect(void)
+{
+    spibus_select(&sd_spi, 0);
+    xfer(0xff);
+    spibus_release(&sd_spi);
+}
+
+/* Send a command and return its R1 response, or 0xff if none came. */
+static uint8_t command(uint8_t cmd, uint32_t arg)
+{
+    // only CMD0 and CMD8 are checked before CRCs are turned off, which they never are here
+    uint8_t crc = cmd == CMD0 ? 0x95 : cmd == CMD8 ? 0x87 : 0x01;
+    xfer(0x40 | cmd);
+    xfer(arg >> 24);
+    xfer(arg >> 16);
+    xfer(arg >> 8);
+    xfer(arg);
+    xfer(crc);
+    if (cmd == CMD12)
+        xfer(0xff); // a stuff byte comes first
+    for (int i = 0; i < 10; i++)
+    {
+        uint8_t r1 = xfer(0xff);
+        if ((r1 & 0x80) == 0)
+            return r1;
+    }
+    return 0xff;
+}
+
+static uint8_t app_command(uint8_t cmd, uint32_t arg)
+{
+    command(CMD55, 0);
+    return command(cmd, arg);
+}
+
+/**
+ * @brief Bring the card up in SPI mode and find out how it is addressed.
+ * The display must be initialized and not in the middle of a drawing.
+ * @return SD_OK, or SD_ERROR if there is no card, it did not answer as expected, or PB2 or the
+ * bus was not to be had.
+ */
+int8_t sd_init(void)
+{
+    ready = 0;
+    if (spibus_attach(&sd_spi) != SPIBUS_OK)
+        return SD_ERROR;
+    spibus_rate(&sd_spi, CLOCK_SPI1_SLOW_HZ);
+    if (card_select() != SD_OK)
+        return SD_ERROR;
+
+    // at least 74 clocks with the card deselected and MOSI high
+    spibus_select(&sd_spi, 0);
+    for (int i = 0; i < 10; i++)
+        xfer(0xff);
+    spibus_select(&sd_spi, 1);
+
+    int8_t status = SD_ERROR;
+    uint8_t hc_arg = 0;
+    if (command(CMD0, 0) != R1_IDLE)
+        goto done;
+    if (command(CMD8, 0x1aa) == R1_IDLE)
+    {
+        // version 2 card: the voltage range and check pattern come back
+        uint8_t r7[4];
+        for (int i = 0; i < 4; i++)
+            r7[i] = xfer(0xff);
+        if ((r7[2] & 0x0f) != 0x01 || r7[3] != 0xaa)
+            goto done;
+        hc_arg = 1;
+    }
+    uint32_t start = micros();
+    while (app_command(ACMD41, hc_arg ? 1u << 30 : 0) != 0)
+    {
+        if (micros() - start > SD_INIT_TIMEOUT_MS * 1000)
+            goto done;
+    }
+    block_addressed = 0;
+    if (hc_arg)
+    {
+        if (command(CMD58, 0) != 0)
+            goto done;
+        uint8_t ocr = xfer(0xff);
+        for (int i = 0; i < 3; i++)
+            xfer(0xff);
+        block_addressed = (ocr & 0x40) != 0; // CCS
+    }
+    if (!block_addressed && command(CMD16, SD_BLOCK) != 0)
+        goto done;
+    status = SD_OK;
+    ready = 1;
+done:
+    card_deselect();
+    // the display's rate, so going between the two does not change the divisor, unless the card cannot take it
+    spibus_rate(&sd_spi, lcd_link.max_hz < SD_MAX_HZ ? lcd_link.max_hz : SD_MAX_HZ);
+    return status;
+}
+
+/* Receive one data block into buf by DMA. */
+static int8_t read_block(uint8_t *buf)
+{
+    static const uint8_t ones = 0xff;
+    uint32_t start = micros();
+    uint8_t token;
+    while ((token = xfer(0xff)) == 0xff)
+        if (micros() - start > SD_READ_TIMEOUT_MS * 1000)
+            return SD_ERROR;
+    if (token != TOKEN_START)
+        return SD_ERROR;
+
+    DMA1_CSELR->CSELR = (DMA1_CSELR->CSELR & ~DMA_CSELR_C2S) | DMA1_CSELR_CH2_SPI1_RX;
+    DMA1_Channel2->CCR = DMA_CCR_MINC | DMA_CCR_PL_1;
+    DMA1_Channel2->CPAR = (uint32_t)&SPI1->DR;
+    DMA1_Channel2->CMAR = (uint32_t)buf;
+    DMA1_Channel2->CNDTR = SD_BLOCK;
+    DMA1_Channel3->CCR = DMA_CCR_DIR; // the same 0xff every time
+    DMA1_Channel3->CMAR = (uint32_t)&ones;
+    DMA1_Channel3->CNDTR = SD_BLOCK;
+    SPI1->CR2 |= SPI_CR2_RXDMAEN;
+    DMA1_Channel2->CCR |= DMA_CCR_EN;
+    SPI1->CR2 |= SPI_CR2_TXDMAEN; // receive is set up first, so no byte is missed
+    DMA1_Channel3->CCR |= DMA_CCR_EN;
+    while ((DMA1->ISR & DMA_ISR_TCIF2) == 0)
+        ;
+    DMA1->IFCR = DMA_IFCR_CGIF2 | DMA_IFCR_CGIF3;
+    DMA1_Channel2->CCR &= ~DMA_CCR_EN;
+    DMA1_Channel3->CCR &= ~DMA_CCR_EN;
+    SPI1->CR2 &= ~(SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+
+    xfer(0xff); // CRC, not checked
+    xfer(0xff);
+    return SD_OK;
+}
+
+/**
+ * @brief Read whole blocks from the card.
+ * @param lba The first block.
+ * @param count How many blocks, at least 1.
+ * @param buf Where to put them, count * SD_BLOCK bytes.
+ * @return SD_OK, or SD_ERROR if the card is not ready or a read failed.
+ */
+int8_t sd_read(uint32_t lba, uint32_t count, void *buf)
+{
+    if (!ready)
+        return SD_ERROR;
+    uint8_t *p = buf;
+    uint32_t arg = block_addressed ? lba : lba * SD_BLOCK;
+    int8_t status = SD_ERROR;
+
+    if (card_select() != SD_OK)
+    {
+        sd_stats.errors++;
+        return SD_ERROR;
+    }
+    sd_stats.commands++;
+    if (count == 1)
+    {
+        if (command(CMD17, arg) == 0)
+            status = read_block(p);
+    }
+    else
+    {
+        sd_stats.multi++;
+        if (command(CMD18, arg) == 0)
+        {
+            status = SD_OK;
+            for (uint32_t i = 0; i < count && status == SD_OK; i++, p += SD_BLOCK)
+                status = read_block(p);
+            command(CMD12, 0);
+            uint32_t start = micros();
+            while (xfer(0xff) == 0) // busy
+            {
+                if (micros() - start > SD_READ_TIMEOUT_MS * 1000)
+                {
+                    status = SD_ERROR;
+                    break;
+                }
+            }
+        }
+    }
+    card_deselect();
+
+    if (status == SD_OK)
+        sd_stats.blocks += count;
+    else
+        sd_stats.errors++;
+    return status;
+}
+
+#endif /* SD_HOST */
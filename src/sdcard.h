@@ -0,0 +1,53 @@
+#ifndef SDCARD_H
+#define SDCARD_H
+
+#include <stdint.h>
+
+/*
+ * Read-only block access to the SD card in the TFT module's slot, in SPI
+ * mode on SPI1, which it shares with the display. The card is a device on
+ * the bus (spibus.h) with its select on PB2; acquiring the bus makes a
+ * display that is still sending pixels finish and let go, so card reads
+ * may come between display writes, but never in the middle of one nor
+ * while the display is being initialized (the read then fails).
+ *
+ * sd_init() follows the SPI mode power-up sequence at the slow setup rate,
+ * for SDSC (byte addressed) and SDHC/SDXC (block addressed) cards, and
+ * reads at the display's rate, as LCD_LinkTest() left it, after that, up
+ * to SD_MAX_HZ. sd_read() reads one block with
+ * CMD17, or several with one CMD18, each block received by DMA (DMA1
+ * channel 2 from SPI1, with channel 3 clocking out 0xFF).
+ *
+ * Build with -DSD_HOST to run on a PC against a disk image file standing
+ * in for the card: sd_host_image() names it before sd_init().
+ */
+
+#define SD_BLOCK 512 // bytes per block; every card in SPI mode
+#define SD_MAX_HZ 25000000 // fastest SPI clock a card takes once set up
+
+#define SD_INIT_TIMEOUT_MS 1000 // for the card to leave its idle state
+#define SD_READ_TIMEOUT_MS 100  // for a data block to start
+
+typedef struct
+{
+    uint32_t commands; // read commands sent
+    uint32_t blocks;   // blocks read
+    uint32_t multi;    // reads that used CMD18
+    uint32_t errors;
+} SdStats;
+
+extern SdStats sd_stats;
+
+// Status codes
+#define SD_OK 0
+#define SD_ERROR -1
+
+/* Function Prototypes */
+int8_t sd_init(void);
+int8_t sd_read(uint32_t lba, uint32_t count, void *buf);
+
+#if defined(SD_HOST)
+void sd_host_image(const char *path);
+#endif
+
+#endif /* SDCARD_H */
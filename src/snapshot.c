@@ -0,0 +1,87 @@
+/**
+ * @file snapshot.c
+ * @brief Lock-free sequence-counted double buffer. See snapshot.h.
+ */
+
+#include <string.h>
+
+#include "snapshot.h"
+
+/* Keep the counter and buffer accesses in order. A DMB on the M0; on a PC, a fence between threads. */
+#define FENCE() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+static volatile uint32_t retries;
+
+/**
+ * @brief Set up a snapshot with both buffers holding the same first generation.
+ * @param s The snapshot.
+ * @param buf0 One buffer of size bytes.
+ * @param buf1 The other.
+ * @param size The size of the struct being passed.
+ * @param initial The first generation's contents.
+ * @return void
+ */
+void snapshot_init(Snapshot *s, void *buf0, void *buf1, uint32_t size, const void *initial)
+{
+    s->buf[0] = buf0;
+    s->buf[1] = buf1;
+    s->size = size;
+    memcpy(buf0, initial, size);
+    memcpy(buf1, initial, size);
+    s->published = 0;
+    s->writing = 0;
+    FENCE();
+}
+
+/**
+ * @brief Start writing the next generation. Only the writer may call this.
+ * @param s The snapshot.
+ * @return The buffer to fill, holding the generation before the newest one.
+ */
+void *snapshot_begin(Snapshot *s)
+{
+    uint32_t next = s->published + 1;
+    s->writing = next;
+    FENCE();
+    return s->buf[next & 1];
+}
+
+/**
+ * @brief Make the generation filled since snapshot_begin() the newest.
+ * @param s The snapshot.
+ * @return void
+ */
+void snapshot_publish(Snapshot *s)
+{
+    FENCE();
+    s->published = s->writing;
+}
+
+/**
+ * @brief Copy out the newest complete generation.
+ * @param s The snapshot.
+ * @param out Where to put it.
+ * @return The generation copied.
+ */
+uint32_t snapshot_read(const Snapshot *s, void *out)
+{
+    for (;;)
+    {
+        uint32_t gen = s->published;
+        FENCE();
+        memcpy(out, s->buf[gen & 1], s->size);
+        FENCE();
+        if (s->writing - gen < 2)
+            return gen; // nothing has started on its buffer
+        retries++;
+    }
+}
+
+/**
+ * @brief Count of reads that had to copy again because the writer overtook them.
+ * @return The count since reset.
+ */
+uint32_t snapshot_retries(void)
+{
+    return retries;
+}
@@ -0,0 +1,38 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdint.h>
+
+/*
+ * Sequence-counted double buffer, for handing a struct from one writer to
+ * any number of readers without locks. The Cortex-M0 has no LDREX/STREX,
+ * and none are needed: only the writer stores to the counters.
+ *
+ * The writer fills the buffer the newest generation is not in, then
+ * publishes it. Before it starts it sets `writing` to the generation it is
+ * about to produce, so a reader that copied a buffer can tell afterwards
+ * whether the writer had begun overwriting it: generation g lives in
+ * buf[g & 1] until generation g + 2 starts. A reader retries only if two
+ * whole generations were started during its copy, which, for a copy of a
+ * few hundred bytes against a 64 Hz writer, is never in practice.
+ *
+ * Neither side disables interrupts or waits on the other. There must be
+ * one writer at a time; readers may run at any priority, in threads too.
+ */
+
+typedef struct
+{
+    volatile uint32_t published; // newest complete generation, in buf[published & 1]
+    volatile uint32_t writing;   // generation being written, or published when idle
+    void *buf[2];
+    uint32_t size;
+} Snapshot;
+
+/* Function Prototypes */
+void snapshot_init(Snapshot *s, void *buf0, void *buf1, uint32_t size, const void *initial);
+void *snapshot_begin(Snapshot *s);
+void snapshot_publish(Snapshot *s);
+uint32_t snapshot_read(const Snapshot *s, void *out);
+uint32_t snapshot_retries(void);
+
+#endif /* SNAPSHOT_H */
@@ -0,0 +1,391 @@
+/**
+ * @file spibus.c
+ * @brief SPI1 shared by the display and the SD card. See spibus.h.
+ */
+
+#include "spibus.h"
+#include "clock.h"
+
+SpiBusStats spibus_stats;
+
+static SpiDevice *devices[SPIBUS_DEVICES];
+static SpiDevice *owner;      // holds the bus, or 0
+static uint8_t parked;        // the owner lets go as soon as another device asks
+static SpiDevice *configured; // the registers are set up for this device, or 0 if for none yet
+static uint32_t queue_order;  // of the last refused acquire
+
+#if defined(SPIBUS_HOST)
+
+SpiBusHost spibus_host;
+
+#define SPI (&spibus_host.spi)
+#define GPIO(pin) (&spibus_host.gpio[PIN_PORT(pin)])
+
+#define SPI_CR1_MSTR (1u << 2)
+#define SPI_CR1_BR_Pos 3
+#define SPI_CR1_BR (7u << SPI_CR1_BR_Pos)
+#define SPI_CR1_SPE (1u << 6)
+#define SPI_CR1_SSI (1u << 8)
+#define SPI_CR1_SSM (1u << 9)
+#define SPI_CR2_DS_Pos 8
+#define SPI_CR2_DS (15u << SPI_CR2_DS_Pos)
+#define SPI_CR2_FRXTH (1u << 12)
+#define SPI_SR_BSY (1u << 7)
+#define SPI_SR_FTLVL (3u << 11)
+
+#define ENTER_CRITICAL()
+#define EXIT_CRITICAL()
+
+/* The divisor and the data size may only change with the SPI disabled and idle. */
+static void spi_cr1(uint32_t v)
+{
+    uint32_t cr1 = SPI->CR1;
+    if ((cr1 & SPI_CR1_SPE) && (v & SPI_CR1_SPE) && ((cr1 ^ v) & SPI_CR1_BR))
+        spibus_host.faults++;
+    SPI->CR1 = v;
+}
+
+static void spi_cr2(uint32_t v)
+{
+    if (SPI->SR & SPI_SR_BSY)
+        spibus_host.faults++;
+    SPI->CR2 = v;
+}
+
+static void gpio_bsrr(uint8_t pin, uint32_t v)
+{
+    GPIO(pin)->BSRR = v;
+    GPIO(pin)->ODR = (GPIO(pin)->ODR | (v & 0xffff)) & ~(v >> 16);
+}
+
+static int rx_level(void)
+{
+    return spibus_host.rx != 0;
+}
+
+static void rx_byte(void)
+{
+    spibus_host.rx--;
+}
+
+#else
+
+#include "stm32f0xx.h"
+
+#define SPI SPI1
+#define GPIO(pin) ((GPIO_TypeDef *)(GPIOA_BASE + PIN_PORT(pin) * (GPIOB_BASE - GPIOA_BASE)))
+
+#define ENTER_CRITICAL()                  \
+    uint32_t primask = __get_PRIMASK(); \
+    __disable_irq()
+#define EXIT_CRITICAL() __set_PRIMASK(primask)
+
+static void spi_cr1(uint32_t v)
+{
+    SPI->CR1 = v;
+}
+
+static void spi_cr2(uint32_t v)
+{
+    SPI->CR2 = v;
+}
+
+static void gpio_bsrr(uint8_t pin, uint32_t v)
+{
+    GPIO(pin)->BSRR = v;
+}
+
+static int rx_level(void)
+{
+    return (SPI->SR & SPI_SR_FRLVL) != 0;
+}
+
+static void rx_byte(void)
+{
+    (void)*((volatile uint8_t *)&SPI->DR);
+}
+
+#endif /* SPIBUS_HOST */
+
+#define MODE_OUTPUT 1
+#define MODE_AF 2
+
+static void gpio_mode(uint8_t pin, uint32_t mode)
+{
+    unsigned int n = PIN_NUM(pin);
+    GPIO(pin)->MODER = (GPIO(pin)->MODER & ~(3u << (2 * n))) | mode << (2 * n);
+}
+
+/* Drive a chip select: low (selected) if val is non-zero. */
+static void cs_write(uint8_t pin, int val)
+{
+    gpio_bsrr(pin, val ? 1u << (PIN_NUM(pin) + 16) : 1u << PIN_NUM(pin));
+#if defined(SPIBUS_HOST)
+    if (spibus_host.chip_select)
+        spibus_host.chip_select(pin, val);
+#endif
+}
+
+static void wait_idle(void)
+{
+    while ((SPI->SR & SPI_SR_FTLVL) || (SPI->SR & SPI_SR_BSY))
+        ;
+}
+
+/* Set the registers up for d, writing only what differs from the last device. */
+static void configure(SpiDevice *d)
+{
+    uint32_t sysclk = clock_timing()->sysclk_hz;
+    if (d->br_sysclk != sysclk)
+    {
+        d->br = clock_spi_br(sysclk, d->max_hz);
+        d->br_sysclk = sysclk;
+    }
+    uint32_t br = (uint32_t)d->br << SPI_CR1_BR_Pos;
+    uint32_t ds = (uint32_t)(d->bits - 1) << SPI_CR2_DS_Pos;
+
+    wait_idle();
+    if ((SPI->CR1 & SPI_CR1_BR) != br)
+    {
+        spi_cr1(SPI->CR1 & ~SPI_CR1_SPE);
+        spi_cr1((SPI->CR1 & ~SPI_CR1_BR) | br);
+        spi_cr1(SPI->CR1 | SPI_CR1_SPE);
+        spibus_stats.rebauds++;
+    }
+    if ((SPI->CR2 & SPI_CR2_DS) != ds)
+        spi_cr2((SPI->CR2 & ~SPI_CR2_DS) | ds);
+    // the receive FIFO holds whatever the last device clocked in and never read
+    while (rx_level())
+        rx_byte();
+    (void)SPI->SR; // clears an overrun, with the reads above
+    configured = d;
+}
+
+/**
+ * @brief Set up SPI1 as a master, with SCK, MISO and MOSI on PB3 to PB5. No device is selected.
+ * @return void
+ */
+void spibus_init(void)
+{
+    pin_claim(PIN('B', 3), "spi1");
+    pin_claim(PIN('B', 4), "spi1");
+    pin_claim(PIN('B', 5), "spi1");
+#if !defined(SPIBUS_HOST)
+    RCC->AHBENR |= RCC_AHBENR_GPIOBEN;
+    RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
+#endif
+    for (int n = 3; n <= 5; n++)
+        gpio_mode(PIN('B', n), MODE_AF);
+    GPIO(PIN('B', 3))->AFR[0] &= ~(0xfffu << (4 * 3)); // AF0
+
+    spi_cr1(0);
+    // 8-bit frames, RXNE at each byte, the slowest clock until a device is granted the bus
+    spi_cr2(7u << SPI_CR2_DS_Pos | SPI_CR2_FRXTH);
+    spi_cr1(SPI_CR1_MSTR | SPI_CR1_SSM | SPI_CR1_SSI | SPI_CR1_BR);
+    spi_cr1(SPI->CR1 | SPI_CR1_SPE);
+
+    owner = 0;
+    parked = 0;
+    configured = 0;
+}
+
+/**
+ * @brief Add a device to the bus: claim its chip select pin and drive it high.
+ * @param d The device, which must last. Attaching it again is harmless.
+ * @return SPIBUS_OK, or SPIBUS_ERROR if the pin belongs to someone else or the bus is full.
+ */
+int8_t spibus_attach(SpiDevice *d)
+{
+    if (pin_claim(d->cs, d->name) != PIN_OK)
+        return SPIBUS_ERROR;
+    int i = 0;
+    while (i < SPIBUS_DEVICES && devices[i] != 0 && devices[i] != d)
+        i++;
+    if (i == SPIBUS_DEVICES)
+        return SPIBUS_ERROR;
+    devices[i] = d;
+
+#if !defined(SPIBUS_HOST)
+    RCC->AHBENR |= RCC_AHBENR_GPIOAEN << PIN_PORT(d->cs);
+#endif
+    cs_write(d->cs, 0); // high before it is an output, so it never glitches low
+    gpio_mode(d->cs, MODE_OUTPUT);
+    d->br_sysclk = 0;
+    d->queued = 0;
+    return SPIBUS_OK;
+}
+
+/**
+ * @brief Take the bus and select the device, setting SPI1 up for it if another device had it.
+ * A parked holder is made to release it first.
+ * @param d The device.
+ * @return 1 if d now holds the bus, or 0 if another device does (and d is queued, if it has a grant task).
+ */
+int spibus_acquire(SpiDevice *d)
+{
+    SpiDevice *holder = owner;
+    if (holder != 0 && holder != d && parked && holder->yield)
+    {
+        spibus_stats.yields++;
+        holder->yield(); // which releases it
+    }
+
+    ENTER_CRITICAL();
+    int granted = owner == 0 || owner == d;
+    if (granted)
+    {
+        owner = d;
+        d->queued = 0;
+    }
+    else
+    {
+        spibus_stats.refusals++;
+        if (d->grant && d->queued == 0)
+            d->queued = ++queue_order;
+    }
+    EXIT_CRITICAL();
+    if (!granted)
+        return 0;
+
+    parked = 0;
+    if (configured != d)
+        spibus_stats.switches++;
+    if (configured != d || d->br_sysclk != clock_timing()->sysclk_hz)
+        configure(d);
+    cs_write(d->cs, 1);
+    spibus_stats.grants++;
+    return 1;
+}
+
+/**
+ * @brief Deselect the device once the SPI is idle and give up the bus, posting the grant task of
+ * the most urgent device queued for it. Does nothing if d does not hold the bus.
+ * @param d The device.
+ * @return void
+ */
+void spibus_release(SpiDevice *d)
+{
+    if (owner != d)
+        return;
+    wait_idle();
+    cs_write(d->cs, 0);
+
+    SpiDevice *next = 0;
+    ENTER_CRITICAL();
+    owner = 0;
+    parked = 0;
+    for (int i = 0; i < SPIBUS_DEVICES && devices[i] != 0; i++)
+    {
+        SpiDevice *q = devices[i];
+        if (q->queued == 0)
+            continue;
+        if (next == 0 || q->prio < next->prio ||
+            (q->prio == next->prio && (int32_t)(q->queued - next->queued) < 0))
+            next = q;
+    }
+    if (next)
+        next->queued = 0;
+    EXIT_CRITICAL();
+    if (next)
+        sched_post(next->grant);
+}
+
+/**
+ * @brief Keep the bus, still selected, until another device asks for it, when the bus calls the
+ * device's yield(). Does nothing if d does not hold the bus.
+ * @param d The device, which must have a yield().
+ * @return void
+ */
+void spibus_park(SpiDevice *d)
+{
+    if (owner == d && d->yield)
+        parked = 1;
+}
+
+/**
+ * @brief Carry on with a parked bus, which nobody else can then take.
+ * Does nothing if d does not hold the bus.
+ * @param d The device.
+ * @return void
+ */
+void spibus_unpark(SpiDevice *d)
+{
+    if (owner == d)
+        parked = 0;
+}
+
+/**
+ * @brief Drive the chip select of the device holding the bus, as for clocks sent deselected.
+ * Deselecting waits for the SPI to be idle.
+ * @param d The device.
+ * @param val Non-zero to select it.
+ * @return void
+ */
+void spibus_select(SpiDevice *d, int val)
+{
+    if (owner != d)
+        return;
+    if (!val)
+        wait_idle();
+    cs_write(d->cs, val);
+}
+
+/**
+ * @brief Change a device's data size. It is set now if the registers are the device's (or
+ * nobody's), which they are while it holds the bus, and otherwise when it is next granted it.
+ * @param d The device.
+ * @param bits The data size, 4 to 16.
+ * @return void
+ */
+void spibus_bits(SpiDevice *d, uint8_t bits)
+{
+    d->bits = bits;
+    if (configured != d && configured != 0)
+        return;
+    wait_idle();
+    uint32_t ds = (uint32_t)(bits - 1) << SPI_CR2_DS_Pos;
+    if ((SPI->CR2 & SPI_CR2_DS) != ds)
+        spi_cr2((SPI->CR2 & ~SPI_CR2_DS) | ds);
+}
+
+/**
+ * @brief Change the fastest clock a device takes, from its next acquire.
+ * @param d The device.
+ * @param max_hz The clock.
+ * @return void
+ */
+void spibus_rate(SpiDevice *d, uint32_t max_hz)
+{
+    d->max_hz = max_hz;
+    d->br_sysclk = 0;
+}
+
+/**
+ * @brief Work the divisor out again after the clock profile has changed. The SPI must be idle.
+ * @return void
+ */
+void spibus_retime(void)
+{
+    if (configured)
+        configure(configured);
+}
+
+/**
+ * @brief The clock a device gets in the current clock profile.
+ * @param d The device.
+ * @return The SCK frequency.
+ */
+uint32_t spibus_hz(const SpiDevice *d)
+{
+    uint32_t sysclk = clock_timing()->sysclk_hz;
+    return sysclk >> (clock_spi_br(sysclk, d->max_hz) + 1);
+}
+
+/**
+ * @brief The device holding the bus.
+ * @return The device, or 0 if the bus is free.
+ */
+SpiDevice *spibus_owner(void)
+{
+    return owner;
+}
@@ -0,0 +1,119 @@
+#ifndef SPIBUS_H
+#define SPIBUS_H
+
+#include <stdint.h>
+#include "pins.h"
+#include "sched.h"
+
+/*
+ * SPI1 and the devices on it: the display and the SD card in the TFT
+ * module. Each device is an SpiDevice giving its chip select pin, its
+ * data size and the fastest clock it takes. One device holds the bus at a
+ * time: spibus_acquire() selects it, after setting SPI1 up for it, and
+ * spibus_release() deselects it.
+ *
+ * Switching is cheap. The registers are left set up for whoever had the
+ * bus last, so a device that gets it back pays nothing, and a switch only
+ * writes what differs: the data size, and the baud rate divisor (with the
+ * SPI briefly disabled) if the clocks differ. The divisor for a device is
+ * worked out once per clock profile. A device that changes its data size
+ * while it holds the bus does so with spibus_bits(), which the bus
+ * remembers, so the display may keep framing 16 bits across a card read.
+ *
+ * A device may park instead of releasing when it is likely to be back
+ * soon, as the display does while a row is still going out by DMA: it
+ * keeps the bus, selected, until another device asks for it, and the bus
+ * then calls its yield() to finish up and release.
+ *
+ * spibus_acquire() never waits: if another device holds the bus and has
+ * not parked, it returns 0. A device with a grant task is then queued,
+ * and each release posts the task of the queued device with the most
+ * urgent prio (the first queued among equals), which acquires the bus
+ * when it runs. The bus is not kept for it meanwhile, so whoever asks
+ * first still gets it; a refused device without a grant task simply tries
+ * again later.
+ *
+ * Every pin goes through pins.h: SCK, MISO and MOSI (PB3 to PB5) are
+ * claimed by spibus_init() and each chip select by spibus_attach(), which
+ * fails if another part of the firmware has the pin.
+ *
+ * Build with -DSPIBUS_HOST to run on a PC: the same code drives plain
+ * structs standing in for the SPI1 and GPIO registers (spibus_host), which
+ * also count writes that the hardware would not take, such as a new
+ * divisor with the SPI enabled. A fake device can watch its chip select
+ * through spibus_host.chip_select.
+ */
+
+#define SPIBUS_DEVICES 4
+
+typedef struct
+{
+    const char *name;    // owner of the chip select pin
+    uint8_t cs;          // PIN(port, n), active low
+    uint8_t bits;        // data size, 4 to 16
+    uint8_t prio;        // among queued devices, 0 is granted first
+    uint32_t max_hz;     // fastest clock the device takes
+    void (*yield)(void); // finishes and releases a parked bus, or 0 if it never parks
+    Task *grant;         // posted when the bus comes free after a refused acquire, or 0
+    // kept by the bus
+    uint32_t br_sysclk; // the SYSCLK br was worked out for, or 0
+    uint8_t br;         // SPI_CR1_BR field value, not yet shifted
+    uint32_t queued;    // order of a refused acquire, or 0
+} SpiDevice;
+
+#define SPIBUS_DEVICE(name, cs, bits, prio, max_hz, yield, grant) {name, cs, bits, prio, max_hz, yield, grant, 0, 0, 0}
+
+typedef struct
+{
+    uint32_t grants;   // acquires that got the bus
+    uint32_t switches; // grants to a device other than the last one
+    uint32_t rebauds;  // switches that had to change the divisor
+    uint32_t yields;   // parked holders made to let go
+    uint32_t refusals; // acquires queued because the bus was held
+} SpiBusStats;
+
+extern SpiBusStats spibus_stats;
+
+// Status codes
+#define SPIBUS_OK 0
+#define SPIBUS_ERROR -1
+
+/* Function Prototypes */
+void spibus_init(void);
+int8_t spibus_attach(SpiDevice *d);
+int spibus_acquire(SpiDevice *d);
+void spibus_release(SpiDevice *d);
+void spibus_park(SpiDevice *d);
+void spibus_unpark(SpiDevice *d);
+void spibus_select(SpiDevice *d, int val);
+void spibus_bits(SpiDevice *d, uint8_t bits);
+void spibus_rate(SpiDevice *d, uint32_t max_hz);
+void spibus_retime(void);
+uint32_t spibus_hz(const SpiDevice *d);
+SpiDevice *spibus_owner(void);
+
+#if defined(SPIBUS_HOST)
+/* The registers spibus.c touches, at their offsets in the real ones */
+typedef struct
+{
+    volatile uint32_t CR1, CR2, SR, DR;
+} SpiBusHostSpi;
+
+typedef struct
+{
+    volatile uint32_t MODER, OTYPER, OSPEEDR, PUPDR, IDR, ODR, BSRR, LCKR, AFR[2], BRR;
+} SpiBusHostGpio;
+
+typedef struct
+{
+    SpiBusHostSpi spi;
+    SpiBusHostGpio gpio[PIN_PORTS];
+    uint32_t faults; // writes the hardware would not take
+    uint32_t rx;     // bytes left in the receive FIFO
+    void (*chip_select)(uint8_t pin, int selected); // told of every chip select write, for a fake device, or 0
+} SpiBusHost;
+
+extern SpiBusHost spibus_host;
+#endif
+
+#endif /* SPIBUS_H */
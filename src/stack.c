@@ -0,0 +1,57 @@
+/**
+ * @file stack.c
+ * @brief Stack painting at boot and the high-water mark it gives. See stack.h.
+ */
+
+#include "stm32f0xx.h"
+#include "stack.h"
+
+// From stm32f091rc.ld: the lowest address the stack may reach, and the top of SRAM
+extern uint32_t _sstack[], _estack[];
+
+/**
+ * @brief Fill the unused stack with STACK_PAINT. Call once, first thing in main().
+ * @return void
+ */
+void stack_paint(void)
+{
+    uint32_t *top = (uint32_t *)((__get_MSP() - STACK_PAINT_GUARD) & ~3u);
+    for (uint32_t *p = _sstack; p < top; p++)
+        *p = STACK_PAINT;
+}
+
+/* The lowest word the stack has written to. */
+static const uint32_t *low_water(void)
+{
+    const uint32_t *p = _sstack;
+    while (p < _estack && *p == STACK_PAINT)
+        p++;
+    return p;
+}
+
+/**
+ * @brief The deepest the stack has been since stack_paint().
+ * @return Bytes from the top of SRAM down to the lowest word written.
+ */
+uint32_t stack_used(void)
+{
+    return (uint32_t)((const char *)_estack - (const char *)low_water());
+}
+
+/**
+ * @brief How much of the stack has never been touched.
+ * @return Bytes between the heap's reserve and the lowest word written. 0 means the stack has run into it.
+ */
+uint32_t stack_margin(void)
+{
+    return (uint32_t)((const char *)low_water() - (const char *)_sstack);
+}
+
+/**
+ * @brief The room the stack has: from the top of SRAM down to the heap's reserve.
+ * @return Bytes.
+ */
+uint32_t stack_size(void)
+{
+    return (uint32_t)((const char *)_estack - (const char *)_sstack);
+}
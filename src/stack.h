@@ -0,0 +1,33 @@
+#ifndef STACK_H
+#define STACK_H
+
+#include <stdint.h>
+
+/*
+ * Stack high-water tracking. Every handler on the M0 runs on the one main
+ * stack, so a deep frame task preempted by TIM16 and then by an I/O
+ * interrupt stacks all three, and running past the bottom of the stack
+ * silently overwrites the heap and .bss below it.
+ *
+ * stack_paint(), first thing in main(), fills the free SRAM from the top
+ * of the heap's reserve (_sstack in stm32f091rc.ld) up to just under the
+ * current stack pointer with STACK_PAINT. Whatever the stack has since
+ * reached no longer holds the pattern, so stack_used() is the deepest the
+ * stack has ever been and stack_margin() what was never touched below it.
+ * Both scan up from the bottom, a word at a time, so call them from a task
+ * rather than an interrupt handler.
+ *
+ * The declared budget is _Min_Stack_Size in the linker script (and "stack"
+ * in memory_budget.json, which utils/memory_report.py checks the static
+ * estimate against).
+ */
+
+#define STACK_PAINT 0xc5c5c5c5u
+#define STACK_PAINT_GUARD 64 // bytes left unpainted under stack_paint()'s own frame
+
+void stack_paint(void);
+uint32_t stack_used(void);
+uint32_t stack_margin(void);
+uint32_t stack_size(void);
+
+#endif /* STACK_H */
@@ -0,0 +1,406 @@
+/**
+ * @file store.c
+ * @brief Read-only FAT16/FAT32 file store on the SD card. See store.h.
+ */
+
+#include <string.h>
+
+#include "store.h"
+#include "sdcard.h"
+
+StoreStats store_stats;
+
+/* The mounted volume, in blocks from the start of the card */
+static struct
+{
+    uint8_t mounted;
+    uint8_t fat32;
+    uint8_t cluster_shift; // log2 of blocks per cluster
+    uint32_t fat;          // first FAT block
+    uint32_t root;         // FAT16: first root directory block
+    uint32_t root_blocks;  // FAT16: root directory length
+    uint32_t root_cluster; // FAT32: first cluster of the root directory
+    uint32_t data;         // block of cluster 2
+    uint32_t clusters;     // count of data clusters
+} vol;
+
+static struct
+{
+    uint32_t lba;
+    uint32_t used; // stamp of the last use; 0 if empty
+    uint8_t data[SD_BLOCK];
+} cache[STORE_CACHE_BLOCKS];
+static uint32_t stamp;
+
+#define CLUSTER_END 0x0ffffff8 // this and above ends a FAT32 chain (FAT16 values are widened)
+
+static uint16_t get16(const uint8_t *p)
+{
+    return p[0] | p[1] << 8;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return get16(p) | (uint32_t)get16(p + 2) << 16;
+}
+
+/* A block through the cache, or 0 if it could not be read. */
+static const uint8_t *block(uint32_t lba)
+{
+    int victim = 0;
+    for (int i = 0; i < STORE_CACHE_BLOCKS; i++)
+    {
+        if (cache[i].used && cache[i].lba == lba)
+        {
+            cache[i].used = ++stamp;
+            store_stats.hits++;
+            return cache[i].data;
+        }
+        if (cache[i].used < cache[victim].used)
+            victim = i;
+    }
+    store_stats.misses++;
+    cache[victim].used = 0;
+    if (sd_read(lba, 1, cache[victim].data) != SD_OK)
+        return 0;
+    cache[victim].lba = lba;
+    cache[victim].used = ++stamp;
+    return cache[victim].data;
+}
+
+static int cached(uint32_t lba)
+{
+    for (int i = 0; i < STORE_CACHE_BLOCKS; i++)
+        if (cache[i].used && cache[i].lba == lba)
+            return 1;
+    return 0;
+}
+
+/* The FAT entry for a cluster: the next cluster, CLUSTER_END or above at the end, or 0 on error. */
+static uint32_t next_cluster(uint32_t c)
+{
+    uint32_t offset = vol.fat32 ? 4 * c : 2 * c;
+    const uint8_t *b = block(vol.fat + offset / SD_BLOCK);
+    if (!b)
+        return 0;
+    if (vol.fat32)
+        return get32(&b[offset % SD_BLOCK]) & 0x0fffffff;
+    uint32_t e = get16(&b[offset % SD_BLOCK]);
+    return e >= 0xfff8 ? CLUSTER_END : e;
+}
+
+static int valid_cluster(uint32_t c)
+{
+    return c >= 2 && c < vol.clusters + 2;
+}
+
+static uint32_t cluster_block(uint32_t c)
+{
+    return vol.data + ((c - 2) << vol.cluster_shift);
+}
+
+/* Does a block look like a FAT boot sector rather than a partition table? */
+static int boot_sector(const uint8_t *b)
+{
+    uint8_t per_cluster = b[13];
+    return (b[0] == 0xeb || b[0] == 0xe9) && get16(&b[11]) == SD_BLOCK &&
+           per_cluster != 0 && (per_cluster & (per_cluster - 1)) == 0 && (b[16] == 1 || b[16] == 2);
+}
+
+/**
+ * @brief Bring up the card and find the FAT volume on it.
+ * @return STORE_OK, or STORE_ERROR if there is no card or no FAT16/FAT32 volume on it.
+ */
+int8_t store_mount(void)
+{
+    vol.mounted = 0;
+    for (int i = 0; i < STORE_CACHE_BLOCKS; i++)
+        cache[i].used = 0;
+    if (sd_init() != SD_OK)
+        return STORE_ERROR;
+
+    uint32_t start = 0;
+    const uint8_t *b = block(0);
+    if (!b || get16(&b[510]) != 0xaa55)
+        return STORE_ERROR;
+    // a card formatted without a partition table starts with the boot sector; otherwise take the first partition
+    if (!boot_sector(b))
+    {
+        start = get32(&b[446 + 8]);
+        b = block(start);
+        if (!b || !boot_sector(b))
+            return STORE_ERROR;
+    }
+
+    uint32_t per_cluster = b[13];
+    uint32_t reserved = get16(&b[14]);
+    uint32_t fats = b[16];
+    uint32_t root_entries = get16(&b[17]);
+    uint32_t total = get16(&b[19]) ? get16(&b[19]) : get32(&b[32]);
+    uint32_t fat_blocks = get16(&b[22]) ? get16(&b[22]) : get32(&b[36]);
+    vol.cluster_shift = 0;
+    while ((1u << vol.cluster_shift) < per_cluster)
+        vol.cluster_shift++;
+    vol.fat = start + reserved;
+    vol.root = vol.fat + fats * fat_blocks;
+    vol.root_blocks = (root_entries * 32 + SD_BLOCK - 1) / SD_BLOCK;
+    vol.data = vol.root + vol.root_blocks;
+    vol.clusters = (total - (vol.data - start)) >> vol.cluster_shift;
+    if (vol.clusters < 4085)
+        return STORE_ERROR; // FAT12
+    vol.fat32 = vol.clusters >= 65525;
+    vol.root_cluster = vol.fat32 ? get32(&b[44]) : 0;
+    vol.mounted = 1;
+    return STORE_OK;
+}
+
+/* Turn one path component into its 11 character directory form. Returns the rest of the path. */
+static const char *dir_name(const char *path, char name[11])
+{
+    memset(name, ' ', 11);
+    int i = 0;
+    for (; *path && *path != '/'; path++)
+    {
+        char c = *path;
+        if (c == '.' && i > 0 && name[0] != '.') // the dots of "." and ".." are the name
+        {
+            i = 8;
+            continue;
+        }
+        if (c >= 'a' && c <= 'z')
+            c -= 'a' - 'A';
+        if (i < 11)
+            name[i++] = c;
+    }
+    return *path == '/' ? path + 1 : path;
+}
+
+/* Look for a name in one block of directory entries: 1 and *entry if found, -1 at the end of the directory, else 0. */
+static int find_in(const uint8_t *b, const char name[11], const uint8_t **entry)
+{
+    for (int i = 0; i < SD_BLOCK; i += 32)
+    {
+        const uint8_t *e = &b[i];
+        if (e[0] == 0)
+            return -1;
+        if (e[0] == 0xe5 || (e[11] & 0x0f) == 0x0f || (e[11] & 0x08))
+            continue; // deleted, long name or volume label
+        if (memcmp(e, name, 11) == 0)
+        {
+            *entry = e;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Find a name in a directory (cluster 0 for the FAT16 root); copy its entry out. */
+static int8_t lookup(uint32_t dir, const char name[11], uint8_t found[32])
+{
+    const uint8_t *entry;
+    if (dir == 0)
+    {
+        for (uint32_t i = 0; i < vol.root_blocks; i++)
+        {
+            const uint8_t *b = block(vol.root + i);
+            int r = b ? find_in(b, name, &entry) : -1;
+            if (r > 0)
+                goto copy;
+            if (r < 0)
+                return STORE_ERROR;
+        }
+        return STORE_ERROR;
+    }
+    for (uint32_t c = dir; valid_cluster(c); c = next_cluster(c))
+    {
+        for (uint32_t i = 0; i < 1u << vol.cluster_shift; i++)
+        {
+            const uint8_t *b = block(cluster_block(c) + i);
+            int r = b ? find_in(b, name, &entry) : -1;
+            if (r > 0)
+                goto copy;
+            if (r < 0)
+                return STORE_ERROR;
+        }
+    }
+    return STORE_ERROR;
+copy:
+    memcpy(found, entry, 32);
+    return STORE_OK;
+}
+
+/**
+ * @brief Open a file by its 8.3 path, directories separated by '/'.
+ * @param path The path, in any case.
+ * @param f The file to set up.
+ * @return STORE_OK, or STORE_ERROR if it is not there or the store is not mounted.
+ */
+int8_t store_open(const char *path, StoreFile *f)
+{
+    if (!vol.mounted)
+        return STORE_ERROR;
+    uint32_t dir = vol.fat32 ? vol.root_cluster : 0;
+    uint8_t e[32];
+    for (;;)
+    {
+        char name[11];
+        path = dir_name(path, name);
+        if (lookup(dir, name, e) != STORE_OK)
+            return STORE_ERROR;
+        uint32_t cluster = get16(&e[26]) | (vol.fat32 ? (uint32_t)get16(&e[20]) << 16 : 0);
+        if (!*path)
+        {
+            if (e[11] & 0x10)
+                return STORE_ERROR; // a directory
+            f->first_cluster = cluster;
+            break;
+        }
+        if (!(e[11] & 0x10))
+            return STORE_ERROR;
+        dir = cluster ? cluster : (vol.fat32 ? vol.root_cluster : 0); // ".." to the root is 0
+    }
+
+    f->size = get32(&e[28]);
+    f->cluster = f->first_cluster;
+    f->cluster_index = 0;
+    // walk the chain once to see if it is all in a row
+    uint32_t bytes = SD_BLOCK << vol.cluster_shift;
+    uint32_t count = (f->size + bytes - 1) / bytes;
+    uint32_t c = f->first_cluster;
+    f->contiguous = 1;
+    for (uint32_t i = 1; i < count; i++)
+    {
+        uint32_t next = next_cluster(c);
+        if (next != c + 1)
+        {
+            f->contiguous = 0;
+            break;
+        }
+        c = next;
+    }
+    return STORE_OK;
+}
+
+/* The card block holding byte offset of a file, and how many blocks follow it in a row
+   within the file (at least 1). Returns 0 if the chain is broken. */
+static uint32_t file_block(StoreFile *f, uint32_t offset, uint32_t *run)
+{
+    uint32_t per_cluster = 1u << vol.cluster_shift;
+    uint32_t index = offset / SD_BLOCK;
+    uint32_t cluster_index = index >> vol.cluster_shift;
+    uint32_t in_cluster = index & (per_cluster - 1);
+    uint32_t last = (f->size - 1) / SD_BLOCK;
+
+    if (f->contiguous)
+    {
+        *run = last - index + 1;
+        return cluster_block(f->first_cluster) + index;
+    }
+    if (cluster_index < f->cluster_index)
+    {
+        f->cluster = f->first_cluster;
+        f->cluster_index = 0;
+    }
+    while (f->cluster_index < cluster_index)
+    {
+        f->cluster = next_cluster(f->cluster);
+        if (!valid_cluster(f->cluster))
+        {
+            f->cluster = f->first_cluster;
+            f->cluster_index = 0;
+            return 0;
+        }
+        f->cluster_index++;
+    }
+    *run = per_cluster - in_cluster;
+    if (*run > last - index + 1)
+        *run = last - index + 1;
+    return cluster_block(f->cluster) + in_cluster;
+}
+
+/**
+ * @brief Read part of a file.
+ * @param f The file.
+ * @param offset The first byte.
+ * @param n How many bytes.
+ * @param buf Where to put them.
+ * @return The bytes read, fewer than n at the end of the file, or STORE_ERROR if the card failed.
+ */
+int32_t store_read(StoreFile *f, uint32_t offset, uint32_t n, void *buf)
+{
+    uint8_t *out = buf;
+    if (offset >= f->size)
+        return 0;
+    if (n > f->size - offset)
+        n = f->size - offset;
+    uint32_t left = n;
+    while (left > 0)
+    {
+        uint32_t run;
+        uint32_t lba = file_block(f, offset, &run);
+        if (!lba)
+            return STORE_ERROR;
+        uint32_t at = offset % SD_BLOCK;
+        uint32_t whole = left / SD_BLOCK;
+        if (at == 0 && whole > 0 && !cached(lba))
+        {
+            // whole blocks go straight to the caller, up to the first one that is cached
+            if (run > whole)
+                run = whole;
+            for (uint32_t i = 1; i < run; i++)
+                if (cached(lba + i))
+                    run = i;
+            if (sd_read(lba, run, out) != SD_OK)
+                return STORE_ERROR;
+            store_stats.direct += run;
+            run *= SD_BLOCK;
+        }
+        else
+        {
+            const uint8_t *b = block(lba);
+            if (!b)
+                return STORE_ERROR;
+            run = SD_BLOCK - at < left ? SD_BLOCK - at : left;
+            memcpy(out, &b[at], run);
+        }
+        out += run;
+        offset += run;
+        left -= run;
+    }
+    return n;
+}
+
+static int32_t stream_read(void *source, uint32_t offset, uint32_t n, void *out)
+{
+    return store_read(source, offset, n, out);
+}
+
+/**
+ * @brief Open a .565 image file as an asset whose rows are read from the card when drawn.
+ * @param path The file.
+ * @param f The file to set up, which must last as long as the asset.
+ * @param stream The stream to set up, likewise.
+ * @param asset The asset to set up.
+ * @return STORE_OK, or STORE_ERROR if the file is missing or too short for its size.
+ */
+int8_t store_asset(const char *path, StoreFile *f, AssetStream *stream, Asset *asset)
+{
+    uint8_t header[4];
+    if (store_open(path, f) != STORE_OK || store_read(f, 0, 4, header) != 4)
+        return STORE_ERROR;
+    uint16_t width = get16(&header[0]);
+    uint16_t height = get16(&header[2]);
+    if (f->size < 4 + 2 * (uint32_t)width * height)
+        return STORE_ERROR;
+
+    stream->read = stream_read;
+    stream->source = f;
+    stream->base = 4;
+    memset(asset, 0, sizeof *asset);
+    asset->width = width;
+    asset->height = height;
+    asset->format = ASSET_STREAM;
+    asset->key = -1;
+    asset->index = stream;
+    return STORE_OK;
+}
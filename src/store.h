@@ -0,0 +1,57 @@
+#ifndef STORE_H
+#define STORE_H
+
+#include <stdint.h>
+#include "picture.h"
+
+/*
+ * Read-only file store on the SD card: a FAT16 or FAT32 volume, either the
+ * first partition of an MBR or the whole card. Files are found by 8.3 path
+ * ("LEVEL1/BACKGROU.565"); long names are ignored. utils/sdimage.py builds
+ * a card image from the assets.
+ *
+ * Reads go through a cache of STORE_CACHE_BLOCKS blocks, least recently
+ * used first out, which holds the FAT and directory blocks and the ends of
+ * reads that do not cover a whole block. The whole blocks in between are
+ * read straight into the caller's buffer, as many as are consecutive on
+ * the card in one multi-block read. A file whose clusters are all in a
+ * row, as files copied onto a freshly formatted card are, is found to be
+ * so when it is opened, and is then read without looking at the FAT.
+ *
+ * store_asset() opens a .565 file (a little-endian width and height, then
+ * RGB565 rows) as an ASSET_STREAM Asset, which can be drawn like any other
+ * but has its rows read from the card as they are needed.
+ */
+
+#define STORE_CACHE_BLOCKS 4
+
+typedef struct
+{
+    uint32_t first_cluster;
+    uint32_t size; // bytes
+    uint8_t contiguous;
+    // the last cluster looked up, to carry on from when reading forward
+    uint32_t cluster;
+    uint32_t cluster_index;
+} StoreFile;
+
+typedef struct
+{
+    uint32_t hits;   // cache hits
+    uint32_t misses; // cache misses
+    uint32_t direct; // blocks read straight into a caller's buffer
+} StoreStats;
+
+extern StoreStats store_stats;
+
+// Status codes
+#define STORE_OK 0
+#define STORE_ERROR -1
+
+/* Function Prototypes */
+int8_t store_mount(void);
+int8_t store_open(const char *path, StoreFile *f);
+int32_t store_read(StoreFile *f, uint32_t offset, uint32_t n, void *buf);
+int8_t store_asset(const char *path, StoreFile *f, AssetStream *stream, Asset *asset);
+
+#endif /* STORE_H */
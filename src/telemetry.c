@@ -0,0 +1,441 @@
+/**
+ * @file telemetry.c
+ * @brief DMA-driven binary telemetry stream over USART2. See telemetry.h for the record format.
+ */
+
+#include "telemetry.h"
+
+#if TELEMETRY_ENABLE
+
+#if defined(TELEMETRY_HOST)
+#include <stdio.h>
+#include <time.h>
+#else
+#include "stm32f0xx.h"
+#include "utils.h"
+#include "clock.h"
+#include "pins.h"
+#endif
+
+#define RING_MASK (TELEMETRY_RING_SIZE - 1)
+
+/* Producers advance head, the DMA completion advances tail. Both are free-running
+   16-bit counters, so head - tail is always the number of queued bytes. */
+static uint8_t ring[TELEMETRY_RING_SIZE];
+static volatile uint16_t head;
+static volatile uint16_t tail;
+static volatile uint16_t inflight; // bytes handed to the DMA but not yet completed
+static uint8_t seq;
+static volatile uint32_t overflows;
+
+static void kick(void);
+
+#if defined(TELEMETRY_HOST)
+
+#define ENTER_CRITICAL()
+#define EXIT_CRITICAL()
+
+void telemetry_init(void)
+{
+}
+
+uint32_t telemetry_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000u + ts.tv_nsec / 1000);
+}
+
+int telemetry_command(void)
+{
+    return -1;
+}
+
+/* While held, the chunk handed to the "DMA" waits here */
+static int held;
+static const uint8_t *held_buf;
+
+/* On the host the "DMA" completes immediately: write the chunk to stdout. */
+static void start_transfer(const uint8_t *buf, uint16_t n)
+{
+    if (held)
+    {
+        inflight = n;
+        held_buf = buf;
+        return;
+    }
+    fwrite(buf, 1, n, stdout);
+    fflush(stdout);
+    tail += n;
+}
+
+/**
+ * @brief Keep the host's "DMA" busy, or let it finish. While it is held nothing is written and records
+ * queue in the ring until it is full; letting go sends the chunk it held and whatever queued behind it.
+ * @param hold 1 to hold, 0 to let go.
+ * @return void
+ */
+void telemetry_host_hold(int hold)
+{
+    held = hold;
+    if (hold || !inflight)
+        return;
+    fwrite(held_buf, 1, inflight, stdout);
+    fflush(stdout);
+    tail += inflight;
+    inflight = 0;
+    kick();
+}
+
+#else
+
+#define ENTER_CRITICAL()                  \
+    uint32_t primask = __get_PRIMASK(); \
+    __disable_irq()
+#define EXIT_CRITICAL() __set_PRIMASK(primask)
+
+uint32_t telemetry_now(void)
+{
+    return micros();
+}
+
+/**
+ * @brief Take a command byte off USART2 if one has arrived.
+ * @return The byte, or -1 if there is none.
+ */
+int telemetry_command(void)
+{
+    if (USART2->ISR & USART_ISR_ORE)
+        USART2->ICR = USART_ICR_ORECF; // keep receiving after an overrun
+    if (!(USART2->ISR & USART_ISR_RXNE))
+        return -1;
+    return USART2->RDR & 0xff;
+}
+
+static void start_transfer(const uint8_t *buf, uint16_t n)
+{
+    inflight = n;
+    DMA1_Channel4->CCR &= ~DMA_CCR_EN;
+    DMA1_Channel4->CMAR = (uint32_t)buf;
+    DMA1_Channel4->CNDTR = n;
+    DMA1_Channel4->CCR |= DMA_CCR_EN;
+}
+
+/**
+ * @brief Initialize USART2 on PA2/PA3 and DMA1 channel 4 for telemetry transmission.
+ * @return void
+ */
+void telemetry_init(void)
+{
+    // PA2 (TX) and PA3 (RX) in alternate function mode, AF1 is USART2
+    pin_claim(PIN('A', 2), "telemetry");
+    pin_claim(PIN('A', 3), "telemetry");
+    RCC->AHBENR |= RCC_AHBENR_GPIOAEN;
+    GPIOA->MODER &= ~(GPIO_MODER_MODER2 | GPIO_MODER_MODER3);
+    GPIOA->MODER |= GPIO_MODER_MODER2_1 | GPIO_MODER_MODER3_1;
+    GPIOA->AFR[0] &= ~(GPIO_AFRL_AFRL2 | GPIO_AFRL_AFRL3);
+    GPIOA->AFR[0] |= (1 << (4 * 2)) | (1 << (4 * 3));
+
+    // 115200 8N1, transmit through DMA, receive commands by polling
+    RCC->APB1ENR |= RCC_APB1ENR_USART2EN;
+    USART2->CR1 &= ~USART_CR1_UE;
+    USART2->BRR = clock_timing()->usart2_brr;
+    USART2->CR3 |= USART_CR3_DMAT;
+    USART2->CR1 |= USART_CR1_TE | USART_CR1_RE | USART_CR1_UE;
+
+    // DMA1 channel 4 carries USART2_TX: memory to peripheral, byte-wide, interrupt on completion
+    RCC->AHBENR |= RCC_AHBENR_DMA1EN;
+    DMA1_CSELR->CSELR = (DMA1_CSELR->CSELR & ~DMA_CSELR_C4S) | DMA1_CSELR_CH4_USART2_TX;
+    DMA1_Channel4->CCR &= ~DMA_CCR_EN;
+    DMA1_Channel4->CPAR = (uint32_t)&USART2->TDR;
+    DMA1_Channel4->CCR = DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_TCIE;
+    NVIC_EnableIRQ(DMA1_Ch4_7_DMA2_Ch3_5_IRQn);
+}
+
+/**
+ * @brief DMA completion for channels 4-7. Retires the finished chunk and starts the next one.
+ * @return void
+ */
+void DMA1_Ch4_7_DMA2_Ch3_5_IRQHandler(void)
+{
+    if (DMA1->ISR & DMA_ISR_TCIF4)
+    {
+        DMA1->IFCR = DMA_IFCR_CGIF4;
+        DMA1_Channel4->CCR &= ~DMA_CCR_EN;
+
+        ENTER_CRITICAL();
+        tail += inflight;
+        inflight = 0;
+        kick();
+        EXIT_CRITICAL();
+    }
+}
+
+#endif /* TELEMETRY_HOST */
+
+/* Start sending whatever is queued if the DMA is idle. Caller holds the critical section.
+   A chunk never wraps past the end of the ring; the remainder goes out on the next completion. */
+static void kick(void)
+{
+    while (inflight == 0 && head != tail)
+    {
+        uint16_t t = tail & RING_MASK;
+        uint16_t n = (uint16_t)(head - tail);
+        if (n > TELEMETRY_RING_SIZE - t)
+            n = TELEMETRY_RING_SIZE - t;
+        start_transfer(&ring[t], n);
+    }
+}
+
+static uint8_t crc8(uint8_t crc, uint8_t b)
+{
+    crc ^= b;
+    for (int i = 0; i < 8; i++)
+        crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+    return crc;
+}
+
+static void put16(uint8_t *p, uint16_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+/**
+ * @brief Queue one framed record. Never blocks: if the ring is full the record is dropped.
+ * @param type The record type (TLM_*).
+ * @param payload The payload bytes, starting with the u32 timestamp.
+ * @param len The payload length, at most TELEMETRY_MAX_PAYLOAD.
+ * @return void
+ */
+void telemetry_record(uint8_t type, const uint8_t *payload, uint8_t len)
+{
+    uint16_t frame_len = len + 5;
+
+    ENTER_CRITICAL();
+    if ((uint16_t)(TELEMETRY_RING_SIZE - (uint16_t)(head - tail)) < frame_len)
+    {
+        overflows++;
+        seq++; // leave a gap in the sequence so the decoder sees the loss
+        EXIT_CRITICAL();
+        return;
+    }
+
+    uint16_t h = head;
+    uint8_t crc = 0;
+    ring[h++ & RING_MASK] = TELEMETRY_SYNC;
+    ring[h++ & RING_MASK] = type;
+    crc = crc8(crc, type);
+    ring[h++ & RING_MASK] = len;
+    crc = crc8(crc, len);
+    ring[h++ & RING_MASK] = seq;
+    crc = crc8(crc, seq);
+    for (int i = 0; i < len; i++)
+    {
+        ring[h++ & RING_MASK] = payload[i];
+        crc = crc8(crc, payload[i]);
+    }
+    ring[h++ & RING_MASK] = crc;
+    head = h;
+    seq++;
+
+    kick();
+    EXIT_CRITICAL();
+}
+
+/**
+ * @brief Emit the per-frame timing record.
+ * @param frame The frame counter.
+ * @param render_us Time spent rendering the frame.
+ * @param spi_bytes Bytes sent to the LCD during the frame.
+ * @param dropped Frame timer ticks that elapsed while the frame was rendering.
+ * @return void
+ */
+void telemetry_frame(uint16_t frame, uint32_t render_us, uint32_t spi_bytes, uint32_t dropped)
+{
+    uint8_t p[11];
+    put32(&p[0], telemetry_now());
+    put16(&p[4], frame);
+    put16(&p[6], render_us > 0xffff ? 0xffff : render_us);
+    put16(&p[8], spi_bytes > 0xffff ? 0xffff : spi_bytes);
+    p[10] = dropped > 0xff ? 0xff : dropped;
+    telemetry_record(TLM_FRAME, p, sizeof p);
+}
+
+/**
+ * @brief Emit a button edge.
+ * @param pressed Non-zero for a press, zero for a release.
+ * @return void
+ */
+void telemetry_input(int pressed)
+{
+    uint8_t p[5];
+    put32(&p[0], telemetry_now());
+    p[4] = pressed != 0;
+    telemetry_record(TLM_INPUT, p, sizeof p);
+}
+
+/**
+ * @brief Emit a score change.
+ * @param score The new score.
+ * @return void
+ */
+void telemetry_score(int score)
+{
+    uint8_t p[6];
+    put32(&p[0], telemetry_now());
+    put16(&p[4], score);
+    telemetry_record(TLM_SCORE, p, sizeof p);
+}
+
+/**
+ * @brief Emit the latency of an EEPROM operation.
+ * @param op TLM_EEPROM_READ or TLM_EEPROM_WRITE.
+ * @param latency_us How long the operation took.
+ * @param status The EEPROM_OK / EEPROM_ERROR result.
+ * @return void
+ */
+void telemetry_eeprom(int op, uint32_t latency_us, int status)
+{
+    uint8_t p[10];
+    put32(&p[0], telemetry_now());
+    p[4] = op;
+    put32(&p[5], latency_us);
+    p[9] = (uint8_t)status;
+    telemetry_record(TLM_EEPROM, p, sizeof p);
+}
+
+/**
+ * @brief Emit a boot milestone.
+ * @param stage The enum boot_stage value.
+ * @param ts When the milestone was reached.
+ * @return void
+ */
+void telemetry_boot(int stage, uint32_t ts)
+{
+    uint8_t p[5];
+    put32(&p[0], ts);
+    p[4] = stage;
+    telemetry_record(TLM_BOOT, p, sizeof p);
+}
+
+/**
+ * @brief Emit the frame-rate governor's state at the end of a window.
+ * @param period_us The chosen frame period.
+ * @param peak_us The slowest render in the window.
+ * @param misses Frames that have overrun their period so far.
+ * @return void
+ */
+void telemetry_rate(uint32_t period_us, uint32_t peak_us, uint32_t misses)
+{
+    uint8_t p[10];
+    put32(&p[0], telemetry_now());
+    put16(&p[4], period_us > 0xffff ? 0xffff : period_us);
+    put16(&p[6], peak_us > 0xffff ? 0xffff : peak_us);
+    put16(&p[8], misses > 0xffff ? 0xffff : misses);
+    telemetry_record(TLM_RATE, p, sizeof p);
+}
+
+/**
+ * @brief Emit how the last reporting window was spent between running, sleep and stop.
+ * @param window_ms The length of the window.
+ * @param sleep_permille Share of it in sleep mode.
+ * @param stop_permille Share of it in stop mode.
+ * @param est_ua Estimated average supply current over it.
+ * @return void
+ */
+void telemetry_power(uint32_t window_ms, uint32_t sleep_permille, uint32_t stop_permille, uint32_t est_ua)
+{
+    uint8_t p[16];
+    put32(&p[0], telemetry_now());
+    put32(&p[4], window_ms);
+    put16(&p[8], sleep_permille);
+    put16(&p[10], stop_permille);
+    put32(&p[12], est_ua);
+    telemetry_record(TLM_POWER, p, sizeof p);
+}
+
+/**
+ * @brief Emit one kernel's flash versus SRAM timing from ramfunc_bench().
+ * @param kernel The kernel (enum ramfunc_kernel).
+ * @param flash_us Time for the run from flash.
+ * @param sram_us Time for the same run from SRAM.
+ * @param pixels Pixels the run wrote.
+ * @return void
+ */
+void telemetry_ramfunc(int kernel, uint32_t flash_us, uint32_t sram_us, uint32_t pixels)
+{
+    uint8_t p[15];
+    put32(&p[0], telemetry_now());
+    p[4] = kernel;
+    put32(&p[5], flash_us);
+    put32(&p[9], sram_us);
+    put16(&p[13], pixels > 0xffff ? 0xffff : pixels);
+    telemetry_record(TLM_RAMFUNC, p, sizeof p);
+}
+
+/**
+ * @brief Emit the stack high-water mark.
+ * @param used The deepest the stack has been, in bytes.
+ * @param margin Bytes of it never touched.
+ * @return void
+ */
+void telemetry_stack(uint32_t used, uint32_t margin)
+{
+    uint8_t p[8];
+    put32(&p[0], telemetry_now());
+    put16(&p[4], used);
+    put16(&p[6], margin);
+    telemetry_record(TLM_STACK, p, sizeof p);
+}
+
+/**
+ * @brief Emit how much of the frame arena has been needed.
+ * @param peak The most bytes in use at once.
+ * @param size The arena's size in bytes.
+ * @param overflows Allocations it has refused.
+ * @return void
+ */
+void telemetry_arena(uint32_t peak, uint32_t size, uint32_t overflows)
+{
+    uint8_t p[10];
+    put32(&p[0], telemetry_now());
+    put16(&p[4], peak);
+    put16(&p[6], size);
+    put16(&p[8], overflows > 0xffff ? 0xffff : overflows);
+    telemetry_record(TLM_ARENA, p, sizeof p);
+}
+
+/**
+ * @brief Emit the end of a game.
+ * @param score Its final score.
+ * @param autopilot Non-zero if the autopilot played it.
+ * @return void
+ */
+void telemetry_game(int score, int autopilot)
+{
+    uint8_t p[7];
+    put32(&p[0], telemetry_now());
+    put16(&p[4], score);
+    p[6] = autopilot != 0;
+    telemetry_record(TLM_GAME, p, sizeof p);
+}
+
+/**
+ * @brief Number of records dropped because the ring was full.
+ * @return The overflow count.
+ */
+uint32_t telemetry_overflows(void)
+{
+    return overflows;
+}
+
+#endif /* TELEMETRY_ENABLE */
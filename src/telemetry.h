@@ -0,0 +1,106 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+
+/*
+ * Binary telemetry stream on USART2 (PA2 TX, 115200 8N1, the Nucleo's ST-LINK
+ * virtual COM port). Records are queued in a RAM ring and drained by DMA so
+ * that emitting a record never blocks the game loop. utils/telemetry.py
+ * decodes a capture into CSV and summary statistics.
+ *
+ * Record framing (all multi-byte fields little-endian):
+ *
+ *   0xA5 | type | len | seq | payload[len] | crc8
+ *
+ * seq increments per record so the decoder can count records lost to ring
+ * overflow. crc8 (poly 0x07, init 0x00) covers type, len, seq and payload.
+ * Every payload starts with a u32 microsecond timestamp.
+ *
+ * The same port takes single-byte commands the other way (PA3 RX), which
+ * the game polls with telemetry_command(); see TLM_CMD_*.
+ *
+ * Build with -DTELEMETRY_ENABLE=0 to compile every call down to nothing, or
+ * with -DTELEMETRY_HOST to build the encoder on a PC, where records are
+ * written to stdout instead of the USART. There the "DMA" finishes at once
+ * unless telemetry_host_hold(1) keeps it busy, so the ring fills and
+ * overflows as it would behind a slow link.
+ */
+
+#ifndef TELEMETRY_ENABLE
+#define TELEMETRY_ENABLE 1
+#endif
+
+#define TELEMETRY_SYNC 0xA5
+#define TELEMETRY_BAUD 115200
+#define TELEMETRY_RING_SIZE 512 // must be a power of two
+#define TELEMETRY_MAX_PAYLOAD 16
+
+/* Record types */
+#define TLM_FRAME   1  // u32 ts, u16 frame, u16 render_us, u16 spi_bytes, u8 dropped_ticks
+#define TLM_INPUT   2  // u32 ts, u8 pressed
+#define TLM_SCORE   3  // u32 ts, u16 score
+#define TLM_EEPROM  4  // u32 ts, u8 op, u32 latency_us, i8 status
+#define TLM_BOOT    5  // u32 ts, u8 stage (enum boot_stage)
+#define TLM_RATE    6  // u32 ts, u16 period_us, u16 peak_render_us, u16 misses
+#define TLM_POWER   7  // u32 ts, u32 window_ms, u16 sleep_permille, u16 stop_permille, u32 est_ua
+#define TLM_RAMFUNC 8  // u32 ts, u8 kernel (enum ramfunc_kernel), u32 flash_us, u32 sram_us, u16 pixels
+#define TLM_STACK   9  // u32 ts, u16 used, u16 margin (bytes, see stack.h)
+#define TLM_ARENA   10 // u32 ts, u16 peak, u16 size (bytes), u16 overflows (see arena.h)
+#define TLM_GAME    11 // u32 ts, u16 score, u8 autopilot (a demo or soak game)
+
+/* EEPROM operation codes for TLM_EEPROM */
+#define TLM_EEPROM_READ 0
+#define TLM_EEPROM_WRITE 1
+
+/* Commands received on USART2: what the 8-segment displays show */
+#define TLM_CMD_SCORE 's'  // the score (default)
+#define TLM_CMD_RATE 'f'   // the frame rate chosen by the governor
+#define TLM_CMD_MISSES 'm' // frames that overran their period
+#define TLM_CMD_STACK 'k'  // bytes of stack never touched
+
+#if TELEMETRY_ENABLE
+
+void telemetry_init(void);
+void telemetry_record(uint8_t type, const uint8_t *payload, uint8_t len);
+void telemetry_frame(uint16_t frame, uint32_t render_us, uint32_t spi_bytes, uint32_t dropped);
+void telemetry_input(int pressed);
+void telemetry_score(int score);
+void telemetry_eeprom(int op, uint32_t latency_us, int status);
+void telemetry_boot(int stage, uint32_t ts);
+void telemetry_rate(uint32_t period_us, uint32_t peak_us, uint32_t misses);
+void telemetry_power(uint32_t window_ms, uint32_t sleep_permille, uint32_t stop_permille, uint32_t est_ua);
+void telemetry_ramfunc(int kernel, uint32_t flash_us, uint32_t sram_us, uint32_t pixels);
+void telemetry_stack(uint32_t used, uint32_t margin);
+void telemetry_arena(uint32_t peak, uint32_t size, uint32_t overflows);
+void telemetry_game(int score, int autopilot);
+int telemetry_command(void);
+uint32_t telemetry_now(void);
+uint32_t telemetry_overflows(void);
+
+#if defined(TELEMETRY_HOST)
+void telemetry_host_hold(int hold);
+#endif
+
+#else
+
+#define telemetry_init() ((void)0)
+#define telemetry_record(type, payload, len) ((void)0)
+#define telemetry_frame(frame, render_us, spi_bytes, dropped) ((void)0)
+#define telemetry_input(pressed) ((void)0)
+#define telemetry_score(score) ((void)0)
+#define telemetry_eeprom(op, latency_us, status) ((void)0)
+#define telemetry_boot(stage, ts) ((void)0)
+#define telemetry_rate(period_us, peak_us, misses) ((void)0)
+#define telemetry_power(window_ms, sleep_permille, stop_permille, est_ua) ((void)0)
+#define telemetry_ramfunc(kernel, flash_us, sram_us, pixels) ((void)0)
+#define telemetry_stack(used, margin) ((void)0)
+#define telemetry_arena(peak, size, overflows) ((void)0)
+#define telemetry_game(score, autopilot) ((void)0)
+#define telemetry_command() (-1)
+#define telemetry_now() 0u
+#define telemetry_overflows() 0u
+
+#endif /* TELEMETRY_ENABLE */
+
+#endif /* TELEMETRY_H */
@@ -1,5 +1,6 @@
 #include "stm32f0xx.h"
 #include "utils.h"
+#include "clock.h"
 
 void nano_wait(unsigned int n)
 {
@@ -32,4 +33,28 @@ void internal_clock()
     /* Wait till PLL is used as system clock source */
     while ((RCC->CFGR & (uint32_t)RCC_CFGR_SWS) != (uint32_t)RCC_CFGR_SWS_PLL)
         ;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Start TIM2 as a free-running 1 MHz counter used as the microsecond timebase.
+ * @note  TIM2 is the only 32-bit timer on the STM32F091, so it wraps every ~71 minutes.
+ * @return void
+ */
+void timebase_init()
+{
+    RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
+    TIM2->CR1 &= ~TIM_CR1_CEN;
+    TIM2->PSC = clock_timing()->us_psc;
+    TIM2->ARR = 0xffffffff;
+    TIM2->EGR = TIM_EGR_UG; // load the prescaler now instead of at the first overflow
+    TIM2->CR1 |= TIM_CR1_CEN;
+}
+
+/**
+ * @brief Read the microsecond timebase.
+ * @return Microseconds since timebase_init() (wraps around).
+ */
+uint32_t micros()
+{
+    return TIM2->CNT;
+}
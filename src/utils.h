@@ -1,7 +1,11 @@
 #ifndef UTILS_H
 #define UTILS_H
 
+#include <stdint.h>
+
 void nano_wait(unsigned int t);
 void internal_clock();
+void timebase_init();
+uint32_t micros();
 
 #endif /* UTILS_H */
\ No newline at end of file
@@ -0,0 +1,51 @@
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#include <stdio.h>
+
+/*
+ * The checks for the host tests in test/. Each test is one program, built
+ * from its test_*.c and the firmware sources it covers with the host flags
+ * (see utils/hosttest.py). A failed check prints where it is and what it
+ * found, and the test goes on; check_done() prints the tally and gives the
+ * exit status, non-zero if anything failed.
+ */
+
+static int check_count;
+static int check_failures;
+
+/* Note one check. Returns ok, so a test can skip what depends on it. */
+static inline int check_that(int ok, const char *what, const char *file, int line)
+{
+    check_count++;
+    if (!ok)
+    {
+        check_failures++;
+        printf("%s:%d: failed: %s\n", file, line, what);
+    }
+    return ok;
+}
+
+/* Note one check of two integers being equal, printing both if not. */
+static inline int check_equal(long long got, long long want, const char *what, const char *file, int line)
+{
+    check_count++;
+    if (got != want)
+    {
+        check_failures++;
+        printf("%s:%d: failed: %s: got %lld, want %lld\n", file, line, what, got, want);
+    }
+    return got == want;
+}
+
+#define CHECK(cond) check_that((cond) != 0, #cond, __FILE__, __LINE__)
+#define CHECK_EQ(got, want) check_equal((long long)(got), (long long)(want), #got " == " #want, __FILE__, __LINE__)
+
+/* Print the tally for a test program and return its exit status. */
+static inline int check_done(const char *name)
+{
+    printf("%s: %d checks, %d failed\n", name, check_count, check_failures);
+    return check_failures != 0;
+}
+
+#endif /* TEST_CHECK_H */
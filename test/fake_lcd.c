@@ -0,0 +1,285 @@
+/**
+ * @file fake_lcd.c
+ * @brief A fake ILI9341 behind the LCD_HOST hooks, and the host timebase. See fake_lcd.h.
+ */
+
+#include <string.h>
+#include "stm32f0xx.h"
+#include "fake_lcd.h"
+#include "spibus.h"
+#include "clock.h"
+#include "utils.h"
+#include "power.h"
+
+GPIO_TypeDef bench_gpiob;
+SPI_TypeDef bench_spi1;
+
+FakeLcd fake_lcd;
+uint32_t fake_us;
+
+enum
+{
+    IDLE,     // a command's parameters, if any
+    WRITING,  // pixels, after RAMWR or 0x3C
+    READ_RAM, // after RAMRD
+    READ_ID,  // after Read ID4
+};
+
+static struct
+{
+    int selected;
+    int dc;
+    int mode;
+    uint8_t cmd;
+    unsigned int nparam;
+    uint8_t param[4];
+    unsigned int xs, xe, ys, ye; // the window
+    unsigned int col, page;      // the cursor
+    int half;                    // the first byte of a pixel sent 8 bits at a time, or -1
+    unsigned int nread;          // bytes read since the read command
+} ctl;
+
+static void chip_select(uint8_t pin, int selected)
+{
+    if (pin != FAKE_LCD_CS)
+        return;
+    if (!selected)
+        ctl.mode = IDLE; // ends a write or read
+    ctl.selected = selected;
+}
+
+/**
+ * @brief Power the fake up again: GRAM black, the full window, nothing counted or logged.
+ * Also hooks the fake onto the chip select. max_hz, bad_reads and logging are kept.
+ * @return void
+ */
+void fake_lcd_reset(void)
+{
+    uint32_t max_hz = fake_lcd.max_hz;
+    uint8_t bad_reads = fake_lcd.bad_reads;
+    int logging = fake_lcd.logging;
+    memset(&fake_lcd, 0, sizeof fake_lcd);
+    fake_lcd.max_hz = max_hz;
+    fake_lcd.bad_reads = bad_reads;
+    fake_lcd.logging = logging;
+    int selected = ctl.selected;
+    memset(&ctl, 0, sizeof ctl);
+    ctl.selected = selected;
+    ctl.xe = LCD_W - 1;
+    ctl.ye = LCD_H - 1;
+    ctl.half = -1;
+    spibus_host.chip_select = chip_select;
+}
+
+/**
+ * @brief The clock SPI1 runs at, from the divisor in the register fake.
+ * @return The SCK frequency.
+ */
+uint32_t fake_lcd_hz(void)
+{
+    uint32_t br = (spibus_host.spi.CR1 >> 3) & 7;
+    return clock_timing()->sysclk_hz >> (br + 1);
+}
+
+/**
+ * @brief Set every pixel of GRAM, without going through the SPI.
+ * @param c The color.
+ * @return void
+ */
+void fake_lcd_fill(u16 c)
+{
+    for (int y = 0; y < LCD_H; y++)
+        for (int x = 0; x < LCD_W; x++)
+            fake_lcd.gram[y][x] = c;
+}
+
+static void advance(void)
+{
+    if (ctl.col < ctl.xe)
+    {
+        ctl.col++;
+        return;
+    }
+    ctl.col = ctl.xs;
+    ctl.page = ctl.page < ctl.ye ? ctl.page + 1 : ctl.ys;
+}
+
+static void pixel(u16 c)
+{
+    fake_lcd.pixels++;
+    if (fake_lcd.max_hz && fake_lcd_hz() > fake_lcd.max_hz)
+    {
+        c ^= 1;
+        fake_lcd.corrupted++;
+    }
+    if (ctl.col < LCD_W && ctl.page < LCD_H)
+        fake_lcd.gram[ctl.page][ctl.col] = c;
+    else
+        fake_lcd.dropped++;
+    advance();
+}
+
+static void command(uint8_t b)
+{
+    fake_lcd.commands++;
+    ctl.cmd = b;
+    ctl.nparam = 0;
+    ctl.nread = 0;
+    ctl.half = -1;
+    ctl.mode = IDLE;
+    switch (b)
+    {
+    case 0x2C: // Memory Write
+        ctl.col = ctl.xs;
+        ctl.page = ctl.ys;
+        ctl.mode = WRITING;
+        break;
+    case 0x3C: // Memory Write Continue
+        ctl.mode = WRITING;
+        break;
+    case 0x2E: // Memory Read
+        ctl.col = ctl.xs;
+        ctl.page = ctl.ys;
+        ctl.mode = READ_RAM;
+        break;
+    case 0xD3: // Read ID4
+        ctl.mode = READ_ID;
+        break;
+    case 0x10: // Sleep IN
+        fake_lcd.sleeping = 1;
+        break;
+    case 0x11: // Sleep OUT
+        fake_lcd.sleeping = 0;
+        break;
+    case 0x28: // Display OFF
+        fake_lcd.display_on = 0;
+        break;
+    case 0x29: // Display ON
+        fake_lcd.display_on = 1;
+        break;
+    }
+}
+
+static void parameter(uint8_t b)
+{
+    if (ctl.nparam < sizeof ctl.param)
+        ctl.param[ctl.nparam] = b;
+    ctl.nparam++;
+    unsigned int from = ctl.param[0] << 8 | ctl.param[1];
+    unsigned int to = ctl.param[2] << 8 | ctl.param[3];
+    if (ctl.cmd == 0x2A && ctl.nparam == 4)
+    {
+        ctl.xs = from;
+        ctl.xe = to;
+    }
+    else if (ctl.cmd == 0x2B && ctl.nparam == 4)
+    {
+        ctl.ys = from;
+        ctl.ye = to;
+    }
+    else if (ctl.cmd == 0x36 && ctl.nparam == 1)
+    {
+        fake_lcd.madctl = b;
+    }
+}
+
+static void receive(uint8_t b)
+{
+    if (!ctl.selected)
+    {
+        fake_lcd.deselected++;
+        return;
+    }
+    fake_lcd.bytes++;
+    if (fake_lcd.logging && fake_lcd.log_len < FAKE_LCD_LOG)
+        fake_lcd.log[fake_lcd.log_len++] = (FakeLcdByte){b, (uint8_t)ctl.dc, fake_us};
+
+    if (!ctl.dc)
+        command(b);
+    else if (ctl.mode == WRITING && ctl.half < 0)
+        ctl.half = b;
+    else if (ctl.mode == WRITING)
+    {
+        pixel((u16)(ctl.half << 8 | b));
+        ctl.half = -1;
+    }
+    else
+        parameter(b);
+}
+
+/* DC is whichever of set or reset the last write to GPIOB's BSRR gave PB14, if it gave it either. */
+static void sample_dc(void)
+{
+    uint32_t v = bench_gpiob.BSRR;
+    if (v & GPIO_BSRR_BS_14)
+        ctl.dc = 1;
+    else if (v & GPIO_BSRR_BR_14)
+        ctl.dc = 0;
+}
+
+void lcd_host_put(u16 data, int wide)
+{
+    sample_dc();
+    if (wide)
+        receive(data >> 8);
+    receive((uint8_t)data);
+}
+
+void lcd_host_dma(const void *buf, unsigned int count, int wide, int increment)
+{
+    const uint8_t *b8 = buf;
+    const u16 *b16 = buf;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        unsigned int at = increment ? i : 0;
+        lcd_host_put(wide ? b16[at] : b8[at], wide);
+    }
+}
+
+u8 lcd_host_get(void)
+{
+    sample_dc();
+    if (!ctl.selected)
+        return 0xff;
+    fake_lcd.bytes++;
+    unsigned int n = ctl.nread++;
+    if (ctl.mode == READ_ID)
+    {
+        static const uint8_t id[] = {0xff, 0x00, 0x93, 0x41};
+        return n < sizeof id ? id[n] : 0;
+    }
+    if (ctl.mode != READ_RAM || n == 0)
+        return 0xff; // the dummy byte, or nothing to read
+    u16 c = ctl.col < LCD_W && ctl.page < LCD_H ? fake_lcd.gram[ctl.page][ctl.col] : 0;
+    if (fake_lcd.bad_reads)
+        c ^= 1;
+    int part = (n - 1) % 3;
+    if (part == 2)
+        advance();
+    if (part == 0)
+        return (c >> 11) << 3;
+    if (part == 1)
+        return ((c >> 5) & 0x3f) << 2;
+    return (c & 0x1f) << 3;
+}
+
+/* The display's pins are the GPIOB stand-in; SPI1 is the bus's register fake */
+void init_lcd_spi(void)
+{
+    spibus_init();
+}
+
+uint32_t micros(void)
+{
+    return fake_us++;
+}
+
+void nano_wait(unsigned int t)
+{
+    fake_us += t / 1000;
+}
+
+void delay_ms(uint32_t ms)
+{
+    fake_us += ms * 1000;
+}
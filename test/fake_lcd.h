@@ -0,0 +1,77 @@
+#ifndef TEST_FAKE_LCD_H
+#define TEST_FAKE_LCD_H
+
+#include <stdint.h>
+#include "lcd.h"
+
+/*
+ * A fake ILI9341 on the host build's SPI1, for the tests that drive
+ * src/lcd.c. It takes the byte stream lcd.c hands to lcd_host_put() and
+ * lcd_host_dma(), with DC from the GPIOB stand-in (bench/stm32f0xx.h) and
+ * its chip select (PB8) from the spibus register fake, and does what the
+ * controller would with it:
+ *
+ *   CASET, PASET   set the column and page window, once all 4 bytes are in
+ *   RAMWR (0x2C)   writes pixels from the window's top left corner
+ *   0x3C           writes pixels on from where the last write stopped
+ *   RAMRD (0x2E)   a dummy byte, then 3 bytes a pixel (6 bits each, left
+ *                  aligned) from the window's top left corner
+ *   Read ID4       a dummy byte, then 0x00 0x93 0x41
+ *
+ * Pixels run along a row of the window, then down, and back to the top
+ * left after the last one. GRAM is portrait, 240 x 320; MADCTL rotation is
+ * not modelled, since the game runs at rotation 0. A pixel outside GRAM is
+ * dropped, and deselecting ends a write or read, as on the real part.
+ *
+ * With max_hz set, a pixel written while SPI1's clock (from the divisor in
+ * the CR1 fake) is above it comes out with its low bit flipped, as a
+ * module that cannot keep up would show. Commands and parameters are
+ * short and get through. With bad_reads set, GRAM is written intact but
+ * RAMRD reads it back wrong.
+ *
+ * The fake also supplies the host build's timebase: micros() is a count
+ * that goes up 1 us every call, and nano_wait() and delay_ms() add to it,
+ * so delays take no real time but their order and length can be checked.
+ * With logging on, every byte is kept in log[] with DC and the time.
+ */
+
+#define FAKE_LCD_CS PIN('B', 8)
+#define FAKE_LCD_LOG 4096 // bytes kept in log[]
+
+typedef struct
+{
+    uint8_t byte;
+    uint8_t dc; // 1 for data, 0 for a command
+    uint32_t us;
+} FakeLcdByte;
+
+typedef struct
+{
+    u16 gram[LCD_H][LCD_W];
+    uint32_t max_hz; // pixels written faster than this are corrupted; 0 for no limit
+    uint8_t bad_reads; // RAMRD gives every pixel back with its low bit flipped, as a noisy MISO would
+
+    uint32_t bytes;      // bytes received while selected
+    uint32_t pixels;     // pixels written, including dropped ones
+    uint32_t dropped;    // pixels outside GRAM
+    uint32_t corrupted;  // pixels written too fast
+    uint32_t deselected; // bytes sent with the chip select high, which are lost
+    uint32_t commands;
+    uint8_t sleeping;   // after Sleep IN, until Sleep OUT
+    uint8_t display_on; // after Display ON, until Display OFF
+    uint8_t madctl;
+
+    int logging;
+    unsigned int log_len;
+    FakeLcdByte log[FAKE_LCD_LOG];
+} FakeLcd;
+
+extern FakeLcd fake_lcd;
+extern uint32_t fake_us; // what micros() returns next
+
+/* Function Prototypes */
+void fake_lcd_reset(void);
+uint32_t fake_lcd_hz(void);
+void fake_lcd_fill(u16 c);
+
+#endif /* TEST_FAKE_LCD_H */
@@ -0,0 +1,112 @@
+/**
+ * @file test_arena.c
+ * @brief Host test of src/arena.c: marks and releases nesting, running out of room, and alignment.
+ */
+
+#include <stdint.h>
+#include "check.h"
+#include "arena.h"
+
+/* Marks taken inside one another give back exactly what was taken after them. */
+static void test_nesting(void)
+{
+    static uint32_t mem[64];
+    Arena a;
+    arena_init(&a, mem, sizeof mem);
+
+    uint32_t outer = arena_mark(&a);
+    CHECK_EQ(outer, 0);
+    void *p = arena_alloc(&a, 10);
+    CHECK(p == (uint8_t *)mem);
+    CHECK_EQ(a.used, 12);
+
+    uint32_t inner = arena_mark(&a);
+    void *q = arena_alloc(&a, 20);
+    CHECK(q == (uint8_t *)mem + 12);
+    uint32_t innermost = arena_mark(&a);
+    arena_alloc(&a, 4);
+    CHECK_EQ(a.used, 36);
+
+    arena_release(&a, innermost);
+    CHECK_EQ(a.used, 32);
+    arena_release(&a, inner);
+    CHECK_EQ(a.used, 12);
+    // what the inner frame had is handed out again
+    CHECK(arena_alloc(&a, 8) == q);
+    arena_release(&a, outer);
+    CHECK_EQ(a.used, 0);
+    CHECK_EQ(a.peak, 36);
+
+    // a mark from before a reset, or one released twice, never raises the use
+    arena_alloc(&a, 16);
+    uint32_t stale = arena_mark(&a);
+    arena_reset(&a);
+    arena_release(&a, stale);
+    CHECK_EQ(a.used, 0);
+    CHECK_EQ(a.overflows, 0);
+}
+
+/* The frame arena holds FRAME_ARENA_SIZE bytes; past that, allocations fail and are counted. */
+static void test_overflow(void)
+{
+    arena_reset(&frame_arena);
+    CHECK_EQ(frame_arena.size, 2048);
+    uint32_t mark = arena_mark(&frame_arena);
+
+    // three full-width rows, as asset_compose() takes, fit
+    for (int i = 0; i < 3; i++)
+        CHECK(arena_picture(&frame_arena, LCD_W, 1) != 0);
+    CHECK(frame_arena.used <= FRAME_ARENA_SIZE);
+
+    uint32_t left = FRAME_ARENA_SIZE - frame_arena.used;
+    CHECK(arena_alloc(&frame_arena, left + 1) == 0);
+    CHECK_EQ(frame_arena.overflows, 1);
+    CHECK(arena_alloc(&frame_arena, left) != 0);
+    CHECK_EQ(frame_arena.used, FRAME_ARENA_SIZE);
+    CHECK(arena_line(&frame_arena, 1) == 0);
+    CHECK(arena_picture(&frame_arena, 1, 1) == 0);
+    CHECK_EQ(frame_arena.overflows, 3);
+    CHECK_EQ(frame_arena.peak, FRAME_ARENA_SIZE);
+
+    // a request bigger than the arena, and one whose rounding would wrap, fail without changing the use
+    arena_release(&frame_arena, mark);
+    CHECK(arena_alloc(&frame_arena, FRAME_ARENA_SIZE + 1) == 0);
+    CHECK(arena_alloc(&frame_arena, UINT32_MAX - 1) == 0);
+    CHECK_EQ(frame_arena.used, 0);
+
+    // a reset keeps the statistics
+    arena_reset(&frame_arena);
+    CHECK_EQ(frame_arena.peak, FRAME_ARENA_SIZE);
+    CHECK_EQ(frame_arena.overflows, 5);
+}
+
+/* Rows of any length come back 4-byte aligned, so the next one is too. */
+static void test_alignment(void)
+{
+    static uint32_t mem[256];
+    Arena a = ARENA(mem);
+    uintptr_t last = 0;
+    for (unsigned int n = 0; n < 12; n++)
+    {
+        u16 *row = arena_line(&a, n);
+        if (!CHECK(row != 0))
+            return;
+        CHECK_EQ((uintptr_t)row % ARENA_ALIGN, 0);
+        CHECK_EQ(a.used % ARENA_ALIGN, 0);
+        if (last)
+            CHECK_EQ((uintptr_t)row - last, (2 * (n - 1) + 3) & ~3u);
+        last = (uintptr_t)row;
+    }
+    Picture *pic = arena_picture(&a, 3, 1);
+    CHECK_EQ((uintptr_t)pic % ARENA_ALIGN, 0);
+    CHECK_EQ(pic->width, 3);
+    CHECK_EQ(pic->bytes_per_pixel, 2);
+}
+
+int main(void)
+{
+    test_nesting();
+    test_overflow();
+    test_alignment();
+    return check_done("arena");
+}
@@ -0,0 +1,162 @@
+/**
+ * @file test_assetc.c
+ * @brief Host round trip of utils/assetc.py and src/picture.c: sprites compiled into each storage
+ * format, and the firmware's own assets, decode to the pixels of their PNGs, whole rows and part rows,
+ * hit-test where they are opaque, and overlay and subset with clipping.
+ */
+
+#include <stdlib.h>
+#include "check.h"
+#include "picture.h"
+
+/* An asset and what its PNG says it holds: the RGB565 pixels, and which of them are opaque */
+typedef struct
+{
+    const char *name;
+    const Asset *asset;
+    const unsigned short *want;
+    const unsigned char *solid;
+    int format; // the format it was forced into, or -1
+} RoundTrip;
+
+/* Made from the PNGs by utils/hostfixtures.py */
+#include "asset_round_trip.h"
+
+#define N_ROUND_TRIPS (sizeof round_trips / sizeof round_trips[0])
+
+#define DST_W 23
+#define DST_H 19
+#define BACKDROP 0x5aa5
+
+static struct
+{
+    Picture pic;
+    u16 pixels[DST_W * DST_H];
+} dst = {{DST_W, DST_H, 2}, {0}};
+
+/* Report the first pixel of an asset that is wrong, once */
+static int wrong(const RoundTrip *t, const char *what, int x, int y, unsigned int got, unsigned int want)
+{
+    check_that(0, what, __FILE__, __LINE__);
+    printf("    %s (%dx%d): (%d,%d) is 0x%04x, want 0x%04x\n", t->name, t->asset->width, t->asset->height, x, y,
+           got, want);
+    return 1;
+}
+
+static void test_rows(const RoundTrip *t)
+{
+    const Asset *a = t->asset;
+    unsigned short row[320];
+
+    if (t->format >= 0)
+        CHECK_EQ(a->format, t->format);
+    for (int y = 0; y < a->height; y++)
+    {
+        asset_row(a, 0, y, a->width, row);
+        for (int x = 0; x < a->width; x++)
+            if (row[x] != t->want[y * a->width + x])
+                if (wrong(t, "whole rows decode to the PNG", x, y, row[x], t->want[y * a->width + x]))
+                    return;
+    }
+
+    // part rows, starting and ending anywhere, as the compositor asks for them
+    srand(32);
+    for (int i = 0; i < 500; i++)
+    {
+        int y = rand() % a->height, x = rand() % a->width, n = 1 + rand() % (a->width - x);
+        asset_row(a, x, y, n, row);
+        for (int k = 0; k < n; k++)
+            if (row[k] != t->want[y * a->width + x + k])
+                if (wrong(t, "part rows decode to the PNG", x + k, y, row[k], t->want[y * a->width + x + k]))
+                    return;
+    }
+}
+
+static void test_derived(const RoundTrip *t)
+{
+    const Asset *a = t->asset;
+    for (int y = 0; y < a->height; y++)
+        for (int x = 0; x < a->width; x++)
+            if (asset_hit(a, x, y) != t->solid[y * a->width + x])
+                if (wrong(t, "hits where the PNG is opaque", x, y, asset_hit(a, x, y), t->solid[y * a->width + x]))
+                    return;
+    CHECK(!asset_hit(a, -1, 0));
+    CHECK(!asset_hit(a, a->width, a->height - 1));
+
+    if (!a->spans)
+        return;
+    for (int y = 0; y < a->height; y++)
+    {
+        int first = -1, last = -1;
+        for (int x = 0; x < a->width; x++)
+            if (t->solid[y * a->width + x])
+            {
+                if (first < 0)
+                    first = x;
+                last = x;
+            }
+        if (first < 0)
+            CHECK(a->spans[2 * y + 1] < a->spans[2 * y]); // an empty row
+        else if (a->spans[2 * y] != first || a->spans[2 * y + 1] != last)
+            if (wrong(t, "spans are the opaque columns", a->spans[2 * y], y, a->spans[2 * y + 1], last))
+                return;
+    }
+}
+
+/* Overlay and subset at offset (ox, oy) into a picture smaller than some assets, so they clip */
+static void test_placed(const RoundTrip *t, int ox, int oy)
+{
+    const Asset *a = t->asset;
+
+    for (int i = 0; i < DST_W * DST_H; i++)
+        dst.pic.pix2[i] = BACKDROP;
+    asset_overlay(&dst.pic, ox, oy, a, 0);
+    for (int y = 0; y < DST_H; y++)
+        for (int x = 0; x < DST_W; x++)
+        {
+            int sx = x - ox, sy = y - oy;
+            unsigned int want = BACKDROP;
+            if (sx >= 0 && sy >= 0 && sx < a->width && sy < a->height && t->solid[sy * a->width + sx])
+                want = t->want[sy * a->width + sx];
+            if (dst.pic.pix2[y * DST_W + x] != want)
+                if (wrong(t, "overlay draws just the opaque pixels", sx, sy, dst.pic.pix2[y * DST_W + x], want))
+                    return;
+        }
+
+    // subset reads from (sx, sy) of the asset, the other way round
+    for (int i = 0; i < DST_W * DST_H; i++)
+        dst.pic.pix2[i] = BACKDROP;
+    asset_subset(&dst.pic, a, -ox, -oy);
+    for (int y = 0; y < DST_H; y++)
+        for (int x = 0; x < DST_W; x++)
+        {
+            int sx = x - ox, sy = y - oy;
+            unsigned int want = BACKDROP;
+            if (sx >= 0 && sy >= 0 && sx < a->width && sy < a->height)
+                want = t->want[sy * a->width + sx];
+            if (dst.pic.pix2[y * DST_W + x] != want)
+                if (wrong(t, "subset copies every pixel", sx, sy, dst.pic.pix2[y * DST_W + x], want))
+                    return;
+        }
+}
+
+int main(void)
+{
+    for (unsigned int i = 0; i < N_ROUND_TRIPS; i++)
+    {
+        const RoundTrip *t = &round_trips[i];
+        test_rows(t);
+        test_derived(t);
+        int w = t->asset->width, h = t->asset->height;
+        test_placed(t, 0, 0);
+        test_placed(t, 3, 2);
+        test_placed(t, -5, -4);
+        test_placed(t, DST_W - w / 2, DST_H - h / 2);
+        test_placed(t, -(w - 1), 1);
+        test_placed(t, -(w / 3), -(h / 2)); // well inside a large asset
+        test_placed(t, DST_W + 3, DST_H - 1); // wholly off the right
+        test_placed(t, 1, DST_H);
+    }
+    CHECK(N_ROUND_TRIPS > 8);
+    return check_done("assetc");
+}
@@ -0,0 +1,109 @@
+/**
+ * @file test_clock.c
+ * @brief Host test of src/clock.c: the settings derived at 8 and 48 MHz, and the timers clock_set() re-times.
+ */
+
+#include "check.h"
+#include "clock.h"
+
+static void test_derive_8mhz(void)
+{
+    ClockTiming t;
+    clock_derive(8000000, &t);
+    CHECK_EQ(t.sysclk_hz, 8000000);
+    CHECK_EQ(t.i2c1_timingr, 0x10420F13); // RM0091's 100 kHz value for an 8 MHz I2C clock
+    CHECK_EQ(t.us_psc, 7);
+    CHECK_EQ(t.tim16_psc, 499);
+    CHECK_EQ(t.systick_reload, 8000);
+    CHECK_EQ(t.usart2_brr, 69); // 115942 baud, 0.6% fast
+    CHECK_EQ(t.spi2_br, 5);     // 125 kHz
+    CHECK_EQ(t.flash_latency, 0);
+}
+
+static void test_derive_48mhz(void)
+{
+    ClockTiming t;
+    clock_derive(48000000, &t);
+    CHECK_EQ(t.sysclk_hz, 48000000);
+    CHECK_EQ(t.i2c1_timingr, 0x10420F13); // I2C1 runs from the HSI in every profile
+    CHECK_EQ(t.us_psc, 47);
+    CHECK_EQ(t.tim16_psc, 2999);
+    CHECK_EQ(t.systick_reload, 48000);
+    CHECK_EQ(t.usart2_brr, 417); // 115108 baud, 0.08% slow
+    CHECK_EQ(t.spi2_br, 7);      // 187.5 kHz
+    CHECK_EQ(t.flash_latency, 1);
+
+    // the counts come out at the same rates as at 8 MHz
+    ClockTiming low;
+    clock_derive(8000000, &low);
+    CHECK_EQ(48000000 / (t.us_psc + 1), 8000000 / (low.us_psc + 1));
+    CHECK_EQ(48000000 / (t.tim16_psc + 1), CLOCK_TIM16_HZ);
+    CHECK_EQ(8000000 / (low.tim16_psc + 1), CLOCK_TIM16_HZ);
+}
+
+static void test_spi_br(void)
+{
+    CHECK_EQ(clock_spi_br(48000000, CLOCK_SPI1_FAST_HZ), 0);
+    CHECK_EQ(clock_spi_br(48000000, CLOCK_SPI1_HZ), 1);
+    CHECK_EQ(clock_spi_br(48000000, CLOCK_SPI1_SLOW_HZ), 7);
+    CHECK_EQ(clock_spi_br(8000000, CLOCK_SPI1_HZ), 0); // 4 MHz is as fast as it goes
+    CHECK_EQ(clock_spi_br(8000000, CLOCK_SPI1_SLOW_HZ), 5);
+    CHECK_EQ(clock_spi_br(48000000, 1000), 7); // nothing slow enough: the slowest there is
+}
+
+/* Set a timer up as running, part way through a count */
+static void running(ClockHostTimer *tim, uint32_t cnt)
+{
+    tim->CR1 = 1; // CEN
+    tim->PSC = 0;
+    tim->CNT = cnt;
+    tim->EGR = 0;
+}
+
+static void check_retimed(const ClockHostTimer *tim, uint32_t psc, uint32_t cnt)
+{
+    CHECK_EQ(tim->PSC, psc);
+    CHECK_EQ(tim->EGR, 1);  // UG, to load the prescaler now
+    CHECK_EQ(tim->CNT, cnt); // the count is kept
+    CHECK_EQ(tim->CR1, 1);   // URS is only set for the update
+}
+
+static void test_retime(void)
+{
+    clock_init();
+    CHECK_EQ(clock_profile(), CLOCK_FULL);
+    CHECK_EQ(clock_timing()->sysclk_hz, 48000000);
+
+    running(&clock_host.tim2, 123456);
+    running(&clock_host.tim16, 17);
+    running(&clock_host.tim17, 9999);
+    clock_set(CLOCK_LOW);
+    CHECK_EQ(clock_profile(), CLOCK_LOW);
+    CHECK_EQ(clock_timing()->sysclk_hz, 8000000);
+    check_retimed(&clock_host.tim2, 7, 123456);
+    check_retimed(&clock_host.tim16, 499, 17);
+    check_retimed(&clock_host.tim17, 7, 9999);
+
+    // the same profile again changes nothing
+    clock_host.tim2.EGR = 0;
+    clock_set(CLOCK_LOW);
+    CHECK_EQ(clock_host.tim2.EGR, 0);
+
+    running(&clock_host.tim2, 5);
+    running(&clock_host.tim16, 6);
+    running(&clock_host.tim17, 7);
+    clock_set(CLOCK_FULL);
+    check_retimed(&clock_host.tim2, 47, 5);
+    check_retimed(&clock_host.tim16, 2999, 6);
+    check_retimed(&clock_host.tim17, 47, 7);
+    CHECK_EQ(clock_timing()->flash_latency, 1);
+}
+
+int main(void)
+{
+    test_derive_8mhz();
+    test_derive_48mhz();
+    test_spi_br();
+    test_retime();
+    return check_done("clock");
+}
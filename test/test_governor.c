@@ -0,0 +1,134 @@
+/**
+ * @file test_governor.c
+ * @brief Host test of src/governor.c: a synthetic render cost drives it up and down the ladder.
+ */
+
+#include "check.h"
+#include "governor.h"
+#include "physics.h"
+
+#define STEP_US (1000000 / PHYS_HZ)
+
+static const uint32_t ladder[GOV_LEVELS] = {7812, 15625, 31250, 46875, 62500};
+
+/*
+ * The render cost model: a frame with n barriers on screen takes 1 ms plus
+ * 5.5 ms a barrier, give or take 0.2 ms. Each even count needs its own rung
+ * with the governor's 1/8 headroom, and fits it with another 1/8 to spare
+ * on the way back down: 0 at 7812 us, 2 at 15625, 4 at 31250, 6 at 46875
+ * and 8 at 62500.
+ */
+static uint32_t render_cost(int n, unsigned int frame)
+{
+    return 1000 + 5500 * n + frame * 37 % 200;
+}
+
+static const int rung_for[] = {0, -1, 1, -1, 2, -1, 3, -1, 4};
+
+static void test_ladder(void)
+{
+    CHECK_EQ(STEP_US, 15625);
+    Governor g;
+    governor_reset(&g);
+    CHECK_EQ(g.level, GOV_START);
+    CHECK_EQ(g.period_us, ladder[GOV_START]);
+    CHECK_EQ(governor_rate(&g), 64);
+}
+
+/* Barriers come on one pair at a time and go again, four windows a count */
+static void test_ramp(void)
+{
+    static const int ramp[] = {0, 2, 4, 6, 8, 6, 4, 2, 0};
+    Governor g;
+    governor_reset(&g);
+    unsigned int frame = 0;
+    unsigned int changed_at = 0;
+    int visited[GOV_LEVELS] = {0};
+
+    for (unsigned int i = 0; i < sizeof ramp / sizeof ramp[0]; i++)
+    {
+        int n = ramp[i];
+        int up = i > 0 && n > ramp[i - 1];
+        uint32_t misses = g.misses;
+        for (int f = 0; f < 4 * GOV_WINDOW; f++, frame++)
+        {
+            int before = g.level;
+            if (!governor_frame(&g, render_cost(n, frame)))
+            {
+                CHECK_EQ(g.level, before);
+                continue;
+            }
+            CHECK_EQ(g.period_us, ladder[g.level]);
+            if (up)
+            {
+                // heavier: straight up, within a window, or on the second miss if it overruns
+                CHECK(g.level > before);
+                CHECK(f < GOV_WINDOW);
+            }
+            else
+            {
+                // lighter: one rung at a time, after GOV_CALM windows that fit the faster one
+                CHECK_EQ(g.level, before - 1);
+                CHECK(frame + 1 - changed_at >= GOV_CALM * GOV_WINDOW);
+            }
+            changed_at = frame + 1;
+        }
+        visited[g.level] = 1;
+        CHECK_EQ(g.level, rung_for[n]);
+        // a heavier scene costs at most two misses, not a window of them
+        CHECK(g.misses - misses <= (up ? 2 : 0));
+    }
+    for (int level = 0; level < GOV_LEVELS; level++)
+        CHECK(visited[level]);
+}
+
+/* A render that fits the faster rung, but without 1/8 to spare, does not speed up: no flapping at the edge */
+static void test_hysteresis(void)
+{
+    Governor g;
+    governor_reset(&g);
+    for (int f = 0; f < 2; f++)
+        governor_frame(&g, 17500); // need 19687: up to 31250
+    CHECK_EQ(g.level, 2);
+
+    // need 14625 would fit 15625, but 14625 + 1/8 does not
+    for (int f = 0; f < 100 * GOV_WINDOW; f++)
+        CHECK_EQ(governor_frame(&g, 13000), 0);
+    CHECK_EQ(g.level, 2);
+    CHECK_EQ(g.calm, 0);
+
+    // one window that fits, then one that does not, starts the count again
+    for (int f = 0; f < GOV_WINDOW; f++)
+        governor_frame(&g, 10000);
+    CHECK_EQ(g.calm, 1);
+    for (int f = 0; f < GOV_WINDOW; f++)
+        governor_frame(&g, 13000);
+    CHECK_EQ(g.calm, 0);
+    CHECK_EQ(g.level, 2);
+    for (int f = 0; f < GOV_CALM * GOV_WINDOW; f++)
+        governor_frame(&g, 10000);
+    CHECK_EQ(g.level, 1);
+    CHECK_EQ(g.misses, 2);
+}
+
+/* One slow frame a window is a miss, not a change of rate */
+static void test_outlier(void)
+{
+    Governor g;
+    governor_reset(&g);
+    for (int w = 0; w < 10; w++)
+        for (int f = 0; f < GOV_WINDOW; f++)
+            CHECK_EQ(governor_frame(&g, f == 5 ? 40000 : 12000), 0);
+    CHECK_EQ(g.level, GOV_START);
+    CHECK_EQ(g.misses, 10);
+    CHECK_EQ(g.last_peak, 40000);
+}
+
+int main(void)
+{
+    test_ladder();
+    test_ramp();
+    test_hysteresis();
+    test_outlier();
+    return check_done("governor");
+}
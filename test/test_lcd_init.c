@@ -0,0 +1,138 @@
+/**
+ * @file test_lcd_init.c
+ * @brief Host test of src/lcd.c's start-up: the byte stream the table-driven, non-blocking initialization
+ * sends matches the original LCD_Init() byte for byte, with its delays, and LCD_Sleep() puts the panel
+ * to sleep and wakes it.
+ */
+
+#include "check.h"
+#include "fake_lcd.h"
+#include "stm32f0xx.h"
+#include "clock.h"
+
+#define C(b) {0, b}
+#define D(b) {1, b}
+
+/* What the original LCD_Init() sent, call by call, then LCD_direction(0) */
+static const uint8_t original[][2] = {
+    C(0xCF), D(0x00), D(0xD9), D(0x30),
+    C(0xED), D(0x64), D(0x03), D(0x12), D(0x81),
+    C(0xE8), D(0x85), D(0x10), D(0x7A),
+    C(0xCB), D(0x39), D(0x2C), D(0x00), D(0x34), D(0x02),
+    C(0xF7), D(0x20),
+    C(0xEA), D(0x00), D(0x00),
+    C(0xC0), D(0x21),
+    C(0xC1), D(0x12),
+    C(0xC5), D(0x39), D(0x37),
+    C(0xC7), D(0xAB),
+    C(0x36), D(0x48),
+    C(0x3A), D(0x55),
+    C(0xB1), D(0x00), D(0x1B),
+    C(0xB6), D(0x0A), D(0xA2),
+    C(0xF2), D(0x00),
+    C(0x26), D(0x01),
+    C(0xE0), D(0x0F), D(0x23), D(0x1F), D(0x0B), D(0x0E), D(0x08), D(0x4B), D(0xA8), D(0x3B), D(0x0A), D(0x14),
+    D(0x06), D(0x10), D(0x09), D(0x00),
+    C(0xE1), D(0x00), D(0x1C), D(0x20), D(0x04), D(0x10), D(0x08), D(0x34), D(0x47), D(0x44), D(0x05), D(0x0B),
+    D(0x09), D(0x2F), D(0x36), D(0x0F),
+    C(0x2B), D(0x00), D(0x00), D(0x01), D(0x3F),
+    C(0x2A), D(0x00), D(0x00), D(0x00), D(0xEF),
+    C(0x11),
+    C(0x29),
+    C(0x36), D(0x08),
+};
+
+#define ORIGINAL_LEN (sizeof original / sizeof original[0])
+
+/* Where in the log a command was sent, or -1 */
+static int find(uint8_t cmd, unsigned int from)
+{
+    for (unsigned int i = from; i < fake_lcd.log_len; i++)
+        if (!fake_lcd.log[i].dc && fake_lcd.log[i].byte == cmd)
+            return i;
+    return -1;
+}
+
+static void test_init(void)
+{
+    clock_init();
+    fake_lcd.logging = 1;
+    fake_lcd_reset();
+    fake_us = 0;
+
+    // nRESET is held low, then released, with other work going on between polls
+    LCD_SetupStart();
+    CHECK_EQ(bench_gpiob.BSRR, GPIO_BSRR_BR_11);
+    uint32_t asserted = fake_us, released = 0;
+    int polls = 0;
+    while (!LCD_InitPoll())
+    {
+        if (!released && bench_gpiob.BSRR == GPIO_BSRR_BS_11)
+            released = fake_us;
+        polls++;
+    }
+    CHECK(polls > 3); // it gave the time back while waiting
+    CHECK(released - asserted >= 100000);
+
+    // the same bytes as ever, commands and data alike
+    CHECK_EQ(fake_lcd.log_len, ORIGINAL_LEN);
+    for (unsigned int i = 0; i < ORIGINAL_LEN && i < fake_lcd.log_len; i++)
+    {
+        if (!check_that(fake_lcd.log[i].byte == original[i][1] && fake_lcd.log[i].dc == original[i][0],
+                        "byte matches the original LCD_Init()", __FILE__, __LINE__))
+        {
+            printf("    byte %u: %s 0x%02x, want %s 0x%02x\n", i, fake_lcd.log[i].dc ? "data" : "command",
+                   fake_lcd.log[i].byte, original[i][0] ? "data" : "command", original[i][1]);
+            break;
+        }
+    }
+    CHECK_EQ(fake_lcd.deselected, 0);
+
+    // and the delays: 50 ms out of reset, 120 ms out of sleep
+    CHECK(fake_lcd.log[0].us - released >= 50000);
+    int sleep_out = find(0x11, 0), display_on = find(0x29, 0);
+    CHECK(sleep_out >= 0 && display_on > sleep_out);
+    if (sleep_out >= 0 && display_on > sleep_out)
+        CHECK(fake_lcd.log[display_on].us - fake_lcd.log[sleep_out].us >= 120000);
+
+    CHECK(fake_lcd.display_on);
+    CHECK(!fake_lcd.sleeping);
+    CHECK_EQ(fake_lcd.madctl, 0x08);
+    CHECK_EQ(lcddev.width, LCD_W);
+    CHECK_EQ(lcddev.height, LCD_H);
+    CHECK_EQ(LCD_InitPoll(), 1);
+}
+
+static void test_sleep(void)
+{
+    fake_lcd.log_len = 0;
+    LCD_Sleep(1);
+    CHECK_EQ(fake_lcd.log_len, 2);
+    CHECK(!fake_lcd.display_on);
+    CHECK(fake_lcd.sleeping);
+    CHECK_EQ(find(0x28, 0), 0);
+    CHECK_EQ(find(0x10, 0), 1);
+
+    fake_lcd.log_len = 0;
+    LCD_Sleep(0);
+    CHECK_EQ(fake_lcd.log_len, 2);
+    CHECK(fake_lcd.display_on);
+    CHECK(!fake_lcd.sleeping);
+    CHECK_EQ(find(0x11, 0), 0);
+    CHECK_EQ(find(0x29, 0), 1);
+    CHECK(fake_lcd.log[1].us - fake_lcd.log[0].us >= 120000);
+    CHECK_EQ(fake_lcd.deselected, 0);
+
+    // the picture is still there
+    LCD_DrawPoint(10, 20, 0x1234);
+    LCD_Sleep(1);
+    LCD_Sleep(0);
+    CHECK_EQ(fake_lcd.gram[20][10], 0x1234);
+}
+
+int main(void)
+{
+    test_init();
+    test_sleep();
+    return check_done("lcd_init");
+}
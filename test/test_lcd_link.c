@@ -0,0 +1,71 @@
+/**
+ * @file test_lcd_link.c
+ * @brief Host test of src/lcd.c's LCD_LinkTest(): against a display that corrupts pixels written above a
+ * given clock, it falls back to the fastest divisor that still reads back intact, and the frames drawn
+ * after it come out clean. If no clock reads back intact, whether the writes or the reads are at fault,
+ * the display keeps CLOCK_SPI1_HZ, unverified.
+ */
+
+#include "check.h"
+#include "fake_lcd.h"
+#include "clock.h"
+#include "spibus.h"
+
+/* SPI1's divisor field, as the bus last set it for a transfer */
+static uint32_t spi1_br(void)
+{
+    return (spibus_host.spi.CR1 >> 3) & 7;
+}
+
+/* A display that takes pixels up to limit_hz (0 for any clock), at 48 MHz */
+static void link(uint32_t limit_hz, uint32_t want_hz, uint32_t want_br, int tries, int verified)
+{
+    // the writes at the chosen clock are corrupted only if the display cannot take them
+    int clean = limit_hz == 0 || limit_hz >= want_hz;
+    clock_init();
+    fake_lcd.max_hz = limit_hz;
+    fake_lcd_reset();
+    LCD_Setup();
+
+    uint32_t hz = LCD_LinkTest();
+    if (!check_that(hz == want_hz, "the clock chosen for the display's limit", __FILE__, __LINE__))
+        printf("    limit %u Hz: chose %u Hz, want %u Hz\n", (unsigned int)limit_hz, (unsigned int)hz,
+               (unsigned int)want_hz);
+    CHECK_EQ(lcd_link.max_hz, want_hz);
+    CHECK_EQ(lcd_link.id, 0x009341);
+    CHECK_EQ(lcd_link.tries, tries);
+    CHECK_EQ(lcd_link.verified, verified);
+    CHECK_EQ(LCD_LinkHz(), want_hz);
+    CHECK_EQ(fake_lcd.deselected, 0);
+    if (tries > 1 && !fake_lcd.bad_reads)
+        CHECK(fake_lcd.corrupted > 0); // the clocks that were too fast were tried and failed
+
+    // what is drawn at the clock chosen gets there intact, if the display can take it
+    uint32_t corrupted = fake_lcd.corrupted;
+    LCD_Clear(0x1234);
+    CHECK_EQ(fake_lcd.corrupted - corrupted, clean ? 0 : LCD_W * LCD_H);
+    CHECK_EQ(fake_lcd.gram[LCD_H - 1][LCD_W - 1], clean ? 0x1234 : 0x1235);
+    CHECK_EQ(spi1_br(), want_br); // the bus sets the divisor when it grants the display
+    CHECK_EQ(fake_lcd_hz(), want_hz);
+}
+
+int main(void)
+{
+    // SPI1 runs from PCLK = 48 MHz: divisors /2 (BR 0) to /16 (BR 3) are the clocks tried
+    link(0, 24000000, 0, 1, 1);
+    link(24000000, 24000000, 0, 1, 1);
+    link(23999999, 12000000, 1, 2, 1);
+    link(12000000, 12000000, 1, 2, 1);
+    link(8000000, 6000000, 2, 3, 1);
+    link(6000000, 6000000, 2, 3, 1);
+    link(3000000, 3000000, 3, 4, 1);
+    // nothing passes, even the slowest clock: CLOCK_SPI1_HZ, unverified
+    link(2999999, CLOCK_SPI1_HZ, 1, 4, 0);
+    link(1000000, CLOCK_SPI1_HZ, 1, 4, 0);
+    // the ID reads back but no test row does, though every write got there: not slowed down for it
+    fake_lcd.bad_reads = 1;
+    link(0, CLOCK_SPI1_HZ, 1, 4, 0);
+    fake_lcd.bad_reads = 0;
+    fake_lcd.max_hz = 0;
+    return check_done("lcd_link");
+}
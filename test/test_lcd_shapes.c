@@ -0,0 +1,364 @@
+/**
+ * @file test_lcd_shapes.c
+ * @brief Host test of src/lcd.c's line, circle and filled triangle: the same pixels as the original
+ * point-at-a-time versions, for no more SPI bytes, including degenerate shapes and ones the screen
+ * edge clips.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "fake_lcd.h"
+#include "clock.h"
+
+/*
+ * The original rasterisers, as they were before the spans, drawing into
+ * ref[] and counting what they would have sent: a point was a full
+ * window (11 bytes) and a pixel, a fill a full window and its pixels.
+ * Coordinates go through u16 as they did, so one off the left or top
+ * wraps round and lands outside the screen, where the controller drops it.
+ */
+static u16 ref[LCD_H][LCD_W];
+static unsigned long ref_bytes;
+
+static void ref_point(u16 x, u16 y, u16 c)
+{
+    ref_bytes += 11 + 2;
+    if (x < LCD_W && y < LCD_H)
+        ref[y][x] = c;
+}
+
+static void ref_fill(u16 sx, u16 sy, u16 ex, u16 ey, u16 c)
+{
+    u16 width = ex - sx + 1;
+    u16 height = ey - sy + 1;
+    ref_bytes += 11 + 2ul * width * height;
+    for (u16 i = 0; i < height; i++)
+        for (u16 j = 0; j < width; j++)
+            if ((u16)(sx + j) < LCD_W && (u16)(sy + i) < LCD_H)
+                ref[(u16)(sy + i)][(u16)(sx + j)] = c;
+}
+
+static void ref_line(u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
+{
+    u16 t;
+    int xerr = 0, yerr = 0, delta_x, delta_y, distance;
+    int incx, incy, uRow, uCol;
+
+    delta_x = x2 - x1;
+    delta_y = y2 - y1;
+    uRow = x1;
+    uCol = y1;
+    if (delta_x > 0)
+        incx = 1;
+    else if (delta_x == 0)
+        incx = 0;
+    else
+    {
+        incx = -1;
+        delta_x = -delta_x;
+    }
+    if (delta_y > 0)
+        incy = 1;
+    else if (delta_y == 0)
+        incy = 0;
+    else
+    {
+        incy = -1;
+        delta_y = -delta_y;
+    }
+    if (delta_x > delta_y)
+        distance = delta_x;
+    else
+        distance = delta_y;
+    for (t = 0; t <= distance + 1; t++)
+    {
+        ref_point(uRow, uCol, c);
+        xerr += delta_x;
+        yerr += delta_y;
+        if (xerr > distance)
+        {
+            xerr -= distance;
+            uRow += incx;
+        }
+        if (yerr > distance)
+        {
+            yerr -= distance;
+            uCol += incy;
+        }
+    }
+}
+
+static void ref_circle_8(int xc, int yc, int x, int y, u16 c)
+{
+    ref_point(xc + x, yc + y, c);
+    ref_point(xc - x, yc + y, c);
+    ref_point(xc + x, yc - y, c);
+    ref_point(xc - x, yc - y, c);
+    ref_point(xc + y, yc + x, c);
+    ref_point(xc - y, yc + x, c);
+    ref_point(xc + y, yc - x, c);
+    ref_point(xc - y, yc - x, c);
+}
+
+static void ref_circle(u16 xc, u16 yc, u16 r, u16 fill, u16 c)
+{
+    int x = 0, y = r, yi, d;
+    d = 3 - 2 * r;
+
+    while (x <= y)
+    {
+        if (fill)
+            for (yi = x; yi <= y; yi++)
+                ref_circle_8(xc, yc, x, yi, c);
+        else
+            ref_circle_8(xc, yc, x, y, c);
+        if (d < 0)
+        {
+            d = d + 4 * x + 6;
+        }
+        else
+        {
+            d = d + 4 * (x - y) + 10;
+            y--;
+        }
+        x++;
+    }
+}
+
+static void ref_swap(u16 *a, u16 *b)
+{
+    u16 tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+/* last is an int here: the original's u16 wrapped when y0 == y1 == 0 and never finished */
+static void ref_triangle(u16 x0, u16 y0, u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
+{
+    u16 a, b, y;
+    int last;
+    int dx01, dy01, dx02, dy02, dx12, dy12;
+    long sa = 0;
+    long sb = 0;
+    if (y0 > y1)
+    {
+        ref_swap(&y0, &y1);
+        ref_swap(&x0, &x1);
+    }
+    if (y1 > y2)
+    {
+        ref_swap(&y2, &y1);
+        ref_swap(&x2, &x1);
+    }
+    if (y0 > y1)
+    {
+        ref_swap(&y0, &y1);
+        ref_swap(&x0, &x1);
+    }
+    if (y0 == y2)
+    {
+        a = b = x0;
+        if (x1 < a)
+            a = x1;
+        else if (x1 > b)
+            b = x1;
+        if (x2 < a)
+            a = x2;
+        else if (x2 > b)
+            b = x2;
+        ref_fill(a, y0, b, y0, c);
+        return;
+    }
+    dx01 = x1 - x0;
+    dy01 = y1 - y0;
+    dx02 = x2 - x0;
+    dy02 = y2 - y0;
+    dx12 = x2 - x1;
+    dy12 = y2 - y1;
+
+    if (y1 == y2)
+        last = y1;
+    else
+        last = y1 - 1;
+    for (y = y0; y <= last; y++)
+    {
+        a = x0 + sa / dy01;
+        b = x0 + sb / dy02;
+        sa += dx01;
+        sb += dx02;
+        if (a > b)
+            ref_swap(&a, &b);
+        ref_fill(a, y, b, y, c);
+    }
+    sa = dx12 * (y - y1);
+    sb = dx02 * (y - y0);
+    for (; y <= y2; y++)
+    {
+        a = x1 + sa / dy12;
+        b = x0 + sb / dy02;
+        sa += dx12;
+        sb += dx02;
+        if (a > b)
+            ref_swap(&a, &b);
+        ref_fill(a, y, b, y, c);
+    }
+}
+
+/*
+ * Each shape goes on top of what the last ones left, in a new colour, so
+ * a pixel drawn in the wrong place or left out shows as a mismatch.
+ */
+static u16 colour = 1;
+static uint32_t spi_before, fake_before;
+
+static void start(void)
+{
+    ref_bytes = 0;
+    spi_before = lcd_spi_bytes;
+    fake_before = fake_lcd.bytes;
+}
+
+static void same(const char *what)
+{
+    unsigned long sent = fake_lcd.bytes - fake_before;
+    int ok = 1;
+    for (int y = 0; y < LCD_H && ok; y++)
+        for (int x = 0; x < LCD_W && ok; x++)
+            if (fake_lcd.gram[y][x] != ref[y][x])
+            {
+                ok = check_that(0, "the same pixels as the original", __FILE__, __LINE__);
+                printf("    %s: (%d,%d) is 0x%04x, want 0x%04x\n", what, x, y, fake_lcd.gram[y][x], ref[y][x]);
+            }
+    if (!ok) // start the next shape from the same picture
+        memcpy(ref, fake_lcd.gram, sizeof ref);
+    if (!check_that(sent <= ref_bytes, "no more bytes than the original", __FILE__, __LINE__))
+        printf("    %s: %lu bytes, the original sent %lu\n", what, sent, ref_bytes);
+    CHECK_EQ(lcd_spi_bytes - spi_before, sent); // lcd_spi_bytes counts what goes out
+    CHECK_EQ(fake_lcd.deselected, 0);
+    colour = colour * 7 + 3;
+}
+
+static void line(u16 x1, u16 y1, u16 x2, u16 y2)
+{
+    char what[64];
+    snprintf(what, sizeof what, "line (%u,%u)-(%u,%u)", x1, y1, x2, y2);
+    start();
+    LCD_DrawLine(x1, y1, x2, y2, colour);
+    ref_line(x1, y1, x2, y2, colour);
+    same(what);
+}
+
+static void circle(u16 xc, u16 yc, u16 r, u16 fill)
+{
+    char what[64];
+    snprintf(what, sizeof what, "%s circle (%u,%u) r %u", fill ? "filled" : "open", xc, yc, r);
+    start();
+    LCD_Circle(xc, yc, r, fill, colour);
+    ref_circle(xc, yc, r, fill, colour);
+    same(what);
+}
+
+static void triangle(u16 x0, u16 y0, u16 x1, u16 y1, u16 x2, u16 y2)
+{
+    char what[80];
+    snprintf(what, sizeof what, "triangle (%u,%u) (%u,%u) (%u,%u)", x0, y0, x1, y1, x2, y2);
+    start();
+    LCD_DrawFillTriangle(x0, y0, x1, y1, x2, y2, colour);
+    ref_triangle(x0, y0, x1, y1, x2, y2, colour);
+    same(what);
+}
+
+static void setup(void)
+{
+    clock_init();
+    fake_lcd_reset();
+    LCD_Setup();
+    fake_lcd_fill(0);
+    memset(ref, 0, sizeof ref);
+}
+
+static void test_lines(void)
+{
+    setup();
+    line(10, 10, 10, 10); // a point
+    line(0, 0, 239, 0);   // along the top edge
+    line(239, 319, 0, 319);
+    line(0, 0, 0, 319); // down the left edge
+    line(239, 319, 239, 0);
+    line(0, 0, 239, 319); // corner to corner
+    line(239, 0, 0, 319);
+    line(20, 30, 120, 40); // shallow, both ways
+    line(120, 40, 20, 30);
+    line(20, 300, 120, 290);
+    line(50, 20, 60, 200); // steep, both ways
+    line(60, 200, 50, 20);
+    line(100, 100, 150, 150); // diagonals
+    line(150, 100, 100, 150);
+    line(5, 5, 6, 6);
+    line(200, 100, 230, 101); // nearly horizontal: long runs
+    line(200, 100, 201, 300); // nearly vertical
+
+    srand(30);
+    for (int i = 0; i < 200; i++)
+        line(rand() % LCD_W, rand() % LCD_H, rand() % LCD_W, rand() % LCD_H);
+}
+
+static void test_circles(void)
+{
+    setup();
+    for (u16 fill = 0; fill <= 1; fill++)
+    {
+        circle(120, 160, 0, fill);
+        circle(120, 160, 1, fill);
+        circle(120, 160, 2, fill);
+        circle(60, 60, 7, fill);
+        circle(120, 160, 100, fill);
+        circle(120, 160, 119, fill); // touching the sides
+        // clipped by each edge, and by corners
+        circle(5, 160, 20, fill);
+        circle(235, 160, 20, fill);
+        circle(120, 0, 30, fill);
+        circle(120, 319, 30, fill);
+        circle(0, 0, 25, fill);
+        circle(239, 319, 25, fill);
+        circle(120, 160, 200, fill); // bigger than the screen
+    }
+
+    srand(31);
+    for (int i = 0; i < 100; i++)
+        circle(rand() % LCD_W, rand() % LCD_H, rand() % 80, rand() & 1);
+}
+
+static void test_triangles(void)
+{
+    setup();
+    triangle(50, 50, 50, 50, 50, 50);    // a point
+    triangle(10, 70, 200, 70, 100, 70);  // flat: one row
+    triangle(30, 0, 200, 0, 100, 0);     // flat, on the top row
+    triangle(100, 80, 40, 150, 180, 150); // flat bottom
+    triangle(40, 160, 180, 160, 100, 230); // flat top
+    triangle(0, 0, 239, 0, 120, 100);    // flat top on row 0
+    triangle(20, 100, 60, 140, 100, 180); // collinear
+    triangle(120, 10, 120, 200, 120, 300); // collinear and vertical
+    triangle(0, 0, 239, 319, 0, 319);    // corners
+    triangle(239, 0, 0, 319, 239, 319);
+    triangle(0, 160, 239, 0, 239, 319); // across the whole screen
+    triangle(10, 10, 11, 300, 12, 20);  // thin
+    triangle(200, 250, 30, 200, 100, 10); // vertices in every order
+    triangle(100, 10, 200, 250, 30, 200);
+    triangle(30, 200, 100, 10, 200, 250);
+
+    srand(32);
+    for (int i = 0; i < 200; i++)
+        triangle(rand() % LCD_W, rand() % LCD_H, rand() % LCD_W, rand() % LCD_H, rand() % LCD_W,
+                 rand() % LCD_H);
+}
+
+int main(void)
+{
+    test_lines();
+    test_circles();
+    test_triangles();
+    return check_done("lcd_shapes");
+}
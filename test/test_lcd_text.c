@@ -0,0 +1,231 @@
+/**
+ * @file test_lcd_text.c
+ * @brief Host test of src/lcd.c's text: LCD_DrawString and LCD_DrawChar leave the same pixels as the
+ * original glyph loop, opaque, transparent as runs, and transparent composited over a registered
+ * background, in both font sizes, whole and clipped by the right and bottom edges.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "fake_lcd.h"
+#include "clock.h"
+
+extern const unsigned char asc2_1206[95][12];
+extern const unsigned char asc2_1608[95][16];
+
+/*
+ * The original _LCD_DrawChar and LCD_DrawString, drawing into ref[] and
+ * counting what they would have sent. An opaque glyph was a full window
+ * (11 bytes) and all its pixels; a transparent one was a point, a window
+ * and a pixel, for each lit pixel. A glyph's window ran past the edge of
+ * the screen as far as it needed, and the controller dropped what fell
+ * outside GRAM.
+ */
+static u16 ref[LCD_H][LCD_W];
+static unsigned long ref_bytes;
+
+static void ref_pixel(u16 x, u16 y, u16 c)
+{
+    if (x < LCD_W && y < LCD_H)
+        ref[y][x] = c;
+}
+
+static void ref_char(u16 x, u16 y, u16 fc, u16 bc, char num, u8 size, u8 mode)
+{
+    u8 temp;
+    u8 pos, t;
+    num = num - ' ';
+    if (!mode)
+        ref_bytes += 11 + 2ul * (size / 2) * size;
+    for (pos = 0; pos < size; pos++)
+    {
+        if (size == 12)
+            temp = asc2_1206[(int)num][pos];
+        else
+            temp = asc2_1608[(int)num][pos];
+        for (t = 0; t < size / 2; t++)
+        {
+            if (temp & 0x01)
+            {
+                ref_pixel(x + t, y + pos, fc);
+                if (mode)
+                    ref_bytes += 11 + 2;
+            }
+            else if (!mode)
+                ref_pixel(x + t, y + pos, bc);
+            temp >>= 1;
+        }
+    }
+}
+
+static void ref_string(u16 x, u16 y, u16 fc, u16 bg, const char *p, u8 size, u8 mode)
+{
+    while ((*p <= '~') && (*p >= ' '))
+    {
+        if (x > (LCD_W - 1) || y > (LCD_H - 1))
+            return;
+        ref_char(x, y, fc, bg, *p, size, mode);
+        x += size / 2;
+        p++;
+    }
+}
+
+/* What was on the screen before the text, and what the composited text is drawn over */
+static u16 behind(int x, int y)
+{
+    return (u16)((x * 31 + y * 977) ^ (x * y));
+}
+
+static void behind_row(int x, int y, int n, u16 *out)
+{
+    for (int i = 0; i < n; i++)
+        out[i] = behind(x + i, y);
+}
+
+/* The three ways text is drawn */
+enum
+{
+    OPAQUE,
+    RUNS,       // transparent, with no background registered
+    COMPOSITED, // transparent, over the registered background
+};
+
+static const char *const ways[] = {"opaque", "transparent runs", "transparent composited"};
+
+/* Each way's bytes on the wire, and the original's, over the whole test */
+static unsigned long sent[3], original[3];
+
+static void draw_behind(void)
+{
+    for (int y = 0; y < LCD_H; y++)
+        for (int x = 0; x < LCD_W; x++)
+            fake_lcd.gram[y][x] = ref[y][x] = behind(x, y);
+}
+
+static void setup(int way)
+{
+    clock_init();
+    fake_lcd_reset();
+    LCD_Setup();
+    draw_behind();
+    LCD_SetTextBackground(way == COMPOSITED ? behind_row : 0);
+}
+
+/*
+ * Composited text takes what is behind it from the registered background,
+ * not from GRAM, so it is the original's only where GRAM still holds that
+ * background: each string goes on a freshly drawn one, as in the game.
+ * The other ways go on top of what the last strings left.
+ */
+static void before_text(int way)
+{
+    if (way == COMPOSITED)
+        draw_behind();
+}
+
+/* After each string, GRAM is the original's; if not, the next starts from the same picture */
+static void same(int way, const char *what, uint32_t before)
+{
+    int ok = 1;
+    for (int y = 0; y < LCD_H && ok; y++)
+        for (int x = 0; x < LCD_W && ok; x++)
+            if (fake_lcd.gram[y][x] != ref[y][x])
+            {
+                ok = check_that(0, "the same pixels as the original glyph loop", __FILE__, __LINE__);
+                printf("    %s, %s: (%d,%d) is 0x%04x, want 0x%04x\n", ways[way], what, x, y,
+                       fake_lcd.gram[y][x], ref[y][x]);
+            }
+    if (!ok)
+        memcpy(ref, fake_lcd.gram, sizeof ref);
+    CHECK_EQ(fake_lcd.deselected, 0);
+    sent[way] += fake_lcd.bytes - before;
+}
+
+static void string(int way, u16 x, u16 y, const char *s, u8 size, u16 fc, u16 bc)
+{
+    char what[96];
+    snprintf(what, sizeof what, "\"%.40s\" size %u at (%u,%u)", s, size, x, y);
+    unsigned long before_ref = ref_bytes;
+    before_text(way);
+    uint32_t before = fake_lcd.bytes;
+    LCD_DrawString(x, y, fc, bc, s, size, way != OPAQUE);
+    ref_string(x, y, fc, bc, s, size, way != OPAQUE);
+    original[way] += ref_bytes - before_ref;
+    same(way, what, before);
+}
+
+static void character(int way, u16 x, u16 y, char c, u8 size, u16 fc, u16 bc)
+{
+    char what[64];
+    snprintf(what, sizeof what, "'%c' size %u at (%u,%u)", c, size, x, y);
+    unsigned long before_ref = ref_bytes;
+    before_text(way);
+    uint32_t before = fake_lcd.bytes;
+    LCD_DrawChar(x, y, fc, bc, c, size, way != OPAQUE);
+    ref_char(x, y, fc, bc, c, size, way != OPAQUE);
+    original[way] += ref_bytes - before_ref;
+    same(way, what, before);
+}
+
+static void test_way(int way)
+{
+    static char all[96];
+    for (int i = 0; i < 95; i++)
+        all[i] = (char)(' ' + i);
+
+    setup(way);
+    for (u8 size = 12; size <= 16; size += 4)
+    {
+        u16 w = size / 2;
+        string(way, 0, 0, "Flappy Chip 0123456789", size, 0xffff, 0x001f);
+        string(way, 3, 40, all, size, 0xf800, 0x07e0); // every glyph, running off the right edge
+        string(way, 5, 80, all + 30, size, 0x1234, 0x8765);
+        string(way, 11, 100, "", size, 0xffff, 0);      // nothing
+        string(way, 20, 120, "ab\ncd", size, 0xffff, 0); // stops at the first unprintable
+        // clipped by the right edge: in the middle of a glyph, on a glyph boundary, one column left
+        string(way, LCD_W - 3 * w - 3, 150, "WXYZ", size, 0x07ff, 0xf81f);
+        string(way, LCD_W - 2 * w, 170, "MN", size, 0x07ff, 0xf81f);
+        string(way, LCD_W - 1, 190, "Q@", size, 0xffe0, 0x0010);
+        // clipped by the bottom edge, and by both
+        string(way, 40, LCD_H - size + 5, "bottom gj", size, 0xffff, 0x4208);
+        string(way, 40, LCD_H - 1, "last row", size, 0xffff, 0x4208);
+        string(way, LCD_W - 2 * w - 3, LCD_H - size / 2, "%&#", size, 0xf800, 0x001f);
+        // off the screen altogether
+        string(way, LCD_W, 10, "gone", size, 0xffff, 0);
+        string(way, 10, LCD_H, "gone", size, 0xffff, 0);
+
+        for (int i = 0; i < 95; i++)
+            character(way, (u16)(i * 7 % (LCD_W - 3)), (u16)(200 + i * 13 % (LCD_H - 195)), all[i], size,
+                      (u16)(i * 0x0841), (u16)~(i * 0x0841));
+    }
+
+    // and at random, near the edges as often as not
+    srand(31 + way);
+    for (int i = 0; i < 300; i++)
+    {
+        char s[24];
+        int n = rand() % (sizeof s);
+        for (int k = 0; k < n; k++)
+            s[k] = (char)(' ' + rand() % 95);
+        s[n] = 0;
+        u8 size = rand() & 1 ? 12 : 16;
+        u16 x = rand() & 1 ? rand() % LCD_W : LCD_W - 1 - rand() % (3 * size);
+        u16 y = rand() & 1 ? rand() % LCD_H : LCD_H - 1 - rand() % (2 * size);
+        string(way, x, y, s, size, (u16)rand(), (u16)rand());
+    }
+    LCD_SetTextBackground(0);
+}
+
+int main(void)
+{
+    for (int way = OPAQUE; way <= COMPOSITED; way++)
+    {
+        test_way(way);
+        printf("%-24s %7lu bytes, the original glyph loop %7lu\n", ways[way], sent[way], original[way]);
+    }
+    // fewer bytes; composited sends the background under the text too, so it need not be
+    CHECK(sent[OPAQUE] <= original[OPAQUE]);
+    CHECK(sent[RUNS] <= original[RUNS]);
+    return check_done("lcd_text");
+}
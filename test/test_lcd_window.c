@@ -0,0 +1,341 @@
+/**
+ * @file test_lcd_window.c
+ * @brief Host test of src/lcd.c's window cache: random draw sequences, and game frames drawn as
+ * main.c's draw_frame() draws them, come out the same in GRAM with LCD_SetWindow widening windows,
+ * skipping CASET/PASET and carrying on from the cursor, as with every window sent as asked for.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "fake_lcd.h"
+#include "clock.h"
+#include "picture.h"
+#include "assets.h"
+#include "game.h"
+#include "arena.h"
+
+#define OPS 2000
+
+/* Each pass records a checksum of GRAM after every call, so the first one to go wrong can be named */
+typedef struct
+{
+    uint32_t sum[OPS];
+    const char *what[OPS];
+    uint32_t bytes;
+    u16 gram[LCD_H][LCD_W];
+} Pass;
+
+static Pass cached, uncached;
+
+static uint32_t gram_sum(void)
+{
+    uint32_t h = 2166136261u; // FNV-1a
+    const u16 *p = &fake_lcd.gram[0][0];
+    for (unsigned int i = 0; i < LCD_W * LCD_H; i++)
+        h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+#define PIC_W 29
+#define PIC_H 17
+static struct
+{
+    Picture pic;
+    u16 pixels[PIC_W * PIC_H];
+} picture = {{PIC_W, PIC_H, 2}, {0}};
+
+static void text_background(int x, int y, int n, u16 *out)
+{
+    for (int i = 0; i < n; i++)
+        out[i] = (u16)((x + i) * 31 + y * 7);
+}
+
+static int coord(int n)
+{
+    return rand() % n;
+}
+
+/* The rectangle just below the last filled one, where the cursor may be */
+static int below_x0, below_x1, below_y = LCD_H;
+
+static void fill(int x0, int y0, int x1, int y1, u16 c)
+{
+    LCD_DrawFillRectangle(x0, y0, x1, y1, c);
+    below_x0 = x0;
+    below_x1 = x1;
+    below_y = y1 + 1;
+}
+
+/* An edge of the rectangle below: mostly the same, sometimes one pixel either way */
+static int nudge(int x)
+{
+    int d = rand() % 5 - 2;
+    if (d == -2 || d == 2)
+        d = 0;
+    x += d;
+    return x < 0 ? 0 : x >= LCD_W ? LCD_W - 1 : x;
+}
+
+/* One drawing call, picked at random: what it was */
+static const char *draw(void)
+{
+    u16 c = rand();
+    int x = coord(LCD_W), y = coord(LCD_H);
+    int x2 = coord(LCD_W), y2 = coord(LCD_H);
+    static char text[12];
+
+    switch (rand() % 20)
+    {
+    case 0:
+        LCD_DrawPoint(x, y, c);
+        return "point";
+    case 1: // points along a row, which can carry on from the cursor, off the end of the row too
+        for (int i = 0; i < 20; i++)
+            LCD_DrawPoint((x + i) % LCD_W, y + (x + i) / LCD_W < LCD_H ? y + (x + i) / LCD_W : y, c + i);
+        return "row of points";
+    case 2: // points down a column
+        for (int i = 0; i < 20 && y + i < LCD_H; i++)
+            LCD_DrawPoint(x, y + i, c);
+        return "column of points";
+    case 3:
+        fill(x < x2 ? x : x2, y < y2 ? y : y2, x < x2 ? x2 : x, y < y2 ? y2 : y, c);
+        return "filled rectangle";
+    case 4: // a small one, where one row often follows another
+    {
+        int y1 = y + coord(8);
+        fill(x, y, x + coord(LCD_W - x), y1 < LCD_H ? y1 : LCD_H - 1, c);
+        return "small filled rectangle";
+    }
+    case 15: // carrying on down from the last one, as the same, a wider or a narrower window
+    case 16:
+    case 17:
+    {
+        if (below_y >= LCD_H)
+            return "nothing below";
+        int x0 = nudge(below_x0), x1 = nudge(below_x1), y1 = below_y + coord(4);
+        fill(x0, below_y, x1 < x0 ? x0 : x1, y1 < LCD_H ? y1 : LCD_H - 1, c);
+        return "filled rectangle below";
+    }
+    case 18: // a single row or point there
+        if (below_y >= LCD_H)
+            return "nothing below";
+        if (rand() & 1)
+            LCD_DrawPoint(nudge(below_x0), below_y, c);
+        else
+            LCD_DrawLine(nudge(below_x0), below_y, nudge(below_x1), below_y, c);
+        below_y++;
+        return "row below";
+    case 5:
+        LCD_DrawLine(x, y, x2, y2, c);
+        return "line";
+    case 6:
+        LCD_DrawRectangle(x, y, x2, y2, c);
+        return "rectangle";
+    case 7:
+        LCD_Circle(x, y, coord(60), rand() & 1, c);
+        return "circle";
+    case 8:
+        LCD_DrawFillTriangle(x, y, x2, y2, coord(LCD_W), coord(LCD_H), c);
+        return "filled triangle";
+    case 9:
+        LCD_DrawTriangle(x, y, x2, y2, coord(LCD_W), coord(LCD_H), c);
+        return "triangle";
+    case 10:
+    case 11:
+    {
+        int size = rand() & 1 ? 16 : 12, mode = rand() & 1;
+        snprintf(text, sizeof text, "%d", rand());
+        LCD_SetTextBackground(rand() & 1 ? text_background : 0);
+        LCD_DrawString(x, y, c, ~c, text, size, mode);
+        return mode ? "transparent string" : "string";
+    }
+    case 12:
+        LCD_DrawChar(x, y, c, ~c, ' ' + coord(95), rand() & 1 ? 16 : 12, rand() & 1);
+        return "character";
+    case 13:
+        LCD_DrawPicture(coord(LCD_W - PIC_W), coord(LCD_H - PIC_H), &picture.pic);
+        return "picture";
+    case 14: // the next call finds the display still selected
+        LCD_DrawPictureAsync(coord(LCD_W - PIC_W), coord(LCD_H - PIC_H), &picture.pic);
+        return "picture, async";
+    default:
+        if (rand() % 8 == 0)
+        {
+            LCD_Clear(c);
+            return "clear";
+        }
+        LCD_DrawPoint(LCD_W - 1, y, c); // the last column, then the first of the next row
+        if (y + 1 < LCD_H)
+            LCD_DrawPoint(0, y + 1, c);
+        return "row wrap";
+    }
+}
+
+static void replay(int cache, Pass *p)
+{
+    clock_init();
+    fake_lcd_reset();
+    LCD_Setup();
+    fake_lcd_fill(0);
+    lcd_host_window_cache = cache;
+    uint32_t bytes = fake_lcd.bytes;
+
+    srand(31);
+    below_y = LCD_H;
+    for (int i = 0; i < OPS; i++)
+    {
+        p->what[i] = draw();
+        p->sum[i] = gram_sum();
+    }
+    LCD_Flush();
+    p->bytes = fake_lcd.bytes - bytes;
+    memcpy(p->gram, fake_lcd.gram, sizeof p->gram);
+    CHECK_EQ(fake_lcd.deselected, 0);
+    CHECK_EQ(fake_lcd.dropped, 0);
+}
+
+/*
+ * Game frames, as main.c draws them: play() puts the background and the
+ * first barrier up, then draw_frame() redraws the barriers and the bird
+ * where the physics step has them, two frames a step. The button is held
+ * one step in three, and a crash starts the next game on a fresh screen.
+ */
+#define FRAMES 1000
+
+#define TempPicturePtr(name, width, height) Picture name[(width) * (height) / 6 + 2] = {{width, height, 2}}
+TempPicturePtr(bird_ptr, BIRD_WIDTH, BIRD_HEIGHT);
+static ObstacleScreen barrier_screen;
+static int bird_drawn_x;
+
+typedef struct
+{
+    int x;   // left edge
+    int top; // top row
+} BirdPlace;
+
+/* main.c's bird_overlay() and update_bird_pos() */
+static void bird_overlay(void *ctx, int x, int y, Picture *line)
+{
+    const BirdPlace *at = ctx;
+    obstacles_overlay(&barrier_screen, x, y, line->width, line->pix2);
+    pic_overlay(line, at->x - x, at->top - y, bird_ptr, 0xffff);
+}
+
+static void update_bird_pos(int x, int y)
+{
+    int x0 = (x < bird_drawn_x ? x : bird_drawn_x) - bird_ptr->width / 2;
+    int x1 = (x > bird_drawn_x ? x : bird_drawn_x) + bird_ptr->width / 2;
+    if (x0 < 0)
+        x0 = 0;
+    if (x1 > 239)
+        x1 = 239;
+
+    BirdPlace at = {x - bird_ptr->width / 2, y - bird_ptr->height / 2};
+    asset_compose(x0, at.top, x1 - x0 + 1, bird_ptr->height, &background, x0, at.top, bird_overlay, &at);
+    bird_drawn_x = x;
+}
+
+static void new_game(void)
+{
+    asset_draw(0, 0, &background);
+    obstacles_clear_screen(&barrier_screen, &background);
+    obstacles_reset(&barriers, OBSTACLE_MAX, BARRIER_SPACING);
+    obstacle_spawn(&barriers, FIX(BARRIER_Y0), FIX(BARRIER_V0), FIRST_GAP);
+    bird_drawn_x = BIRD_X0;
+    update_bird_pos(BIRD_X0, BIRD_Y0);
+    game_reset();
+    publish_game();
+}
+
+/* What one run of the trace sent */
+typedef struct
+{
+    uint32_t bytes, pixels;
+    u16 gram[LCD_H][LCD_W];
+} Trace;
+
+static Trace traced[2];
+
+static void game_trace(int cache, Trace *t)
+{
+    clock_init();
+    fake_lcd_reset();
+    LCD_Setup();
+    lcd_host_window_cache = cache;
+    arena_reset(&frame_arena);
+    for (int i = 0; i < BIRD_WIDTH * BIRD_HEIGHT; i++)
+        bird_ptr->pix2[i] = 0xffff;
+    asset_overlay(bird_ptr, 0, 0, &bird, 0);
+
+    srand(29);
+    game_init();
+    new_game();
+    uint32_t bytes = fake_lcd.bytes, pixels = fake_lcd.pixels;
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        if (frame % 2 == 0)
+        {
+            game_step((frame / 40) % 3 == 0);
+            publish_game();
+        }
+        arena_reset(&frame_arena);
+        GameView view;
+        snapshot_read(&game, &view);
+        fix alpha = frame % 2 ? FIX_FRAC(1, 2) : 0;
+        obstacles_draw(&barrier_screen, &view.barriers, alpha);
+        update_bird_pos(FIX_ROUND(body_lerp(&view.bird, alpha)), bird_y);
+        if (view.game_over)
+        {
+            t->bytes += fake_lcd.bytes - bytes;
+            t->pixels += fake_lcd.pixels - pixels;
+            new_game(); // the new game's screen is not part of a frame
+            bytes = fake_lcd.bytes, pixels = fake_lcd.pixels;
+        }
+    }
+    LCD_Flush();
+    t->bytes += fake_lcd.bytes - bytes;
+    t->pixels += fake_lcd.pixels - pixels;
+    memcpy(t->gram, fake_lcd.gram, sizeof t->gram);
+    CHECK_EQ(fake_lcd.deselected, 0);
+    CHECK_EQ(fake_lcd.dropped, 0);
+}
+
+/* The frames are the same with the cache, and their windows cost less */
+static void test_game_trace(void)
+{
+    game_trace(0, &traced[0]);
+    game_trace(1, &traced[1]);
+    lcd_host_window_cache = 1;
+
+    CHECK(memcmp(traced[0].gram, traced[1].gram, sizeof traced[0].gram) == 0);
+    CHECK_EQ(traced[1].pixels, traced[0].pixels);
+    uint32_t without = traced[0].bytes - 2 * traced[0].pixels, with = traced[1].bytes - 2 * traced[1].pixels;
+    CHECK(with < without);
+    printf("game trace, %d frames: %u non-pixel bytes with the window cache, %u without, of %u bytes\n", FRAMES,
+           (unsigned int)with, (unsigned int)without, (unsigned int)traced[0].bytes);
+}
+
+int main(void)
+{
+    for (unsigned int i = 0; i < PIC_W * PIC_H; i++)
+        picture.pixels[i] = i * 0x0841;
+
+    replay(0, &uncached);
+    replay(1, &cached);
+    lcd_host_window_cache = 1;
+
+    for (int i = 0; i < OPS; i++)
+        if (!check_that(cached.sum[i] == uncached.sum[i], "the same GRAM with the cache", __FILE__, __LINE__))
+        {
+            printf("    call %d (%s) first differs\n", i, cached.what[i]);
+            break;
+        }
+    CHECK(memcmp(cached.gram, uncached.gram, sizeof cached.gram) == 0);
+    CHECK(cached.bytes < uncached.bytes);
+    printf("%d calls: %u bytes with the window cache, %u without\n", OPS, (unsigned int)cached.bytes,
+           (unsigned int)uncached.bytes);
+
+    test_game_trace();
+    return check_done("lcd_window");
+}
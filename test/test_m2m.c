@@ -0,0 +1,121 @@
+/**
+ * @file test_m2m.c
+ * @brief Host test of asset_compose() in src/picture.c over src/m2m.c's simulated DMA engine: with the
+ * engine taking longer and longer per copy, the rows that reach the display are still the background
+ * and overlay the CPU gets by decoding the same rows itself, and how much of the engine's time the CPU
+ * spent on the other rows instead of waiting is reported.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "fake_lcd.h"
+#include "picture.h"
+#include "m2m.h"
+#include "clock.h"
+
+/* A raw background, which asset_compose() fetches a row at a time by DMA */
+#define BG_W LCD_W
+#define BG_H 96
+static unsigned short bg_pixels[BG_W * BG_H];
+static const Asset bg = {BG_W, BG_H, ASSET_RAW, 0, -1, bg_pixels, 0, 0, 0};
+
+/* A keyed sprite the overlay puts on top, a disc */
+#define SPRITE_W 21
+#define SPRITE_H 15
+#define KEY 0xffff
+static unsigned short sprite_pixels[SPRITE_W * SPRITE_H];
+static const Asset sprite = {SPRITE_W, SPRITE_H, ASSET_RAW, 0, KEY, sprite_pixels, 0, 0, 0};
+
+/* Where the sprite is on the display */
+typedef struct
+{
+    int x, y;
+} Placement;
+
+static void overlay(void *ctx, int x, int y, Picture *line)
+{
+    const Placement *at = ctx;
+    asset_overlay(line, at->x - x, at->y - y, &sprite, 0);
+}
+
+static struct
+{
+    Picture pic;
+    u16 pixels[LCD_W];
+} row = {{LCD_W, 1, 2}, {0}};
+
+/* Compose a rectangle, then check each of its rows against the CPU's decode of it */
+static int compose(int x, int y, int n, int rows, int sx, int sy, Placement *at)
+{
+    asset_compose(x, y, n, rows, &bg, sx, sy, overlay, at);
+    for (int r = 0; r < rows; r++)
+    {
+        row.pic.width = n;
+        asset_row(&bg, sx, sy + r, n, row.pic.pix2);
+        overlay(at, x, y + r, &row.pic);
+        if (memcmp(&fake_lcd.gram[y + r][x], row.pic.pix2, 2 * n) != 0)
+        {
+            check_that(0, "composed rows are the CPU's", __FILE__, __LINE__);
+            printf("    row %d of %dx%d at (%d,%d) differs\n", r, n, rows, x, y);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void run(unsigned int ns_per_halfword, int composes)
+{
+    memset(&m2m_host, 0, sizeof m2m_host);
+    m2m_host.ns_per_halfword = ns_per_halfword;
+    unsigned int rows_drawn = 0;
+
+    srand(41);
+    for (int i = 0; i < composes; i++)
+    {
+        int n = 1 + rand() % BG_W, rows = 1 + rand() % BG_H;
+        int sx = rand() % (BG_W - n + 1), sy = rand() % (BG_H - rows + 1);
+        int x = rand() % (LCD_W - n + 1), y = rand() % (LCD_H - rows + 1);
+        Placement at = {x + rand() % n - SPRITE_W / 2, y + rand() % rows - SPRITE_H / 2};
+        if (!compose(x, y, n, rows, sx, sy, &at))
+            break;
+        rows_drawn += rows;
+    }
+
+    CHECK_EQ(m2m_host.copies, rows_drawn); // every row came by DMA
+    CHECK(m2m_host.stalled_ns <= m2m_host.busy_ns);
+    CHECK_EQ(fake_lcd.dropped, 0);
+    if (!ns_per_halfword)
+        return;
+    unsigned int overlap = (unsigned int)(100 * (m2m_host.busy_ns - m2m_host.stalled_ns) / m2m_host.busy_ns);
+    printf("%4u ns a halfword: engine busy %7llu us, CPU waited %7llu us for it, %3u%% overlapped\n",
+           ns_per_halfword, m2m_host.busy_ns / 1000, m2m_host.stalled_ns / 1000, overlap);
+    if (ns_per_halfword <= 2)
+        CHECK(overlap > 50); // a quick engine is done before the CPU looks, if the row is fetched ahead
+    else if (ns_per_halfword >= 100)
+        CHECK(m2m_host.stalled_ns > 0); // and a slow one does hold the CPU up
+}
+
+int main(void)
+{
+    for (int i = 0; i < BG_W * BG_H; i++)
+        bg_pixels[i] = (unsigned short)(i * 2654435761u >> 16);
+    for (int y = 0; y < SPRITE_H; y++)
+        for (int x = 0; x < SPRITE_W; x++)
+        {
+            int dx = x - SPRITE_W / 2, dy = y - SPRITE_H / 2;
+            sprite_pixels[y * SPRITE_W + x] = dx * dx + dy * dy <= 40 ? (unsigned short)(0x1234 + x * 97 + y) : KEY;
+        }
+
+    clock_init();
+    fake_lcd_reset();
+    LCD_Setup();
+    m2m_init();
+
+    run(0, 300);
+    run(1, 100);
+    run(20, 100);
+    run(100, 60);
+    run(500, 30);
+    return check_done("m2m");
+}
@@ -0,0 +1,105 @@
+/**
+ * @file test_physics.c
+ * @brief Host test of src/physics.c and the game step: body_step against the closed form, free fall, the ceiling.
+ */
+
+#include <stdlib.h>
+#include "check.h"
+#include "fake_lcd.h"
+#include "game.h"
+
+/* After n steps from p0 at v0, pos is p0 + n*v0 + acc*n*(n+1)/2: within 1 LSB, and exactly while acc is a whole number of LSBs */
+static void check_closed_form(fix p0, fix v0, fix acc, int steps)
+{
+    Body b;
+    body_reset(&b, p0, v0);
+    CHECK_EQ(b.prev, p0);
+    for (int n = 1; n <= steps; n++)
+    {
+        fix before = b.pos;
+        body_step(&b, acc);
+        double want = p0 + (double)n * v0 + acc * (double)n * (n + 1) / 2;
+        double off = b.pos - want;
+        if (!check_that(off <= 1 && off >= -1, "pos within 1 LSB of the closed form", __FILE__, __LINE__))
+        {
+            printf("    step %d: pos %ld, want %.1f\n", n, (long)b.pos, want);
+            return;
+        }
+        CHECK_EQ(b.prev, before);
+        CHECK_EQ(b.vel, v0 + n * acc);
+    }
+}
+
+static void test_closed_form(void)
+{
+    CHECK_EQ(BIRD_GRAVITY, -24576); // -3/8 is exact in Q16.16, so the game's fall has no rounding at all
+    check_closed_form(FIX(BIRD_X0), FIX(BIRD_V0), BIRD_GRAVITY, 64);
+    check_closed_form(FIX(BIRD_X0), BIRD_FLAP, BIRD_GRAVITY, 64);
+    check_closed_form(FIX(-7) + 3, FIX_FRAC(1, 3), FIX_FRAC(-1, 3), 200);
+    check_closed_form(0, 0, 1, 1000);
+    check_closed_form(FIX(BIRD_MAX_X), 0, 0, 10);
+
+    // FIX_FRAC(-3, 8) is -3/8 of a pixel to the LSB: the closed form in real numbers holds too
+    Body b;
+    body_reset(&b, FIX(BIRD_X0), 0);
+    for (int n = 1; n <= 16; n++)
+        body_step(&b, BIRD_GRAVITY);
+    CHECK_EQ(b.pos, FIX(BIRD_X0) - FIX_FRAC(3, 8) * 16 * 17 / 2);
+}
+
+/* The bird falls from BIRD_X0 and the game ends on the step that takes it below BIRD_MIN_X, step 16 */
+static void test_free_fall(void)
+{
+    srand(1);
+    obstacles_reset(&barriers, OBSTACLE_MAX, BARRIER_SPACING);
+    game_reset();
+    int steps = 0;
+    while (!game_over && steps < 100)
+    {
+        CHECK_EQ(game_step(0), 0);
+        steps++;
+    }
+    CHECK_EQ(steps, 16);
+    CHECK(FIX_INT(bird_body.pos) < BIRD_MIN_X);
+    CHECK_EQ(FIX_INT(bird_body.prev), BIRD_X0 - 45); // still in at step 15
+    CHECK_EQ(score, 0);
+}
+
+/* Holding the button climbs at BIRD_FLAP a step and stops at BIRD_MAX_X */
+static void test_ceiling(void)
+{
+    srand(1);
+    obstacles_reset(&barriers, OBSTACLE_MAX, BARRIER_SPACING);
+    game_reset();
+    for (int n = 1; n <= 30; n++)
+    {
+        game_step(1);
+        int want = BIRD_X0 + 5 * n;
+        CHECK_EQ(bird_body.pos, FIX(want < BIRD_MAX_X ? want : BIRD_MAX_X));
+    }
+    CHECK(!game_over);
+    CHECK_EQ(bird_body.vel, BIRD_FLAP);
+}
+
+/* The renderer's position runs from before the step to after it */
+static void test_lerp(void)
+{
+    Body b;
+    body_reset(&b, FIX(10), FIX(3));
+    body_step(&b, FIX_FRAC(-1, 2));
+    CHECK_EQ(body_lerp(&b, 0), FIX(10));
+    CHECK_EQ(body_lerp(&b, FIX_ONE), b.pos);
+    CHECK_EQ(body_lerp(&b, FIX_ONE / 2), FIX(10) + FIX_FRAC(5, 4));
+    body_step(&b, FIX(-6)); // moving the other way
+    CHECK_EQ(body_lerp(&b, 0), FIX(10) + FIX_FRAC(5, 2));
+    CHECK_EQ(body_lerp(&b, FIX_ONE), b.pos);
+}
+
+int main(void)
+{
+    test_closed_form();
+    test_free_fall();
+    test_ceiling();
+    test_lerp();
+    return check_done("physics");
+}
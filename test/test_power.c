@@ -0,0 +1,266 @@
+/**
+ * @file test_power.c
+ * @brief Host test of src/power.c: sleep accounting, waking from stop on EXTI0, even on a press just as
+ * the core stops, and the title screen's idle, demo and stop transitions.
+ */
+
+#include "check.h"
+#include "power.h"
+#include "clock.h"
+
+/*
+ * The board: TIM2 (micros) and the RTC run together while the core is
+ * awake or asleep, and SysTick interrupts every 1000 us of TIM2. In stop
+ * mode only the RTC runs. The button is pressed at press_us on the RTC,
+ * if it is set; a stop wakes up early, without the button, at stray_us.
+ * With press_at_stop set, the press comes just as the core goes into
+ * stop. A press while interrupts are masked is pending until they are
+ * unmasked, and wakes WFI at once. A stop with no press pending or coming
+ * and no stray wakeup would last for ever: it is counted in stuck.
+ */
+static uint32_t tim2_us;
+static uint64_t rtc_us;
+static uint32_t next_tick_us = 1000;
+static uint64_t press_us; // 0 for no press coming
+static uint64_t stray_us; // 0 for none
+static int press_at_stop;
+static int masked, pending;
+static unsigned int wfis, stops, stuck;
+
+uint32_t micros(void)
+{
+    return tim2_us;
+}
+
+uint32_t power_host_rtc_us(void)
+{
+    return (uint32_t)rtc_us;
+}
+
+/* Time passing with the core awake or asleep; SysTick interrupts on the way */
+static void work(uint32_t us)
+{
+    tim2_us += us;
+    rtc_us += us;
+    while ((int32_t)(tim2_us - next_tick_us) >= 0)
+    {
+        next_tick_us += 1000;
+        SysTick_Handler();
+    }
+}
+
+static void press(void)
+{
+    press_us = 0;
+    if (masked)
+        pending = 1;
+    else
+        EXTI0_1_IRQHandler();
+}
+
+void power_host_irq(int enable)
+{
+    masked = !enable;
+    if (enable && pending)
+    {
+        pending = 0;
+        EXTI0_1_IRQHandler();
+    }
+}
+
+void power_host_wfi(int stop)
+{
+    if (stop)
+    {
+        stops++;
+        if (press_at_stop)
+        {
+            press_at_stop = 0;
+            press();
+        }
+        if (pending)
+            return;
+        if (stray_us && (!press_us || stray_us < press_us))
+        {
+            rtc_us = stray_us;
+            stray_us = 0;
+            return;
+        }
+        if (press_us)
+        {
+            rtc_us = press_us;
+            press();
+        }
+        else
+            stuck++;
+        return;
+    }
+
+    // sleep mode: until the next tick, or the press if that comes first
+    wfis++;
+    uint32_t to_tick = next_tick_us - tim2_us;
+    if (press_us && press_us - rtc_us < to_tick)
+    {
+        work((uint32_t)(press_us - rtc_us));
+        press();
+        return;
+    }
+    work(to_tick);
+}
+
+static void start(void)
+{
+    clock_init(); // CLOCK_FULL
+    power_init();
+    power_button_event();
+}
+
+/* Working 200 us of every 1000 us tick is 20% awake, charged at the profile's currents */
+static void test_sleep_ratio(void)
+{
+    start();
+    PowerStats before;
+    power_stats(&before);
+    uint32_t ms = millis();
+    for (int i = 0; i < 1000; i++)
+    {
+        work(200);
+        power_sleep();
+    }
+    PowerStats s;
+    power_stats(&s);
+    CHECK_EQ(millis() - ms, 1000);
+    CHECK_EQ(s.sleeps - before.sleeps, 1000);
+    CHECK_EQ(s.awake_us - before.awake_us, 200000);
+    CHECK_EQ(s.sleep_us - before.sleep_us, 800000);
+    CHECK_EQ(s.stop_us - before.stop_us, 0);
+    PowerStats d = {s.awake_us - before.awake_us, s.sleep_us - before.sleep_us, 0, 0, 0,
+                    s.charge - before.charge};
+    const ClockProfile *p = &clock_profiles[CLOCK_FULL];
+    CHECK_EQ(power_estimate_ua(&d), (p->run_ua * 2 + p->sleep_ua * 8) / 10);
+}
+
+/* delay_ms sleeps through at least the whole time asked for, and never spins */
+static void test_delay(void)
+{
+    start();
+    work(700); // part way into a tick
+    uint32_t from = tim2_us;
+    unsigned int wfi0 = wfis;
+    delay_ms(120);
+    CHECK(tim2_us - from >= 120000);
+    CHECK(tim2_us - from <= 121000);
+    CHECK_EQ(wfis - wfi0, 121);
+}
+
+/* Stop mode lasts until the button, however often something else wakes it, and is timed by the RTC */
+static void test_wake_on_exti(void)
+{
+    start();
+    PowerStats before;
+    power_stats(&before);
+    uint32_t ms = millis();
+    uint32_t tim2 = tim2_us;
+    stops = 0;
+    stray_us = rtc_us + 1000000;
+    press_us = rtc_us + 5000000;
+    power_stop();
+    CHECK_EQ(stops, 2); // the stray wakeup went back to stop
+    CHECK_EQ(press_us, 0);
+    CHECK(power_button_event());
+    CHECK_EQ(millis(), ms); // SysTick and TIM2 halt in stop
+    CHECK_EQ(tim2_us, tim2);
+    PowerStats s;
+    power_stats(&s);
+    CHECK_EQ(s.stops - before.stops, 1);
+    CHECK_EQ(s.stop_us - before.stop_us, 5000000);
+
+    // a press that came first is not waited for again
+    stops = 0;
+    press();
+    power_stop();
+    CHECK_EQ(stops, 0);
+    power_button_event();
+
+    // a press just as the core stops is not lost
+    stops = stuck = 0;
+    press_at_stop = 1;
+    power_stop();
+    CHECK_EQ(stuck, 0);
+    CHECK_EQ(stops, 1);
+    CHECK(power_button_event());
+    CHECK(!masked);
+
+    // and a press wakes sleep mode too, before the tick
+    uint32_t half = (next_tick_us - tim2_us) / 2;
+    press_us = rtc_us + half;
+    uint32_t from = tim2_us;
+    power_sleep();
+    CHECK_EQ(tim2_us - from, half);
+    CHECK(power_button_event());
+    CHECK(!power_button_event());
+}
+
+/* The title screen, as main.c's wait_for_start() runs it, with nobody pressing the button */
+static attract_t title_screen(uint32_t shown, uint32_t idle_since)
+{
+    for (;;)
+    {
+        attract_t next = power_attract(millis(), shown, idle_since);
+        if (next != ATTRACT_WAIT)
+            return next;
+        work(50);
+        power_sleep();
+    }
+}
+
+static void test_attract(void)
+{
+    CHECK_EQ(power_attract(9999, 0, 0), ATTRACT_WAIT);
+    CHECK_EQ(power_attract(10000, 0, 0), ATTRACT_DEMO);
+    CHECK_EQ(power_attract(30000, 20000, 0), ATTRACT_STOP); // idle time wins over a demo that is due
+    CHECK_EQ(power_attract(5, 0xfffffff0u, 0xfffffff0u), ATTRACT_WAIT); // millis() wraps
+
+    start();
+    uint32_t idle_since = millis();
+    uint32_t shown = idle_since;
+
+    // idle: a demo game after ATTRACT_DEMO_MS
+    CHECK_EQ(title_screen(shown, idle_since), ATTRACT_DEMO);
+    CHECK_EQ(millis() - shown, ATTRACT_DEMO_MS);
+
+    // a 15 s demo game, which counts as idle; the title screen then goes to stop before another demo
+    while (millis() - idle_since < 25000)
+        power_sleep();
+    shown = millis();
+    CHECK_EQ(title_screen(shown, idle_since), ATTRACT_STOP);
+    CHECK_EQ(millis() - idle_since, ATTRACT_STOP_MS);
+    CHECK_EQ(millis() - shown, ATTRACT_STOP_MS - 25000);
+
+    // stop until a press a minute later, then idle starts over
+    PowerStats before;
+    power_stats(&before);
+    press_us = rtc_us + 60000000;
+    power_stop();
+    CHECK(power_button_event());
+    idle_since = shown = millis();
+    PowerStats s;
+    power_stats(&s);
+    CHECK_EQ(s.stop_us - before.stop_us, 60000000);
+    CHECK_EQ(title_screen(shown, idle_since), ATTRACT_DEMO);
+
+    // over everything so far, mostly asleep or stopped
+    power_stats(&s);
+    uint64_t all = (uint64_t)s.awake_us + s.sleep_us + s.stop_us;
+    CHECK(s.awake_us * 10 < all);
+    CHECK(power_estimate_ua(&s) < clock_profiles[CLOCK_FULL].sleep_ua);
+}
+
+int main(void)
+{
+    test_sleep_ratio();
+    test_delay();
+    test_wake_on_exti();
+    test_attract();
+    return check_done("power");
+}
@@ -0,0 +1,231 @@
+/**
+ * @file test_sched.c
+ * @brief Host stress test of src/sched.c under SCHED_HOST: producer threads post against the PendSV
+ * thread draining the queues. Posts of a queued task coalesce and none is lost, urgent tasks run before
+ * background ones, and runs past their deadline are counted as overruns.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "check.h"
+#include "sched.h"
+
+#define PRODUCERS 3
+#define PER_PRIO 4 // tasks in each queue, fewer than SCHED_QUEUE_LEN, so a post is refused only if queued
+#define TASKS (2 * PER_PRIO)
+
+static void run_task(int i);
+
+#define RUNNER(i)                \
+    static void run_##i(void)    \
+    {                            \
+        run_task(i);             \
+    }
+RUNNER(0)
+RUNNER(1)
+RUNNER(2)
+RUNNER(3)
+RUNNER(4)
+RUNNER(5)
+RUNNER(6)
+RUNNER(7)
+
+/* 0 to 3 urgent, 4 to 7 background; deadlines long enough never to be missed here */
+static Task tasks[TASKS] = {
+    TASK(run_0, SCHED_URGENT, 10000000),     TASK(run_1, SCHED_URGENT, 10000000),
+    TASK(run_2, SCHED_URGENT, 10000000),     TASK(run_3, SCHED_URGENT, 10000000),
+    TASK(run_4, SCHED_BACKGROUND, 10000000), TASK(run_5, SCHED_BACKGROUND, 10000000),
+    TASK(run_6, SCHED_BACKGROUND, 10000000), TASK(run_7, SCHED_BACKGROUND, 10000000),
+};
+
+/* Counted on the producers' side, per task */
+static pthread_mutex_t counts = PTHREAD_MUTEX_INITIALIZER;
+static unsigned int posted[TASKS], coalesced[TASKS];
+
+/* The order tasks ran in, while recording */
+static volatile int recording;
+static int order[64];
+static volatile int order_len;
+
+/* Set while a task is running, to catch two at once */
+static volatile int running;
+static volatile unsigned int concurrent;
+
+static void run_task(int i)
+{
+    if (__atomic_exchange_n(&running, 1, __ATOMIC_SEQ_CST))
+        concurrent++;
+    if (recording && order_len < 64)
+        order[order_len++] = i;
+    for (volatile int spin = 0; spin < 200; spin++)
+        ;
+    __atomic_store_n(&running, 0, __ATOMIC_SEQ_CST);
+}
+
+static void post(int i)
+{
+    int queued = sched_post(&tasks[i]);
+    pthread_mutex_lock(&counts);
+    if (queued)
+        posted[i]++;
+    else
+        coalesced[i]++;
+    pthread_mutex_unlock(&counts);
+}
+
+static void reset(void)
+{
+    for (int i = 0; i < TASKS; i++)
+        tasks[i].runs = tasks[i].overruns = tasks[i].worst_us = 0;
+    memset(posted, 0, sizeof posted);
+    memset(coalesced, 0, sizeof coalesced);
+}
+
+/*
+ * Free running: producers post at random as the drain runs what they post.
+ * Every post that queued a task is one run, and once they stop and the
+ * queues drain, nothing is left queued.
+ */
+static void *producer(void *arg)
+{
+    unsigned int seed = (unsigned int)(uintptr_t)arg;
+    for (int n = 0; n < 20000; n++)
+    {
+        post(rand_r(&seed) % TASKS);
+        if (rand_r(&seed) % 64 == 0)
+            usleep(rand_r(&seed) % 50);
+    }
+    return 0;
+}
+
+static void test_no_post_lost(void)
+{
+    reset();
+    sched_init();
+    pthread_t p[PRODUCERS];
+    for (int i = 0; i < PRODUCERS; i++)
+        pthread_create(&p[i], 0, producer, (void *)(uintptr_t)(i + 40));
+    for (int i = 0; i < PRODUCERS; i++)
+        pthread_join(p[i], 0);
+    sched_host_stop(); // runs whatever is still queued
+
+    unsigned int runs = 0, merged = 0;
+    for (int i = 0; i < TASKS; i++)
+    {
+        CHECK_EQ(tasks[i].runs, posted[i]);
+        CHECK_EQ(tasks[i].queued, 0);
+        CHECK_EQ(tasks[i].overruns, 0);
+        runs += tasks[i].runs;
+        merged += coalesced[i];
+    }
+    CHECK_EQ(runs + merged, PRODUCERS * 20000);
+    CHECK(merged > 0); // some posts found their task already queued
+    CHECK_EQ(concurrent, 0);
+    printf("free running: %d posts, %u runs, %u coalesced\n", PRODUCERS * 20000, runs, merged);
+}
+
+/*
+ * Held up: a gate task keeps the drain busy while the producers post every
+ * task many times over, background and urgent mixed. When it opens, each
+ * task runs exactly once, and every urgent one before any background one.
+ */
+static volatile int gate_open, gate_entered;
+
+static void gate(void)
+{
+    gate_entered = 1;
+    while (!gate_open)
+        usleep(10);
+}
+
+static Task gate_task = TASK(gate, SCHED_URGENT, 10000000);
+
+static void *flood(void *arg)
+{
+    unsigned int seed = (unsigned int)(uintptr_t)arg;
+    for (int n = 0; n < 500; n++)
+        post(rand_r(&seed) % TASKS);
+    for (int i = TASKS - 1; i >= 0; i--) // the background ones first, for good measure
+        post(i);
+    return 0;
+}
+
+static void test_urgent_first(void)
+{
+    for (int round = 0; round < 20; round++)
+    {
+        reset();
+        sched_init();
+        gate_open = gate_entered = 0;
+        sched_post(&gate_task);
+        while (!gate_entered)
+            usleep(10);
+
+        order_len = 0;
+        recording = 1;
+        pthread_t p[PRODUCERS];
+        for (int i = 0; i < PRODUCERS; i++)
+            pthread_create(&p[i], 0, flood, (void *)(uintptr_t)(round * 10 + i));
+        for (int i = 0; i < PRODUCERS; i++)
+            pthread_join(p[i], 0);
+        gate_open = 1;
+        sched_host_stop();
+        recording = 0;
+
+        CHECK_EQ(order_len, TASKS); // each once, however often it was posted
+        int background_seen = 0, urgent_after = 0;
+        for (int k = 0; k < order_len; k++)
+        {
+            if (tasks[order[k]].prio == SCHED_BACKGROUND)
+                background_seen = 1;
+            else if (background_seen)
+                urgent_after = 1;
+        }
+        CHECK(!urgent_after);
+    }
+}
+
+/*
+ * Overruns: a task that takes 2 ms against a 1 ms deadline overruns every
+ * run, one with room to spare never does, and the total is theirs.
+ */
+static void sleep_2ms(void)
+{
+    usleep(2000);
+}
+
+static Task late = TASK(sleep_2ms, SCHED_URGENT, 1000);
+static Task on_time = TASK(sleep_2ms, SCHED_BACKGROUND, 1000000);
+
+static void test_overruns(void)
+{
+    sched_init();
+    uint32_t before = sched_overruns();
+    late.runs = late.overruns = late.worst_us = 0;
+    on_time.runs = on_time.overruns = on_time.worst_us = 0;
+    for (int n = 0; n < 10; n++)
+    {
+        sched_post(&late);
+        sched_post(&on_time);
+        while (on_time.runs <= (uint32_t)n) // both ran, however slow the host, so neither post coalesces
+            usleep(500);
+    }
+    sched_host_stop();
+
+    CHECK_EQ(late.runs, 10);
+    CHECK_EQ(late.overruns, 10);
+    CHECK(late.worst_us >= 2000);
+    CHECK_EQ(on_time.runs, 10);
+    CHECK_EQ(on_time.overruns, 0);
+    CHECK_EQ(sched_overruns() - before, 10);
+}
+
+int main(void)
+{
+    test_no_post_lost();
+    test_urgent_first();
+    test_overruns();
+    return check_done("sched");
+}
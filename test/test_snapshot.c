@@ -0,0 +1,185 @@
+/**
+ * @file test_snapshot.c
+ * @brief Host stress test of src/snapshot.c: a GameView published by one writer is never handed out
+ * torn, to reader threads running alongside it, or to a reader the writer interrupts mid-copy.
+ */
+
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "check.h"
+#include "snapshot.h"
+#include "game.h"
+
+#define READERS 3
+#define GENERATIONS 200000
+
+static Snapshot snap;
+static GameView bufs[2];
+
+/* Every byte of a generation's view says which generation it is, so a mix of two shows */
+static void fill(GameView *v, uint32_t gen)
+{
+    memset(v, (uint8_t)gen, sizeof *v);
+}
+
+static int whole(const GameView *v, uint32_t gen)
+{
+    const uint8_t *p = (const uint8_t *)v;
+    for (unsigned int i = 0; i < sizeof *v; i++)
+        if (p[i] != (uint8_t)gen)
+            return 0;
+    return 1;
+}
+
+static void start(void)
+{
+    GameView first;
+    fill(&first, 0);
+    snapshot_init(&snap, &bufs[0], &bufs[1], sizeof first, &first);
+}
+
+/* Write one generation, giving the CPU away half way through every so often */
+static void write_generation(int pause)
+{
+    GameView *v = snapshot_begin(&snap);
+    uint32_t gen = snap.writing;
+    memset(v, (uint8_t)gen, sizeof *v / 2);
+    if (pause)
+        usleep(1);
+    memset((uint8_t *)v + sizeof *v / 2, (uint8_t)gen, sizeof *v - sizeof *v / 2);
+    snapshot_publish(&snap);
+}
+
+/*
+ * Threads: one writer, as fast as it can go, against readers doing the same.
+ */
+static volatile int writer_done;
+
+typedef struct
+{
+    unsigned int reads, torn, backwards;
+} ReaderStats;
+
+static void *writer(void *arg)
+{
+    for (int i = 0; i < GENERATIONS; i++)
+        write_generation(i % 64 == 0);
+    writer_done = 1;
+    return 0;
+}
+
+static void *reader(void *arg)
+{
+    ReaderStats *s = arg;
+    uint32_t last = 0;
+    GameView v;
+    while (!writer_done)
+    {
+        uint32_t gen = snapshot_read(&snap, &v);
+        s->reads++;
+        if (!whole(&v, gen))
+            s->torn++;
+        if ((int32_t)(gen - last) < 0)
+            s->backwards++;
+        last = gen;
+    }
+    return 0;
+}
+
+static void test_threads(void)
+{
+    start();
+    writer_done = 0;
+    uint32_t retries = snapshot_retries();
+    pthread_t w, r[READERS];
+    ReaderStats stats[READERS];
+    memset(stats, 0, sizeof stats);
+    for (int i = 0; i < READERS; i++)
+        pthread_create(&r[i], 0, reader, &stats[i]);
+    pthread_create(&w, 0, writer, 0);
+    pthread_join(w, 0);
+    for (int i = 0; i < READERS; i++)
+    {
+        pthread_join(r[i], 0);
+        CHECK(stats[i].reads > 0);
+        CHECK_EQ(stats[i].torn, 0);
+        CHECK_EQ(stats[i].backwards, 0); // a newer generation is never followed by an older one
+    }
+    CHECK_EQ(snap.published, GENERATIONS);
+    printf("threads: %u, %u and %u reads of %d generations, %u retries\n", stats[0].reads, stats[1].reads,
+           stats[2].reads, GENERATIONS, (unsigned int)(snapshot_retries() - retries));
+}
+
+/*
+ * The writer as an interrupt: a thread signals the reader, and the handler
+ * writes two generations on top of whatever the reader was doing, as the
+ * physics step does to the renderer. A copy it lands in the middle of has
+ * had its buffer started over, and must be retried. A naive copy, with no
+ * check, shows that it does land there.
+ */
+static volatile int interrupting;
+static volatile unsigned int interrupts;
+
+static void interrupt_handler(int sig)
+{
+    write_generation(0);
+    write_generation(0);
+    interrupts++;
+}
+
+static void *interrupter(void *arg)
+{
+    pthread_t target = *(pthread_t *)arg;
+    unsigned int seed = 39;
+    while (interrupting)
+    {
+        usleep(rand_r(&seed) % 50);
+        pthread_kill(target, SIGUSR1);
+    }
+    return 0;
+}
+
+static void test_interrupted(void)
+{
+    start();
+    signal(SIGUSR1, interrupt_handler);
+    uint32_t retries = snapshot_retries();
+    unsigned int reads = 0, torn = 0, naive_torn = 0;
+    GameView v;
+
+    pthread_t self = pthread_self(), irq;
+    interrupting = 1;
+    pthread_create(&irq, 0, interrupter, &self);
+    time_t until = time(0) + 10;
+    while (time(0) < until && (naive_torn < 3 || snapshot_retries() - retries < 3))
+    {
+        uint32_t gen = snapshot_read(&snap, &v);
+        reads++;
+        if (!whole(&v, gen))
+            torn++;
+
+        gen = snap.published;
+        memcpy(&v, &bufs[gen & 1], sizeof v);
+        if (!whole(&v, gen))
+            naive_torn++;
+    }
+    interrupting = 0;
+    pthread_join(irq, 0);
+    signal(SIGUSR1, SIG_DFL);
+
+    CHECK_EQ(torn, 0);
+    CHECK(naive_torn > 0);                  // the interrupts did land mid-copy
+    CHECK(snapshot_retries() - retries > 0); // and snapshot_read saw them do it
+    printf("interrupted: %u reads, %u interrupts, %u retries; %u naive copies torn\n", reads, interrupts,
+           (unsigned int)(snapshot_retries() - retries), naive_torn);
+}
+
+int main(void)
+{
+    test_threads();
+    test_interrupted();
+    return check_done("snapshot");
+}
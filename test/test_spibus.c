@@ -0,0 +1,403 @@
+/**
+ * @file test_spibus.c
+ * @brief Host test of src/spibus.c and src/pins.c on the bus's register fake: SPI1 and the chip selects
+ * are set up for each device in turn, a parked display yields to the card, a display that parks the bus
+ * is made to yield it to a card interrupting from another thread, a card refused a held bus is granted
+ * it through its task once the display lets go, and the two are never selected together. Refused
+ * devices are granted the bus most urgent first, then in the order they asked, and a chip select on a
+ * pin someone else has is refused.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "check.h"
+#include "spibus.h"
+#include "clock.h"
+
+/*
+ * One core. Whoever holds cpu is running: the main thread takes it for each
+ * step it makes, and the card's "interrupt" thread, and the PendSV thread
+ * that runs its grant task, for the whole of their handler. So interrupts
+ * come between the main thread's bus calls, at random, and run to the end.
+ */
+static pthread_mutex_t cpu = PTHREAD_MUTEX_INITIALIZER;
+
+#define DISPLAY_CS PIN('B', 8)
+#define CARD_CS PIN('B', 2)
+
+static void display_yield(void);
+static void card_granted(void);
+
+static Task card_grant = TASK(card_granted, SCHED_URGENT, 1000000);
+static SpiDevice display = SPIBUS_DEVICE("lcd", DISPLAY_CS, 16, 1, CLOCK_SPI1_FAST_HZ, display_yield, 0);
+static SpiDevice card = SPIBUS_DEVICE("sdcard", CARD_CS, 8, 0, CLOCK_SPI1_HZ, 0, &card_grant);
+
+/* What the chip selects did */
+static volatile int selected[2]; // display, card
+static volatile unsigned int overlaps, wrong_owner;
+
+static void watch(uint8_t pin, int on)
+{
+    int i = pin == CARD_CS;
+    selected[i] = on;
+    if (selected[0] && selected[1])
+        overlaps++;
+    if (on && spibus_owner() != (i ? &card : &display))
+        wrong_owner++; // selected by a device that does not hold the bus
+}
+
+enum
+{
+    IDLE,
+    HELD,
+    PARKED
+};
+static volatile int display_state;
+static volatile unsigned int yields, bad_yields;
+
+/* As LCD_Flush: let the row going out finish, then release */
+static void display_yield(void)
+{
+    if (display_state != PARKED)
+        bad_yields++;
+    yields++;
+    display_state = IDLE;
+    spibus_release(&display);
+}
+
+static volatile int card_waiting;
+static volatile unsigned int card_reads, card_refusals, card_task_grants, unexpected;
+
+/* A block read once the card has the bus */
+static void card_read(void)
+{
+    if (!selected[1] || selected[0] || (spibus_host.spi.CR2 >> 8 & 15) != 7)
+        unexpected++; // selected alone, with 8 bit frames
+    card_reads++;
+    card_waiting = 0;
+    spibus_release(&card);
+}
+
+/* The card asks for the bus from an interrupt */
+static void card_interrupt(void)
+{
+    int before = display_state;
+    unsigned int yielded = spibus_stats.yields;
+    if (spibus_acquire(&card))
+    {
+        if ((before == PARKED) != (spibus_stats.yields - yielded == 1))
+            unexpected++; // the display yielded exactly when it was parked
+        card_read();
+        return;
+    }
+    if (before != HELD)
+        unexpected++; // refused only while the display is busy with it
+    card_refusals++;
+    card_waiting = 1;
+}
+
+/* The grant task, when the display releases the bus */
+static void card_granted(void)
+{
+    pthread_mutex_lock(&cpu);
+    if (card_waiting && spibus_acquire(&card))
+    {
+        card_task_grants++;
+        card_read();
+    }
+    else if (card_waiting)
+        card_refusals++; // the display took it back first; the next release posts this again
+    pthread_mutex_unlock(&cpu);
+}
+
+static volatile int running;
+
+static void *card_thread(void *arg)
+{
+    unsigned int seed = 39;
+    while (running)
+    {
+        usleep(rand_r(&seed) % 200);
+        pthread_mutex_lock(&cpu);
+        if (!card_waiting)
+            card_interrupt();
+        pthread_mutex_unlock(&cpu);
+    }
+    return 0;
+}
+
+/* The display: draw, sometimes leaving the last row going out with the bus parked */
+static void display_step(void)
+{
+    switch (display_state)
+    {
+    case IDLE:
+        if (!spibus_acquire(&display))
+            unexpected++; // the card never keeps it outside its handler
+        display_state = HELD;
+        break;
+    case HELD:
+        if (rand() % 3 == 0)
+        {
+            display_state = IDLE;
+            spibus_release(&display);
+        }
+        else
+        {
+            display_state = PARKED;
+            spibus_park(&display);
+        }
+        break;
+    case PARKED: // the next row, if it is still ours
+        if (spibus_owner() != &display || !selected[0])
+            unexpected++;
+        display_state = HELD;
+        spibus_unpark(&display);
+        break;
+    }
+}
+
+/* The fields of the register fake */
+static unsigned int br(void)
+{
+    return spibus_host.spi.CR1 >> 3 & 7;
+}
+
+static unsigned int data_bits(void)
+{
+    return (spibus_host.spi.CR2 >> 8 & 15) + 1;
+}
+
+static int high(uint8_t pin)
+{
+    return spibus_host.gpio[PIN_PORT(pin)].ODR >> PIN_NUM(pin) & 1;
+}
+
+static unsigned int mode(uint8_t pin)
+{
+    return spibus_host.gpio[PIN_PORT(pin)].MODER >> (2 * PIN_NUM(pin)) & 3;
+}
+
+/* The chip select writes, in order: pin, or pin | 0x80 for selected */
+static uint8_t cs_log[16];
+static unsigned int cs_len;
+
+static void log_cs(uint8_t pin, int on)
+{
+    if (cs_len < sizeof cs_log)
+        cs_log[cs_len++] = pin | (on ? 0x80 : 0);
+}
+
+#define SPE (1u << 6)
+
+static void test_registers(void)
+{
+    memset(&spibus_host, 0, sizeof spibus_host);
+    clock_init();
+    spibus_init();
+    uint32_t sysclk = clock_timing()->sysclk_hz;
+    for (int n = 3; n <= 5; n++)
+    {
+        CHECK_EQ(mode(PIN('B', n)), 2); // SCK, MISO and MOSI on their alternate function
+        CHECK(strcmp(pin_owner(PIN('B', n)), "spi1") == 0);
+    }
+    CHECK(spibus_host.spi.CR1 & SPE);
+    CHECK_EQ(br(), 7); // the slowest until someone is granted it
+    CHECK_EQ(data_bits(), 8);
+
+    CHECK_EQ(spibus_attach(&display), SPIBUS_OK);
+    CHECK_EQ(spibus_attach(&card), SPIBUS_OK);
+    CHECK_EQ(mode(DISPLAY_CS), 1);
+    CHECK_EQ(mode(CARD_CS), 1);
+    CHECK(high(DISPLAY_CS) && high(CARD_CS));
+    CHECK(strcmp(pin_owner(CARD_CS), "sdcard") == 0);
+    memset(&spibus_stats, 0, sizeof spibus_stats);
+
+    // the display: its divisor and 16 bit frames, then selected
+    CHECK(spibus_acquire(&display));
+    CHECK_EQ(br(), clock_spi_br(sysclk, CLOCK_SPI1_FAST_HZ));
+    CHECK_EQ(data_bits(), 16);
+    CHECK(spibus_host.spi.CR1 & SPE);
+    CHECK(!high(DISPLAY_CS) && high(CARD_CS));
+    spibus_host.rx = 3; // read back and never collected
+    spibus_release(&display);
+    CHECK(high(DISPLAY_CS));
+
+    // back to the display: nothing to write
+    CHECK(spibus_acquire(&display));
+    spibus_release(&display);
+    CHECK_EQ(spibus_stats.switches, 1);
+    CHECK_EQ(spibus_stats.rebauds, 1);
+    CHECK_EQ(spibus_host.rx, 3);
+
+    // the card: its own divisor and 8 bit frames, with the display's bytes gone from the FIFO
+    CHECK(spibus_acquire(&card));
+    CHECK_EQ(br(), clock_spi_br(sysclk, CLOCK_SPI1_HZ));
+    CHECK(br() != clock_spi_br(sysclk, CLOCK_SPI1_FAST_HZ));
+    CHECK_EQ(data_bits(), 8);
+    CHECK_EQ(spibus_host.rx, 0);
+    CHECK(high(DISPLAY_CS) && !high(CARD_CS));
+    spibus_bits(&display, 9); // not the display's registers now: kept for its next turn
+    CHECK_EQ(data_bits(), 8);
+    spibus_release(&card);
+    CHECK(spibus_acquire(&display));
+    CHECK_EQ(data_bits(), 9);
+    spibus_bits(&display, 16); // its registers: at once
+    CHECK_EQ(data_bits(), 16);
+    CHECK_EQ(spibus_stats.switches, 3);
+    CHECK_EQ(spibus_stats.rebauds, 3);
+
+    // parked, the display is made to let go when the card asks, and is deselected first
+    spibus_host.chip_select = log_cs;
+    cs_len = 0;
+    display_state = PARKED;
+    spibus_park(&display);
+    CHECK(spibus_acquire(&card));
+    CHECK_EQ(spibus_stats.yields, 1);
+    CHECK_EQ(yields, 1);
+    CHECK(spibus_owner() == &card);
+    CHECK_EQ(cs_len, 2);
+    CHECK_EQ(cs_log[0], DISPLAY_CS);
+    CHECK_EQ(cs_log[1], CARD_CS | 0x80);
+    spibus_release(&card);
+    CHECK_EQ(spibus_stats.refusals, 0);
+    CHECK_EQ(spibus_host.faults, 0); // no divisor changed with the SPI enabled, nor frame size while busy
+    spibus_host.chip_select = 0;
+    display_state = IDLE;
+    yields = 0;
+}
+
+static void test_park_and_yield(void)
+{
+    clock_init();
+    spibus_init();
+    memset(&spibus_stats, 0, sizeof spibus_stats);
+    spibus_host.chip_select = watch;
+    CHECK_EQ(spibus_attach(&display), SPIBUS_OK);
+    CHECK_EQ(spibus_attach(&card), SPIBUS_OK);
+    sched_init();
+
+    running = 1;
+    pthread_t irq;
+    pthread_create(&irq, 0, card_thread, 0);
+    for (int i = 0; i < 200000 && (i < 20000 || yields < 20 || card_task_grants < 20); i++)
+    {
+        pthread_mutex_lock(&cpu);
+        display_step();
+        pthread_mutex_unlock(&cpu);
+        if (rand() % 4 == 0)
+            usleep(rand() % 100);
+    }
+    running = 0;
+    pthread_join(irq, 0);
+
+    // the display finishes, and a card still waiting gets its turn
+    pthread_mutex_lock(&cpu);
+    if (display_state == PARKED)
+        spibus_unpark(&display);
+    display_state = IDLE;
+    spibus_release(&display);
+    pthread_mutex_unlock(&cpu);
+    sched_host_stop();
+
+    CHECK_EQ(overlaps, 0);
+    CHECK_EQ(wrong_owner, 0);
+    CHECK_EQ(unexpected, 0);
+    CHECK_EQ(bad_yields, 0);
+    CHECK_EQ(card_waiting, 0); // every refusal was made good
+    CHECK_EQ(spibus_stats.yields, yields);
+    CHECK_EQ(spibus_stats.refusals, card_refusals);
+    CHECK(yields > 0);
+    CHECK(card_task_grants > 0);
+    CHECK(spibus_stats.rebauds > 0); // 24 MHz for the display, 12 for the card
+    CHECK(spibus_owner() == 0);
+    printf("park and yield: %u card reads, %u from a parked display, %u refused then granted by task\n",
+           card_reads, yields, card_task_grants);
+}
+
+/*
+ * A pin that is someone else's: the device is refused, the pin is left as
+ * it was, and the first refusal is kept.
+ */
+static SpiDevice button = SPIBUS_DEVICE("button", CARD_CS, 8, 1, CLOCK_SPI1_HZ, 0, 0);
+static SpiDevice eeprom = SPIBUS_DEVICE("eeprom", PIN('B', 4), 8, 1, CLOCK_SPI1_HZ, 0, 0);
+
+static void test_pin_conflict(void)
+{
+    uint32_t moder = spibus_host.gpio[1].MODER, odr = spibus_host.gpio[1].ODR;
+    CHECK_EQ(spibus_attach(&button), SPIBUS_ERROR);
+    CHECK_EQ(pin_conflict.pin, CARD_CS);
+    CHECK(pin_conflict.owner && strcmp(pin_conflict.owner, "sdcard") == 0);
+    CHECK(pin_conflict.claimant && strcmp(pin_conflict.claimant, "button") == 0);
+    CHECK_EQ(spibus_attach(&eeprom), SPIBUS_ERROR); // MISO
+    CHECK(strcmp(pin_conflict.claimant, "button") == 0);
+    CHECK_EQ(spibus_host.gpio[1].MODER, moder);
+    CHECK_EQ(spibus_host.gpio[1].ODR, odr);
+    CHECK(strcmp(pin_owner(CARD_CS), "sdcard") == 0);
+    CHECK_EQ(spibus_attach(&card), SPIBUS_OK); // again, under its own name
+}
+
+/*
+ * Grant order. With the PendSV thread stopped, a posted grant task stays
+ * queued, so what each release posts can be seen. Every device still
+ * takes its turn after being refused, as its task would make it.
+ */
+static void granted(void)
+{
+}
+
+static Task flash_grant = TASK(granted, SCHED_URGENT, 1000000);
+static Task dac_grant = TASK(granted, SCHED_URGENT, 1000000);
+static SpiDevice flash = SPIBUS_DEVICE("flash", PIN('A', 4), 8, 1, CLOCK_SPI1_HZ, 0, &flash_grant);
+static SpiDevice dac = SPIBUS_DEVICE("dac", PIN('C', 7), 16, 1, CLOCK_SPI1_SLOW_HZ, 0, &dac_grant);
+
+static void test_grant_order(void)
+{
+    // the two that were refused their pins left room for these
+    CHECK_EQ(spibus_attach(&flash), SPIBUS_OK);
+    CHECK_EQ(spibus_attach(&dac), SPIBUS_OK);
+    memset(&spibus_stats, 0, sizeof spibus_stats);
+
+    // parked then carrying on, the display keeps the bus from everyone
+    CHECK(spibus_acquire(&display));
+    spibus_park(&display);
+    spibus_unpark(&display);
+    CHECK(!spibus_acquire(&flash));
+    CHECK(!spibus_acquire(&dac));
+    CHECK(!spibus_acquire(&flash)); // asking again keeps its place
+    CHECK(!spibus_acquire(&card));
+    CHECK_EQ(spibus_stats.refusals, 4);
+    CHECK_EQ(spibus_stats.yields, 0);
+    CHECK(spibus_owner() == &display);
+    CHECK(!high(DISPLAY_CS) && high(CARD_CS) && high(flash.cs) && high(dac.cs));
+    CHECK(flash.queued && flash.queued < dac.queued && dac.queued < card.queued);
+
+    // the card is the most urgent, though it asked last
+    spibus_release(&display);
+    CHECK(card_grant.queued && !flash_grant.queued && !dac_grant.queued);
+    CHECK(spibus_acquire(&card));
+    spibus_release(&card);
+    // then the first of the rest to ask
+    CHECK(flash_grant.queued && !dac_grant.queued);
+    CHECK(spibus_acquire(&flash));
+    CHECK_EQ(data_bits(), 8);
+    spibus_release(&flash);
+    CHECK(dac_grant.queued);
+    CHECK(spibus_acquire(&dac));
+    CHECK_EQ(data_bits(), 16);
+    CHECK_EQ(br(), clock_spi_br(clock_timing()->sysclk_hz, CLOCK_SPI1_SLOW_HZ));
+    spibus_release(&dac);
+    CHECK(!flash.queued && !dac.queued && !card.queued);
+    CHECK_EQ(spibus_host.faults, 0);
+}
+
+int main(void)
+{
+    test_registers();
+    test_park_and_yield();
+    test_pin_conflict();
+    test_grant_order();
+    return check_done("spibus");
+}
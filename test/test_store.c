@@ -0,0 +1,135 @@
+/**
+ * @file test_store.c
+ * @brief Host test of src/store.c and src/sdcard.c (SD_HOST) on card images from utils/sdimage.py, FAT16
+ * and FAT32, whole card and partitioned, in a directory and fragmented: every row of each asset streamed
+ * from the card, whole and in parts, is the row of the asset built into the firmware.
+ *
+ * The image paths are the arguments; utils/hostfixtures.py makes them. A name with "dir" in it has the
+ * files in LEVEL1/, and one with "frag" in it has their clusters out of order.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "store.h"
+#include "sdcard.h"
+#include "assets.h"
+
+typedef struct
+{
+    const char *file;
+    const Asset *builtin;
+} Stored;
+
+static const Stored stored[] = {
+    {"BACKGROU.565", &background},
+    {"BARRIER.565", &barrier},
+    {"BIRD.565", &bird},
+};
+
+#define N_STORED (sizeof stored / sizeof stored[0])
+
+/* Report the first row of an asset that is wrong, once */
+static int wrong(const char *image, const char *file, const char *what, int x, int y, int n)
+{
+    check_that(0, what, __FILE__, __LINE__);
+    printf("    %s: %s, %d pixels from (%d,%d)\n", image, file, n, x, y);
+    return 1;
+}
+
+static void test_asset(const char *image, const char *dir, const Stored *s, int fragmented)
+{
+    char path[32];
+    snprintf(path, sizeof path, "%s%s", dir, s->file);
+    StoreFile f;
+    AssetStream stream;
+    Asset a;
+    if (!CHECK_EQ(store_asset(path, &f, &stream, &a), STORE_OK))
+        return;
+    const Asset *want = s->builtin;
+    CHECK_EQ(a.width, want->width);
+    CHECK_EQ(a.height, want->height);
+    CHECK_EQ(f.size, 4 + 2u * want->width * want->height);
+    if (s->builtin == &background)
+        CHECK_EQ(f.contiguous, !fragmented); // many clusters either way
+
+    unsigned short got[320], row[320];
+    for (int y = 0; y < want->height; y++)
+    {
+        asset_row(&a, 0, y, want->width, got);
+        asset_row(want, 0, y, want->width, row);
+        if (memcmp(got, row, 2 * want->width) != 0)
+            if (wrong(image, path, "streamed rows are the built-in asset's", 0, y, want->width))
+                return;
+    }
+
+    // part rows anywhere, so reads go back in the file as well as on
+    srand(42);
+    for (int i = 0; i < 300; i++)
+    {
+        int y = rand() % want->height, x = rand() % want->width, n = 1 + rand() % (want->width - x);
+        asset_row(&a, x, y, n, got);
+        asset_row(want, x, y, n, row);
+        if (memcmp(got, row, 2 * n) != 0)
+            if (wrong(image, path, "streamed part rows are the built-in asset's", x, y, n))
+                return;
+    }
+
+    // and the whole file in one read, most of it straight into the buffer
+    uint8_t *all = malloc(f.size + 1);
+    uint32_t direct = store_stats.direct;
+    CHECK_EQ(store_read(&f, 0, f.size + 1, all), (int32_t)f.size);
+    for (int y = 0; y < want->height; y++)
+    {
+        asset_row(want, 0, y, want->width, row);
+        if (memcmp(all + 4 + 2 * y * want->width, row, 2 * want->width) != 0)
+            if (wrong(image, path, "one read of the file is the built-in asset", 0, y, want->width))
+                break;
+    }
+    if (f.size >= 3 * SD_BLOCK)
+        CHECK(store_stats.direct > direct);
+    free(all);
+}
+
+static void test_image(const char *path)
+{
+    const char *image = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    const char *dir = strstr(image, "dir") ? "LEVEL1/" : "";
+    int fragmented = strstr(image, "frag") != 0;
+
+    sd_host_image(path);
+    memset(&sd_stats, 0, sizeof sd_stats);
+    memset(&store_stats, 0, sizeof store_stats);
+    if (!CHECK_EQ(store_mount(), STORE_OK))
+    {
+        printf("    %s does not mount\n", image);
+        return;
+    }
+    for (unsigned int i = 0; i < N_STORED; i++)
+        test_asset(image, dir, &stored[i], fragmented);
+
+    StoreFile f;
+    CHECK_EQ(store_open("NOTHERE.565", &f), STORE_ERROR);
+    if (*dir)
+    {
+        CHECK_EQ(store_open("BIRD.565", &f), STORE_ERROR); // not in the root
+        CHECK_EQ(store_open("LEVEL1", &f), STORE_ERROR);   // a directory
+        CHECK_EQ(store_open("level1/../level1/bird.565", &f), STORE_OK);
+    }
+    CHECK_EQ(sd_stats.errors, 0);
+    if (!fragmented)
+        CHECK(sd_stats.multi > 0); // a fragmented file with one block clusters has no run to read
+    printf("%-16s %5u reads, %6u blocks (%u direct), %u cache hits, %u misses\n", image, sd_stats.commands,
+           sd_stats.blocks, store_stats.direct, store_stats.hits, store_stats.misses);
+}
+
+int main(int argc, char **argv)
+{
+    CHECK(argc > 1);
+    for (int i = 1; i < argc; i++)
+        test_image(argv[i]);
+
+    sd_host_image("no such image");
+    CHECK_EQ(store_mount(), STORE_ERROR);
+    return check_done("store");
+}
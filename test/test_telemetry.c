@@ -0,0 +1,219 @@
+/**
+ * @file test_telemetry.c
+ * @brief Host test of src/telemetry.c (TELEMETRY_HOST) end to end: a record of every type, then a burst
+ * that overflows the ring while the "DMA" is held, piped through utils/telemetry.py. The CSV has each
+ * record's fields as they were emitted, the records the ring dropped show up as a gap in the sequence and
+ * as the summary's lost count, and the summary adds the rest up.
+ *
+ * The arguments are the Python to run and a directory for the CSV and summary; utils/hostfixtures.py
+ * gives them. With none, the records just go to stdout, for piping into utils/telemetry.py by hand.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "check.h"
+#include "telemetry.h"
+
+/* Each record as utils/telemetry.py should decode it: its type and some of its CSV fields */
+typedef struct
+{
+    const char *type;
+    const char *fields;
+} Expected;
+
+static const Expected records[] = {
+    {"boot", "ts_us=1000 stage=0"},
+    {"boot", "ts_us=251000 stage=6"},
+    {"frame", "frame=7 render_us=1234 spi_bytes=65535 dropped_ticks=255"}, // clamped to their fields
+    {"input", "pressed=1"},
+    {"input", "pressed=0"},
+    {"score", "score=42"},
+    {"eeprom", "op=0 latency_us=350 status=0"},
+    {"eeprom", "op=1 latency_us=4100 status=-1"},
+    {"rate", "period_us=16666 peak_us=9000 misses=3"},
+    {"power", "window_ms=1000 sleep_permille=250 stop_permille=500 est_ua=1800"},
+    {"ramfunc", "kernel=1 flash_us=200 sram_us=150 pixels=1000"},
+    {"stack", "used=900 margin=124"},
+    {"arena", "peak=3000 size=4096 overflows=2"},
+    {"game", "score=99 autopilot=1"},
+};
+
+#define N_RECORDS (sizeof records / sizeof records[0])
+#define BURST 40     // frame records emitted while the "DMA" is held
+#define FRAME_LEN 16 // a frame record in the ring, framing and all
+#define QUEUED (TELEMETRY_RING_SIZE / FRAME_LEN)
+#define DROPPED (BURST - QUEUED)
+
+static void emit(void)
+{
+    telemetry_init();
+    telemetry_boot(0, 1000);
+    telemetry_boot(6, 251000);
+    telemetry_frame(7, 1234, 70000, 300);
+    telemetry_input(1);
+    telemetry_input(0);
+    telemetry_score(42);
+    telemetry_eeprom(TLM_EEPROM_READ, 350, 0);
+    telemetry_eeprom(TLM_EEPROM_WRITE, 4100, -1);
+    telemetry_rate(16666, 9000, 3);
+    telemetry_power(1000, 250, 500, 1800);
+    telemetry_ramfunc(1, 200, 150, 1000);
+    telemetry_stack(900, 124);
+    telemetry_arena(3000, 4096, 2);
+    telemetry_game(99, 1);
+
+    // the ring fills behind a held transfer and drops the rest
+    telemetry_host_hold(1);
+    for (int i = 0; i < BURST; i++)
+        telemetry_frame(100 + i, 5000, 20000, 0);
+    telemetry_host_hold(0);
+    telemetry_score(7); // shows the gap the dropped ones left
+}
+
+/* The CSV as read back: its header and rows */
+#define MAX_ROWS 64
+static char header[512];
+static char rows[MAX_ROWS][512];
+static int n_rows;
+
+/* Copy field col of a CSV line into out; the fields are plain, never quoted */
+static void field(const char *line, int col, char *out, size_t size)
+{
+    for (; col > 0 && line; col--)
+        line = strchr(line, ',') ? strchr(line, ',') + 1 : 0;
+    size_t n = line ? strcspn(line, ",\r\n") : 0;
+    if (n >= size)
+        n = size - 1;
+    memcpy(out, line ? line : "", n);
+    out[n] = 0;
+}
+
+/* The value of a named field of a row, or "" */
+static const char *value(const char *line, const char *name)
+{
+    static char out[64];
+    char col_name[32];
+    for (int col = 0; col < 32; col++)
+    {
+        field(header, col, col_name, sizeof col_name);
+        if (strcmp(col_name, name) == 0)
+        {
+            field(line, col, out, sizeof out);
+            return out;
+        }
+    }
+    return "";
+}
+
+static int check_row(int r, const char *type, const char *fields)
+{
+    if (!CHECK(r < n_rows))
+        return 0;
+    if (!check_that(strcmp(value(rows[r], "type"), type) == 0, "record type", __FILE__, __LINE__))
+    {
+        printf("    row %d is %s, want %s\n", r, value(rows[r], "type"), type);
+        return 0;
+    }
+    char want[256];
+    snprintf(want, sizeof want, "%s", fields);
+    for (char *f = strtok(want, " "); f; f = strtok(0, " "))
+    {
+        char *eq = strchr(f, '=');
+        *eq = 0;
+        if (!check_that(strcmp(value(rows[r], f), eq + 1) == 0, "decoded field", __FILE__, __LINE__))
+        {
+            printf("    row %d (%s) has %s=%s, want %s\n", r, type, f, value(rows[r], f), eq + 1);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void test_decoded(const char *python, const char *dir)
+{
+    char csv_path[256], summary_path[256], cmd[1024];
+    snprintf(csv_path, sizeof csv_path, "%s/run.csv", dir);
+    snprintf(summary_path, sizeof summary_path, "%s/summary.txt", dir);
+    snprintf(cmd, sizeof cmd, "%s utils/telemetry.py - --csv %s 2> %s", python, csv_path, summary_path);
+
+    // the encoder writes to stdout, so point stdout at the decoder while it runs
+    FILE *decoder = popen(cmd, "w");
+    if (!CHECK(decoder != 0))
+        return;
+    fflush(stdout);
+    int saved = dup(1);
+    dup2(fileno(decoder), 1);
+    emit();
+    fflush(stdout);
+    dup2(saved, 1);
+    close(saved);
+    CHECK_EQ(pclose(decoder), 0);
+    CHECK_EQ(telemetry_overflows(), DROPPED);
+
+    FILE *f = fopen(csv_path, "r");
+    if (!CHECK(f != 0))
+        return;
+    if (fgets(header, sizeof header, f))
+        while (n_rows < MAX_ROWS && fgets(rows[n_rows], sizeof rows[n_rows], f))
+            n_rows++;
+    fclose(f);
+    CHECK(strncmp(header, "ts_us,seq,type,", 15) == 0);
+    CHECK_EQ(n_rows, N_RECORDS + QUEUED + 1);
+
+    // every type, in order, numbered from 0
+    int r = 0;
+    for (unsigned int i = 0; i < N_RECORDS; i++, r++)
+        if (check_row(r, records[i].type, records[i].fields))
+            CHECK_EQ(atoi(value(rows[r], "seq")), r);
+
+    // the burst up to where the ring was full, then a gap of the ones it dropped
+    for (int i = 0; i < QUEUED; i++, r++)
+    {
+        char want[64];
+        snprintf(want, sizeof want, "frame=%d render_us=5000 spi_bytes=20000", 100 + i);
+        if (!check_row(r, "frame", want))
+            break;
+    }
+    if (check_row(r, "score", "score=7"))
+        CHECK_EQ(atoi(value(rows[r], "seq")) - atoi(value(rows[r - 1], "seq")), DROPPED + 1);
+
+    static char summary[4096];
+    f = fopen(summary_path, "r");
+    if (!CHECK(f != 0))
+        return;
+    summary[fread(summary, 1, sizeof summary - 1, f)] = 0;
+    fclose(f);
+    char first[128];
+    snprintf(first, sizeof first, "records          %d (lost %d, crc errors 0, skipped bytes 0)\n",
+             (int)(N_RECORDS + QUEUED + 1), DROPPED);
+    const char *lines[] = {
+        first,
+        "  lcd_link          250.0\n",
+        "frames           33 (",
+        "dropped ticks    255 (",
+        "frame period     final 16666 us (60.0 fps), 0 changes, 3 missed frames\n",
+        "power            1.0 s: 25.0% sleep, 50.0% stop, est. 1.80 mA average\n",
+        "stack            900 bytes at the deepest, 124 never touched\n",
+        "frame arena      3000 of 4096 bytes at the most, 2 allocations refused\n",
+        "button presses   1\n",
+        "score changes    2 (final 7)\n",
+        "games            1 (1 by the autopilot), best score 99\n",
+        "eeprom read      1 ops  mean 350 us  max 350 us  failed 0\n",
+        "eeprom write     1 ops  mean 4100 us  max 4100 us  failed 1\n",
+    };
+    for (unsigned int i = 0; i < sizeof lines / sizeof lines[0]; i++)
+        if (!check_that(strstr(summary, lines[i]) != 0, "summary line", __FILE__, __LINE__))
+            printf("    no \"%.*s\" in:\n%s", (int)strcspn(lines[i], "\n"), lines[i], summary);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        emit();
+        return 0;
+    }
+    test_decoded(argv[1], argv[2]);
+    return check_done("telemetry");
+}
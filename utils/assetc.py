@@ -0,0 +1,270 @@
+# Asset compiler: turns the PNG sources listed in assets/assets.json into
+# C images for the firmware (the Asset type in src/picture.h) and writes
+# src/assets.h declaring them.
+#
+# Each asset is encoded in every storage format it is allowed, and the
+# smallest wins:
+#   raw      RGB565 pixels
+#   rle      per-row (count, color) runs plus a row index
+#   tiled    distinct 8x8 or 16x16 tiles plus a tile map
+#   indexed  2/4/8 bpp palette indices (see utils/indexed.py)
+# Derived data can be requested per asset: "spans" (first/last opaque
+# column of each row) and "mask" (1 bpp collision mask).
+#
+# Manifest entries look like:
+#   "bird": {"source": "bird.png", "key": "0xffff", "formats": ["indexed"], "derive": ["spans", "mask"]}
+# key is the RGB565 color that stands for transparency in the non-indexed
+# formats; sources with transparent pixels need one to use them.
+#
+# Run from anywhere; only files whose contents change are rewritten:
+#   python utils/assetc.py            # compile and print a size report
+#   python utils/assetc.py --check    # fail if the generated files are stale
+# PlatformIO runs it before every build through utils/assetc_pio.py.
+
+import argparse
+import json
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from pngio import read_png, to_rgb565  # noqa: E402
+from indexed import index_image, pick_bpp, pack_rows  # noqa: E402
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+FORMATS = ("raw", "rle", "tiled", "indexed")
+TILE_SHIFTS = (3, 4)
+
+
+class Image:
+    def __init__(self, name, spec, assets_dir):
+        self.name = name
+        self.source = spec["source"]
+        self.width, self.height, rows = read_png(os.path.join(assets_dir, self.source))
+        self.rows = rows
+        self.key = int(spec["key"], 0) if "key" in spec else None
+        self.formats = spec.get("formats", list(FORMATS))
+        self.derive = spec.get("derive", [])
+        # None marks a transparent pixel
+        self.pixels = [[None if a < 128 else to_rgb565(r, g, b) for r, g, b, a in row] for row in rows]
+        self.transparent = any(p is None for row in self.pixels for p in row)
+
+    def keyed(self):
+        """RGB565 rows with transparency replaced by the key color."""
+        return [[self.key if p is None else p for p in row] for row in self.pixels]
+
+
+class Encoding:
+    def __init__(self, fmt, param, pixels, index, index_type, note):
+        self.fmt = fmt
+        self.param = param
+        self.pixels = pixels
+        self.index = index
+        self.index_type = index_type
+        self.note = note
+
+    def size(self):
+        n = 2 * len(self.pixels)
+        if self.index is not None:
+            n += len(self.index) * (2 if self.index_type == "unsigned short" else 1)
+        return n
+
+
+def encode_raw(img):
+    return Encoding("raw", 0, [p for row in img.keyed() for p in row], None, None, "")
+
+
+def encode_rle(img):
+    runs, offsets = [], []
+    for row in img.keyed():
+        offsets.append(len(runs) // 2)
+        x = 0
+        while x < len(row):
+            n = 1
+            while x + n < len(row) and row[x + n] == row[x] and n < 0xffff:
+                n += 1
+            runs += [n, row[x]]
+            x += n
+    offsets.append(len(runs) // 2)
+    if offsets[-1] > 0xffff:
+        return None
+    return Encoding("rle", 0, runs, offsets, "unsigned short", "%d runs" % (len(runs) // 2))
+
+
+def encode_tiled(img):
+    best = None
+    rows = img.keyed()
+    for shift in TILE_SHIFTS:
+        edge = 1 << shift
+        if img.width % edge or img.height % edge:
+            continue
+        tiles, lookup, tile_map = [], {}, []
+        for ty in range(0, img.height, edge):
+            for tx in range(0, img.width, edge):
+                tile = tuple(rows[ty + y][tx + x] for y in range(edge) for x in range(edge))
+                if tile not in lookup:
+                    lookup[tile] = len(tiles)
+                    tiles.append(tile)
+                tile_map.append(lookup[tile])
+        if len(tiles) > 256:
+            continue
+        enc = Encoding("tiled", shift, [p for t in tiles for p in t], tile_map, "unsigned char",
+                       "%dx%d tiles, %d distinct" % (edge, edge, len(tiles)))
+        if best is None or enc.size() < best.size():
+            best = enc
+    return best
+
+
+def encode_indexed(img):
+    palette, indices = index_image(img.rows, img.key)
+    if len(palette) > 256:
+        return None
+    if img.key is not None:
+        palette[0] = img.key
+    bpp = pick_bpp(len(palette))
+    note = "%d bpp, %d colors" % (bpp, len(palette) - 1)
+    palette += [0] * ((1 << bpp) - len(palette))
+    return Encoding("indexed", bpp, palette, list(pack_rows(indices, bpp)), "unsigned char", note)
+
+
+ENCODERS = {"raw": encode_raw, "rle": encode_rle, "tiled": encode_tiled, "indexed": encode_indexed}
+
+
+def candidates(img):
+    out = []
+    for fmt in img.formats:
+        if fmt not in ENCODERS:
+            raise ValueError("%s: unknown format %r" % (img.name, fmt))
+        if fmt != "indexed" and img.transparent and img.key is None:
+            continue  # no way to mark the transparent pixels
+        enc = ENCODERS[fmt](img)
+        if enc is not None:
+            out.append(enc)
+    if not out:
+        raise ValueError("%s: none of the formats %s can hold it" % (img.name, img.formats))
+    return out
+
+
+def derive_spans(img):
+    spans = []
+    for row in img.pixels:
+        solid = [x for x, p in enumerate(row) if p is not None and p != img.key]
+        spans += [solid[0], solid[-1]] if solid else [1, 0]
+    return spans
+
+
+def derive_mask(img):
+    solid = [[0 if p is None or p == img.key else 1 for p in row] for row in img.pixels]
+    return list(pack_rows(solid, 1))
+
+
+def c_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+FORMAT_MACROS = {"raw": "ASSET_RAW", "rle": "ASSET_RLE", "tiled": "ASSET_TILED", "indexed": "ASSET_INDEXED"}
+
+
+def emit_source(img, enc, spans, mask):
+    n = img.name
+    out = ["// Generated by utils/assetc.py from assets/%s. Do not edit.\n" % img.source,
+           '#include "assets.h"\n\n']
+    out.append("static const unsigned short %s_pixels[%d] = {\n%s\n};\n\n"
+               % (n, len(enc.pixels), c_array(enc.pixels, "0x%04x", 12)))
+    index_ref = "0"
+    if enc.index is not None:
+        fmt = "%d" if enc.index_type == "unsigned short" else "0x%02x"
+        out.append("static const %s %s_index[%d] = {\n%s\n};\n\n"
+                   % (enc.index_type, n, len(enc.index), c_array(enc.index, fmt, 12)))
+        index_ref = "%s_index" % n
+    spans_ref = mask_ref = "0"
+    if spans is not None:
+        out.append("static const unsigned short %s_spans[%d] = {\n%s\n};\n\n"
+                   % (n, len(spans), c_array(spans, "%d", 16)))
+        spans_ref = "%s_spans" % n
+    if mask is not None:
+        out.append("static const unsigned char %s_mask[%d] = {\n%s\n};\n\n"
+                   % (n, len(mask), c_array(mask, "0x%02x", 12)))
+        mask_ref = "%s_mask" % n
+    key = -1 if img.key is None else img.key
+    out.append("const Asset %s = {%d, %d, %s, %d, %s, %s_pixels, %s, %s, %s};\n"
+               % (n, img.width, img.height, FORMAT_MACROS[enc.fmt], enc.param,
+                  "-1" if key < 0 else "0x%04x" % key, n, index_ref, spans_ref, mask_ref))
+    return "".join(out)
+
+
+def emit_header(entries):
+    out = ["// Generated by utils/assetc.py from assets/assets.json. Do not edit.\n",
+           "#ifndef ASSETS_H\n#define ASSETS_H\n\n",
+           '#include "picture.h"\n']
+    for img, enc, total in entries:
+        u = img.name.upper()
+        out.append("\n/* %s: %dx%d %s%s, %d bytes (raw %d) */\n"
+                   % (img.name, img.width, img.height, enc.fmt,
+                      " (%s)" % enc.note if enc.note else "", total, img.width * img.height * 2))
+        out.append("#define ASSET_%s_WIDTH %d\n" % (u, img.width))
+        out.append("#define ASSET_%s_HEIGHT %d\n" % (u, img.height))
+        out.append("#define ASSET_%s_FORMAT %s\n" % (u, FORMAT_MACROS[enc.fmt]))
+        out.append("#define ASSET_%s_BYTES %d\n" % (u, total))
+        out.append("extern const Asset %s;\n" % img.name)
+    out.append("\n#endif /* ASSETS_H */\n")
+    return "".join(out)
+
+
+def write_if_changed(path, text, check, stale):
+    old = None
+    if os.path.exists(path):
+        with open(path) as f:
+            old = f.read()
+    if old == text:
+        return
+    stale.append(path)
+    if not check:
+        with open(path, "w") as f:
+            f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile assets/ into C images")
+    parser.add_argument("--assets", default=os.path.join(ROOT, "assets"), help="asset directory")
+    parser.add_argument("--out", default=os.path.join(ROOT, "src"), help="where the .c files and assets.h go")
+    parser.add_argument("--check", action="store_true", help="only check that the outputs are up to date")
+    parser.add_argument("--quiet", action="store_true", help="no size report")
+    args = parser.parse_args()
+
+    with open(os.path.join(args.assets, "assets.json")) as f:
+        manifest = json.load(f)
+
+    entries, stale, report = [], [], []
+    for name in sorted(manifest):
+        img = Image(name, manifest[name], args.assets)
+        encs = candidates(img)
+        best = min(encs, key=lambda e: e.size())
+        spans = derive_spans(img) if "spans" in img.derive else None
+        mask = derive_mask(img) if "mask" in img.derive else None
+        total = best.size() + 2 * len(spans or []) + len(mask or [])
+        entries.append((img, best, total))
+        write_if_changed(os.path.join(args.out, name + ".c"), emit_source(img, best, spans, mask), args.check, stale)
+        report.append((img, best, total, encs))
+    write_if_changed(os.path.join(args.out, "assets.h"), emit_header(entries), args.check, stale)
+
+    if not args.quiet:
+        print("%-12s %-9s %-8s %8s %8s %7s  candidates" % ("asset", "size", "format", "bytes", "raw", "ratio"))
+        grand, grand_raw = 0, 0
+        for img, best, total, encs in report:
+            raw = img.width * img.height * 2
+            grand += total
+            grand_raw += raw
+            others = " ".join("%s=%d" % (e.fmt, e.size()) for e in encs)
+            print("%-12s %-9s %-8s %8d %8d %6.1fx  %s"
+                  % (img.name, "%dx%d" % (img.width, img.height), best.fmt, total, raw, raw / total, others))
+        print("%-12s %-9s %-8s %8d %8d %6.1fx" % ("total", "", "", grand, grand_raw, grand_raw / grand))
+
+    if args.check and stale:
+        sys.exit("stale generated files: " + ", ".join(os.path.relpath(p, ROOT) for p in stale))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,9 @@
+# PlatformIO pre-build hook (extra_scripts = pre:utils/assetc_pio.py):
+# recompile assets/ into src/ before every build. Generated files are only
+# rewritten when they change, so an untouched asset does not cause a rebuild.
+
+import subprocess
+
+Import("env")  # noqa: F821 (provided by PlatformIO)
+
+subprocess.check_call([env.subst("$PYTHONEXE"), env.subst("$PROJECT_DIR/utils/assetc.py")])  # noqa: F821
@@ -0,0 +1,160 @@
+# Builds bench/bench.c against the firmware sources at several optimisation
+# levels, runs each build, and compares the results with a baseline. This
+# is the yardstick for rendering changes in src/: run it before and after.
+#   python utils/bench.py                                # -O0 -Os -O2, print a table
+#   python utils/bench.py --json results.json            # also keep the numbers
+#   python utils/bench.py --save-baseline bench/baseline.json
+#   python utils/bench.py --baseline bench/baseline.json --threshold 10
+#   python utils/bench.py --opt O2 --case pic_overlay    # just one
+#   python utils/bench.py --soak 1000000                 # autopilot games, headless
+#
+# Times are the fastest of several batches, in nanoseconds per operation
+# on this machine, so a baseline is only worth comparing with on the
+# machine (and compiler) that saved it. spi_bytes, what an operation sends
+# to the display, is exact and the same everywhere: any increase counts as
+# a regression. With --baseline the exit status is 1 if anything regressed.
+#
+# --soak runs that many physics steps of games played by the autopilot
+# (src/autopilot.h), from a fixed seed, and prints the games, scores and
+# the mean and worst time per step (at -O2 unless --opt says otherwise).
+#
+# -O0 is what platformio.ini builds the firmware with. Needs a C compiler
+# (cc, or --cc) and nothing beyond Python's standard library.
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCES = ["bench/bench.c"] + ["src/%s.c" % name for name in (
+    "lcd", "picture", "obstacle", "physics", "snapshot", "background", "barrier", "bird", "m2m", "spibus",
+    "pins", "clock", "sched", "arena", "autopilot", "game")]
+FLAGS = ["-std=gnu11", "-Wall", "-DLCD_HOST", "-DM2M_HOST", "-DSPIBUS_HOST", "-DCLOCK_HOST", "-DSCHED_HOST",
+         "-Ibench", "-Isrc"]
+LIBS = ["-lpthread"]
+
+
+def build(cc, opt, out):
+    cmd = [cc, opt, '-DBENCH_OPT="%s"' % opt] + FLAGS + SOURCES + LIBS + ["-o", out]
+    result = subprocess.run(cmd, cwd=ROOT, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    if result.returncode:
+        sys.exit("build at %s failed:\n%s" % (opt, result.stdout))
+    if result.stdout:
+        sys.stderr.write("build at %s warned:\n%s" % (opt, result.stdout))
+
+
+def run(exe, cases):
+    out = subprocess.run([exe] + cases, cwd=ROOT, stdout=subprocess.PIPE, check=True, universal_newlines=True)
+    return json.loads(out.stdout)
+
+
+def soak(exe, steps):
+    out = subprocess.run([exe, "--soak", str(steps)], cwd=ROOT, stdout=subprocess.PIPE, check=True,
+                         universal_newlines=True)
+    return json.loads(out.stdout)
+
+
+def regressions(results, baseline, threshold):
+    """Lines describing each case that got slower by more than threshold percent, or sends more bytes."""
+    worse = []
+    for opt, run_ in sorted(results.items()):
+        old_run = baseline.get(opt)
+        if not old_run:
+            continue
+        for name, new in sorted(run_["cases"].items()):
+            old = old_run["cases"].get(name)
+            if not old:
+                continue
+            if new["ns"] > old["ns"] * (1 + threshold / 100.0):
+                worse.append("%-4s %-26s %10.1f -> %10.1f ns  (+%.0f%%)"
+                             % (opt, name, old["ns"], new["ns"], 100.0 * (new["ns"] / old["ns"] - 1)))
+            if new["spi_bytes"] > old["spi_bytes"]:
+                worse.append("%-4s %-26s %10.1f -> %10.1f spi bytes" % (opt, name, old["spi_bytes"], new["spi_bytes"]))
+    return worse
+
+
+def table(results, baseline):
+    opts = sorted(results)
+    names = []
+    for opt in opts:
+        names += [n for n in results[opt]["cases"] if n not in names]
+    lines = ["%-26s %10s" % ("ns per operation", "spi bytes") + "".join("%12s" % opt for opt in opts)]
+    for name in names:
+        row = "%-26s" % name
+        bytes_ = [results[opt]["cases"][name]["spi_bytes"] for opt in opts if name in results[opt]["cases"]]
+        row += "%11.0f" % bytes_[0]
+        for opt in opts:
+            case = results[opt]["cases"].get(name)
+            cell = "%.0f" % case["ns"] if case else "-"
+            old = (baseline or {}).get(opt, {}).get("cases", {}).get(name)
+            if case and old:
+                cell += " %+.0f%%" % (100.0 * (case["ns"] / old["ns"] - 1))
+            row += "%12s" % cell
+        lines.append(row)
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark the drawing and game step hot paths on the host")
+    parser.add_argument("--cc", default=os.environ.get("CC", "cc"), help="C compiler")
+    parser.add_argument("--opt", action="append", help="optimisation level such as O2, may repeat (default O0 Os O2)")
+    parser.add_argument("--case", action="append", default=[], help="only this case, may repeat")
+    parser.add_argument("--json", help="write the results to this file")
+    parser.add_argument("--baseline", help="compare with the results in this file")
+    parser.add_argument("--threshold", type=float, default=10.0, help="percent slower that counts as a regression")
+    parser.add_argument("--save-baseline", help="write the results to this file as the new baseline")
+    parser.add_argument("--soak", type=int, metavar="STEPS", help="play autopilot games for this many steps instead")
+    args = parser.parse_args()
+
+    if args.soak:
+        results = {}
+        with tempfile.TemporaryDirectory() as tmp:
+            for opt in ["-" + o.lstrip("-") for o in args.opt or ["O2"]]:
+                exe = os.path.join(tmp, "bench" + opt)
+                build(args.cc, opt, exe)
+                results[opt] = soak(exe, args.soak)
+                r = results[opt]["soak"]
+                print("%-4s %d steps: %d crashes, best score %d, mean %.1f, %.0f ns per step, worst %.0f ns"
+                      % (opt, r["steps"], r["crashes"], r["best_score"], r["mean_score"], r["ns_per_step"],
+                         r["worst_step_ns"]))
+        if args.json:
+            with open(args.json, "w") as f:
+                json.dump(results, f, indent=2, sort_keys=True)
+                f.write("\n")
+        return
+
+    results = {}
+    with tempfile.TemporaryDirectory() as tmp:
+        for opt in ["-" + o.lstrip("-") for o in args.opt or ["O0", "Os", "O2"]]:
+            exe = os.path.join(tmp, "bench" + opt)
+            build(args.cc, opt, exe)
+            results[opt] = run(exe, args.case)
+
+    baseline = None
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+    print(table(results, baseline))
+
+    for path in (args.json, args.save_baseline):
+        if path:
+            with open(path, "w") as f:
+                json.dump(results, f, indent=2, sort_keys=True)
+                f.write("\n")
+
+    if baseline is not None:
+        worse = regressions(results, baseline, args.threshold)
+        if worse:
+            print("\nregressions against %s (threshold %.0f%%):" % (args.baseline, args.threshold))
+            for line in worse:
+                print("  " + line)
+            sys.exit(1)
+        print("\nno regressions against %s (threshold %.0f%%)" % (args.baseline, args.threshold))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,149 @@
+# Fixtures for the host tests in utils/hosttest.py: inputs a test needs
+# made by the repo's own generators before it is built. Each fixture takes
+# a scratch directory and returns (sources, flags, args): C files to build
+# into the test, compiler flags, and the test program's arguments.
+
+import json
+import os
+import random
+import subprocess
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from pngio import read_png, write_png, from_rgb565, to_rgb565  # noqa: E402
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+CLEAR = (0, 0, 0, 0)
+
+
+def _opaque(c):
+    return from_rgb565(c) + (255,)
+
+
+def _round_trip_images(rng):
+    """Sprites that force each of assetc.py's formats, with and without transparency."""
+    def image(width, height, pick):
+        return [[pick(x, y) for x in range(width)] for y in range(height)]
+
+    noise = [rng.randrange(0x10000) for _ in range(8)]
+    few = [rng.randrange(1, 0xfffe) for _ in range(3)]
+    nine = [rng.randrange(1, 0xfffe) for _ in range(9)]
+    many = [rng.randrange(1, 0xfffe) for _ in range(100)]
+    tile = [[rng.choice(noise) for _ in range(64)] for _ in range(3)]
+
+    def stripes(x, y):
+        if y == 3 or (y == 5 and x > 30):
+            return CLEAR  # an empty row, and a row that ends early
+        return _opaque(0xffff) if x % 13 < 2 else _opaque(noise[(x // 7 + y) % 8])
+
+    def tiles(x, y):
+        return _opaque(tile[(x // 8 + 2 * (y // 8)) % 3][(y % 8) * 8 + x % 8])
+
+    def sparse(x, y):
+        return CLEAR if (x + y) % 4 == 0 else _opaque(few[(x * y) % 3])
+
+    return {
+        # name: (spec, rows)
+        "rt_raw": ({"formats": ["raw"]}, image(19, 7, lambda x, y: _opaque(rng.randrange(0x10000)))),
+        "rt_rle": ({"formats": ["rle"], "key": "0xffff", "derive": ["spans", "mask"]}, image(40, 9, stripes)),
+        "rt_tiled": ({"formats": ["tiled"]}, image(32, 16, tiles)),
+        "rt_keyed_tiles": ({"formats": ["tiled"], "key": "0xffff", "derive": ["spans"]},
+                           image(16, 16, lambda x, y: CLEAR if x < y // 2 else tiles(x, y))),
+        "rt_indexed2": ({"formats": ["indexed"]}, image(13, 5, sparse)),
+        "rt_indexed4": ({"formats": ["indexed"], "key": "0xffff", "derive": ["mask"]},
+                        image(9, 9, lambda x, y: _opaque(0xffff) if x == y else _opaque(nine[(x + 2 * y) % 9]))),
+        "rt_indexed8": ({"formats": ["indexed"]},
+                        image(11, 12, lambda x, y: CLEAR if y == 0 else _opaque(many[(x + 11 * y) % 100]))),
+        "rt_best": ({"key": "0xffff", "derive": ["spans", "mask"]}, image(24, 8, stripes)),
+    }
+
+
+def _expected(name, rows, key, fmt):
+    """C declarations of what an asset decodes to, and its RoundTrip entry."""
+    flat = [px for row in rows for px in row]
+    clear = 0 if key is None else key  # palette[0], or the key color
+    pixels = [to_rgb565(r, g, b) if a >= 128 else clear for r, g, b, a in flat]
+    solid = [int(a >= 128 and to_rgb565(r, g, b) != key) for r, g, b, a in flat]
+    out = ["static const unsigned short %s_want[%d] = {%s};\n" % (name, len(pixels), ",".join(map(str, pixels))),
+           "static const unsigned char %s_solid[%d] = {%s};\n" % (name, len(solid), ",".join(map(str, solid))),
+           "extern const Asset %s;\n" % name]
+    entry = '    {"%s", &%s, %s_want, %s_solid, %s},\n' % (name, name, name, name, fmt)
+    return "".join(out), entry
+
+
+def assets(tmp):
+    """Compile sprites in every format with utils/assetc.py, and the pixels each should decode to.
+
+    The generated asset_round_trip.h lists them, and the real assets in assets/ against the
+    committed src/*.c, as RoundTrip entries (see test/test_assetc.c).
+    """
+    src_dir = os.path.join(tmp, "assets")
+    out_dir = os.path.join(tmp, "generated")
+    os.makedirs(src_dir, exist_ok=True)
+    os.makedirs(out_dir, exist_ok=True)
+
+    manifest, decls, entries = {}, [], []
+    for name, (spec, rows) in sorted(_round_trip_images(random.Random(32)).items()):
+        write_png(os.path.join(src_dir, name + ".png"), len(rows[0]), len(rows), rows)
+        manifest[name] = dict(spec, source=name + ".png")
+        key = int(spec["key"], 0) if "key" in spec else None
+        fmt = "ASSET_" + spec["formats"][0].upper() if "formats" in spec else "-1"
+        d, e = _expected(name, rows, key, fmt)
+        decls.append(d)
+        entries.append(e)
+    with open(os.path.join(src_dir, "assets.json"), "w") as f:
+        json.dump(manifest, f)
+    subprocess.run([sys.executable, os.path.join(ROOT, "utils", "assetc.py"), "--assets", src_dir, "--out", out_dir,
+                    "--quiet"], check=True)
+
+    # the committed firmware assets, decoded from src/ against their PNGs
+    with open(os.path.join(ROOT, "assets", "assets.json")) as f:
+        shipped = json.load(f)
+    for name, spec in sorted(shipped.items()):
+        width, height, rows = read_png(os.path.join(ROOT, "assets", spec["source"]))
+        key = int(spec["key"], 0) if "key" in spec else None
+        d, e = _expected(name, rows, key, "-1")
+        decls.append(d)
+        entries.append(e)
+
+    with open(os.path.join(out_dir, "asset_round_trip.h"), "w") as f:
+        f.write("// Generated by utils/hostfixtures.py. Do not edit.\n")
+        f.write('#include "picture.h"\n\n')
+        f.write("".join(decls))
+        f.write("\nstatic const RoundTrip round_trips[] = {\n%s};\n" % "".join(entries))
+
+    sources = [os.path.join(out_dir, name + ".c") for name in sorted(manifest)]
+    return sources, ["-I" + out_dir], []
+
+
+# name: utils/sdimage.py arguments; a name with "frag" in it has its files' clusters out of order
+SD_IMAGES = {
+    "fat16": [],
+    "fat16_part": ["--partition"],
+    "fat16_dir": ["--dir", "LEVEL1"],
+    "fat16_frag": ["--fragment", "3"],
+    "fat32": ["--fat32"],
+    "fat32_part_dir": ["--fat32", "--partition", "--dir", "LEVEL1"],
+    "fat32_frag": ["--fat32", "--partition", "--fragment", "5"],
+}
+
+
+def sd_images(tmp):
+    """Card images of the assets made by utils/sdimage.py, FAT16 and FAT32, whole card and partitioned, files
+    in the root or a directory, in one run of clusters or fragmented.
+
+    The test gets each image's path as an argument (see test/test_store.c).
+    """
+    paths = []
+    for name, options in sorted(SD_IMAGES.items()):
+        path = os.path.join(tmp, name + ".img")
+        subprocess.run([sys.executable, os.path.join(ROOT, "utils", "sdimage.py"), path] + options, check=True,
+                       stdout=subprocess.DEVNULL)
+        paths.append(path)
+    return [], [], paths
+
+
+def telemetry(tmp):
+    """The Python that runs utils/telemetry.py on the test's records, and where it writes."""
+    return [], [], [sys.executable, tmp]
@@ -0,0 +1,125 @@
+# Builds and runs the host tests in test/. Each test is one program, built
+# from its test/test_*.c, any fakes it needs and the firmware sources it
+# covers, with the host flags that take the registers out of them. A test
+# prints its failed checks and a tally, and exits non-zero if any failed.
+#   python utils/hosttest.py                  # every test
+#   python utils/hosttest.py arena sched      # just these
+#   python utils/hosttest.py --sanitize       # with ASan and UBSan
+#   python utils/hosttest.py --list
+#
+# The exit status is 1 if any test failed to build or failed a check.
+# Needs a C compiler (cc, or --cc) and nothing beyond Python's standard
+# library.
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import hostfixtures  # noqa: E402
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+FLAGS = ["-std=gnu11", "-O1", "-g", "-Wall", "-Wextra", "-Wno-unused-parameter", "-Wno-sign-compare",
+         "-Itest", "-Isrc"]
+LIBS = ["-lpthread"]
+SANITIZE = ["-fsanitize=address,undefined", "-fno-omit-frame-pointer", "-fno-sanitize-recover=undefined"]
+
+
+def src(*names):
+    return ["src/%s.c" % name for name in names]
+
+
+# The display and what draws on it, on the fake controller in test/fake_lcd.c, as the benchmarks build them
+LCD = ["test/fake_lcd.c"] + src("lcd", "picture", "obstacle", "physics", "snapshot", "background", "barrier", "bird",
+                                "m2m", "spibus", "pins", "clock", "sched", "arena")
+LCD_FLAGS = ["-DLCD_HOST", "-DM2M_HOST", "-DSPIBUS_HOST", "-DCLOCK_HOST", "-DSCHED_HOST", "-Ibench"]
+
+# name: (sources, extra flags[, fixture]); a fixture (utils/hostfixtures.py) makes more inputs first
+TESTS = {
+    "arena": (["test/test_arena.c"] + src("arena"), []),
+    "clock": (["test/test_clock.c"] + src("clock"), ["-DCLOCK_HOST"]),
+    "governor": (["test/test_governor.c"] + src("governor"), []),
+    "power": (["test/test_power.c"] + src("power", "clock"), ["-DPOWER_HOST", "-DCLOCK_HOST", "-DTELEMETRY_ENABLE=0"]),
+    "lcd_init": (["test/test_lcd_init.c"] + LCD, LCD_FLAGS),
+    "lcd_shapes": (["test/test_lcd_shapes.c"] + LCD, LCD_FLAGS),
+    "lcd_window": (["test/test_lcd_window.c"] + LCD + src("game"), LCD_FLAGS),
+    "lcd_link": (["test/test_lcd_link.c"] + LCD, LCD_FLAGS),
+    "lcd_text": (["test/test_lcd_text.c"] + LCD, LCD_FLAGS),
+    "m2m": (["test/test_m2m.c"] + LCD, LCD_FLAGS),
+    "physics": (["test/test_physics.c"] + LCD + src("game"), LCD_FLAGS),
+    "sched": (["test/test_sched.c"] + src("sched"), ["-DSCHED_HOST"]),
+    "snapshot": (["test/test_snapshot.c"] + src("snapshot"), []),
+    "spibus": (["test/test_spibus.c"] + src("spibus", "pins", "clock", "sched"),
+               ["-DSPIBUS_HOST", "-DCLOCK_HOST", "-DSCHED_HOST"]),
+    "telemetry": (["test/test_telemetry.c"] + src("telemetry"), ["-DTELEMETRY_HOST"], hostfixtures.telemetry),
+    "assetc": (["test/test_assetc.c"] + LCD, LCD_FLAGS, hostfixtures.assets),
+    "store": (["test/test_store.c"] + LCD + src("sdcard", "store"), LCD_FLAGS + ["-DSD_HOST"],
+              hostfixtures.sd_images),
+}
+
+
+def build(cc, sources, flags, out, sanitize):
+    cmd = [cc] + FLAGS + flags + (SANITIZE if sanitize else []) + sources + LIBS + ["-o", out]
+    return subprocess.run(cmd, cwd=ROOT, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+
+
+def run(exe, args):
+    return subprocess.run([exe] + args, cwd=ROOT, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                          universal_newlines=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build and run the host tests")
+    parser.add_argument("tests", nargs="*", help="tests to run (default: all)")
+    parser.add_argument("--cc", default=os.environ.get("CC", "cc"), help="C compiler")
+    parser.add_argument("--sanitize", action="store_true", help="build with ASan and UBSan")
+    parser.add_argument("--list", action="store_true", help="list the tests and stop")
+    parser.add_argument("--verbose", "-v", action="store_true", help="print each test's output even if it passed")
+    args = parser.parse_args()
+
+    if args.list:
+        for name in TESTS:
+            print(name)
+        return
+    unknown = [t for t in args.tests if t not in TESTS]
+    if unknown:
+        parser.error("no such test: %s" % ", ".join(unknown))
+
+    failed = []
+    with tempfile.TemporaryDirectory() as tmp:
+        for name in args.tests or list(TESTS):
+            exe = os.path.join(tmp, "test_" + name)
+            sources, flags, fixture = (TESTS[name] + (None,))[:3]
+            run_args = []
+            if fixture:
+                scratch = os.path.join(tmp, name)
+                os.makedirs(scratch)
+                more, more_flags, run_args = fixture(scratch)
+                sources, flags = sources + more, flags + more_flags
+            result = build(args.cc, sources, flags, exe, args.sanitize)
+            if result.returncode:
+                print("%-10s build failed\n%s" % (name, result.stdout))
+                failed.append(name)
+                continue
+            if result.stdout:
+                print("%-10s build warnings\n%s" % (name, result.stdout))
+            result = run(exe, run_args)
+            lines = result.stdout.rstrip().splitlines()
+            print("%-10s %s" % (name, "ok" if result.returncode == 0 else "FAILED"))
+            if result.returncode or args.verbose:
+                for line in lines:
+                    print("    " + line)
+            if result.returncode < 0:
+                print("    killed by signal %d" % -result.returncode)
+            if result.returncode:
+                failed.append(name)
+
+    if failed:
+        sys.exit("\n%d of %d failed: %s" % (len(failed), len(args.tests or TESTS), " ".join(failed)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,125 @@
+# Converts a PNG sprite into a palette-indexed IndexedPicture (see
+# src/picture.h) for the firmware. Fully transparent pixels, and any pixel
+# of the --key color, become index 0. The smallest of 2, 4 or 8 bits per
+# pixel that holds the sprite's colors is used unless --bpp is given.
+#
+# Example (run from utils/):
+#   python indexed.py ../assets/bird.png --name bird -o ../src/bird.c
+
+import argparse
+import collections
+import os
+import sys
+
+from pngio import read_png, to_rgb565
+
+BPP_CHOICES = (2, 4, 8)
+
+
+def index_image(rows, key=None):
+    """Return (palette, indices): palette[0] is the transparent slot, indices[y][x] index it."""
+    pixels = []
+    for row in rows:
+        out = []
+        for r, g, b, a in row:
+            c = to_rgb565(r, g, b)
+            out.append(None if a < 128 or c == key else c)
+        pixels.append(out)
+
+    counts = collections.Counter(c for row in pixels for c in row if c is not None)
+    # most used colors first, so that the layout is stable for a given image
+    colors = sorted(counts, key=lambda c: (-counts[c], c))
+    palette = [0x0000] + colors
+    lookup = {c: i + 1 for i, c in enumerate(colors)}
+    indices = [[0 if c is None else lookup[c] for c in row] for row in pixels]
+    return palette, indices
+
+
+def pick_bpp(ncolors):
+    for bpp in BPP_CHOICES:
+        if ncolors <= 1 << bpp:
+            return bpp
+    raise ValueError("%d colors do not fit in 8 bits per pixel" % (ncolors - 1))
+
+
+def pack_rows(indices, bpp):
+    """Pack each row most significant bits first, padded to a whole byte."""
+    data = bytearray()
+    per_byte = 8 // bpp
+    for row in indices:
+        for i in range(0, len(row), per_byte):
+            byte = 0
+            for j in range(per_byte):
+                v = row[i + j] if i + j < len(row) else 0
+                byte |= v << (8 - bpp * (j + 1))
+            data.append(byte)
+    return bytes(data)
+
+
+def unpack_rows(data, width, height, bpp):
+    stride = (width * bpp + 7) // 8
+    rows = []
+    for y in range(height):
+        row = []
+        for x in range(width):
+            bit = x * bpp
+            byte = data[y * stride + bit // 8]
+            row.append((byte >> (8 - bpp - bit % 8)) & ((1 << bpp) - 1))
+        rows.append(row)
+    return rows
+
+
+def c_array(data, fmt, per_line):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def emit_c(name, width, height, bpp, palette, data, source):
+    palette = palette + [0x0000] * ((1 << bpp) - len(palette))
+    out = []
+    out.append("// Generated by utils/indexed.py from %s. Do not edit.\n" % source)
+    out.append('#include "picture.h"\n\n')
+    out.append("static const unsigned short %s_palette[%d] = {\n%s\n};\n\n"
+               % (name, len(palette), c_array(palette, "0x%04x", 8)))
+    out.append("static const unsigned char %s_index[%d] = {\n%s\n};\n\n"
+               % (name, len(data), c_array(data, "0x%02x", 12)))
+    out.append("const IndexedPicture %s = {%d, %d, %d, %s_palette, %s_index};\n"
+               % (name, width, height, bpp, name, name))
+    return "".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a PNG sprite to a palette-indexed C image")
+    parser.add_argument("png", help="source image")
+    parser.add_argument("--name", help="C symbol name (default: the file name)")
+    parser.add_argument("--bpp", type=int, choices=BPP_CHOICES, help="bits per pixel (default: smallest that fits)")
+    parser.add_argument("--key", type=lambda s: int(s, 0), help="RGB565 color to treat as transparent")
+    parser.add_argument("-o", "--output", help="output .c file (default stdout)")
+    args = parser.parse_args()
+
+    name = args.name or os.path.splitext(os.path.basename(args.png))[0]
+    width, height, rows = read_png(args.png)
+    palette, indices = index_image(rows, args.key)
+    bpp = args.bpp or pick_bpp(len(palette))
+    if len(palette) > 1 << bpp:
+        sys.exit("%s has %d colors, too many for %d bits per pixel" % (args.png, len(palette) - 1, bpp))
+    data = pack_rows(indices, bpp)
+    if unpack_rows(data, width, height, bpp) != indices:
+        sys.exit("internal error: packed rows do not round-trip")
+
+    text = emit_c(name, width, height, bpp, palette, data, os.path.basename(args.png))
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    raw = width * height * 2
+    packed = len(data) + 2 * (1 << bpp)
+    sys.stderr.write("%s: %dx%d, %d colors, %d bpp: %d bytes (raw RGB565 %d, %.1fx smaller)\n"
+                     % (name, width, height, len(palette) - 1, bpp, packed, raw, raw / packed))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,18 @@
+# PlatformIO post-build hook (extra_scripts = post:utils/memory_pio.py):
+# after every link, print where flash, SRAM and the stack go and fail the
+# build if any of them is over memory_budget.json (see memory_report.py).
+
+import os
+import subprocess
+
+Import("env")  # noqa: F821 (provided by PlatformIO)
+
+
+def memory_report(target, source, env):
+    objdump = env.subst("$OBJCOPY").replace("objcopy", "objdump")
+    return subprocess.call([env.subst("$PYTHONEXE"), env.subst("$PROJECT_DIR/utils/memory_report.py"),
+                            str(target[0]), "--objdump", objdump],
+                           env=dict(os.environ, PATH=env["ENV"]["PATH"]))
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", memory_report)  # noqa: F821
@@ -0,0 +1,363 @@
+# Reports where the firmware's flash and SRAM go and how deep its stack can
+# get, and checks them against memory_budget.json. PlatformIO runs it after
+# every link (extra_scripts = post:utils/memory_pio.py) and fails the build
+# if the firmware is over budget. On its own:
+#   python utils/memory_report.py                      # the nucleo_f091rc build
+#   python utils/memory_report.py path/to/firmware.elf --top 30
+#   python utils/memory_report.py --set-budget 10      # budgets from this build
+#
+# The budgets start as round figures that have not been checked against a
+# target build; until memory_budget.json has a "measured" entry the report
+# says so. --set-budget sets flash, SRAM, .ramfunc and (with objdump) the
+# worst-case stack to this build's figures plus the given headroom in
+# percent, and records the figures under "measured".
+#
+# Sizes come from the ELF's symbol table: flash is code, constants and the
+# initial values of .data and .ramfunc, SRAM is everything linked there
+# apart from the heap and stack reserve. Frame sizes come from the .su
+# files -fstack-usage leaves next to the objects, or for library code from
+# the push and sub sp at the start of the function.
+#
+# The worst-case stack is found by following the calls in the disassembly
+# (arm-none-eabi-objdump, or --objdump) from Reset_Handler and each
+# interrupt handler. Calls through function pointers are followed to the
+# functions memory_budget.json lists under "indirect" for the caller, or
+# under "*" for any other caller; the rest are reported. A handler can only
+# be preempted by a more urgent one, so the estimate is main's deepest path
+# plus, for each priority level in "priorities", the deepest handler at it
+# and its exception frame. Recursion is cut off and reported.
+
+import argparse
+import json
+import os
+import re
+import shutil
+import struct
+import subprocess
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ELF = os.path.join(ROOT, ".pio", "build", "nucleo_f091rc", "firmware.elf")
+BUDGET = os.path.join(ROOT, "memory_budget.json")
+
+FLASH_BASE, RAM_BASE = 0x08000000, 0x20000000
+EXCEPTION_FRAME = 36  # r0-r3, r12, lr, pc, xPSR, and a word of 8-byte alignment
+
+SHT_NOBITS = 8
+SHF_ALLOC = 2
+SHN_ABS = 0xfff1
+RESERVE = "._user_heap_stack"  # stm32f091rc.ld's heap and stack minimums
+
+
+def read_elf(path):
+    """The sections (name, type, flags, address, size) and symbols (name, value, size, type, section) of a 32-bit ELF."""
+    with open(path, "rb") as f:
+        elf = f.read()
+    if elf[:4] != b"\x7fELF" or elf[4] != 1 or elf[5] != 1:
+        sys.exit("%s is not a 32-bit little-endian ELF" % path)
+    shoff, = struct.unpack_from("<I", elf, 32)
+    shentsize, shnum, shstrndx = struct.unpack_from("<HHH", elf, 46)
+    headers = [struct.unpack_from("<IIIIIIIIII", elf, shoff + i * shentsize) for i in range(shnum)]
+
+    def string(table, offset):
+        start = headers[table][4] + offset
+        return elf[start:elf.index(b"\0", start)].decode()
+
+    sections = [(string(shstrndx, h[0]), h[1], h[2], h[3], h[5]) for h in headers]
+    symbols = []
+    for h in headers:
+        if h[1] != 2:  # SHT_SYMTAB
+            continue
+        for off in range(h[4], h[4] + h[5], 16):
+            name, value, size, info, _, shndx = struct.unpack_from("<IIIBBH", elf, off)
+            if name:
+                symbols.append((string(h[6], name), value, size, info & 0xf, shndx))
+    return sections, symbols
+
+
+def in_ram(addr):
+    return RAM_BASE <= addr < RAM_BASE + 0x10000000
+
+
+def memory(sections, symbols):
+    """Flash and static SRAM totals, and each symbol's share of them."""
+    flash = ram = 0
+    for name, stype, flags, addr, size in sections:
+        if not flags & SHF_ALLOC or name == RESERVE:
+            continue
+        if in_ram(addr):
+            ram += size
+            if stype != SHT_NOBITS:
+                flash += size  # initial values, copied at startup
+        elif addr >= FLASH_BASE:
+            flash += size
+    in_flash, in_sram = [], []
+    for name, value, size, stype, shndx in symbols:
+        if stype not in (1, 2) or not size or shndx >= len(sections):  # STT_OBJECT, STT_FUNC
+            continue
+        section = sections[shndx]
+        if in_ram(section[3]):
+            in_sram.append((size, name, section[0]))
+            if section[1] != SHT_NOBITS:
+                in_flash.append((size, name, section[0]))
+        elif section[3] >= FLASH_BASE:
+            in_flash.append((size, name, section[0]))
+    return flash, ram, sorted(in_flash, reverse=True), sorted(in_sram, reverse=True)
+
+
+def stack_usage(build_dir):
+    """Function -> (bytes, qualifiers) from every .su file under build_dir."""
+    frames = {}
+    for top, _, files in os.walk(build_dir):
+        for name in files:
+            if not name.endswith(".su"):
+                continue
+            with open(os.path.join(top, name)) as f:
+                for line in f:
+                    parts = line.rstrip("\n").split("\t")
+                    if len(parts) == 3:
+                        func = parts[0].rsplit(":", 1)[-1]
+                        size = int(parts[1])
+                        if size >= frames.get(func, (0, ""))[0]:
+                            frames[func] = (size, parts[2])
+    return frames
+
+
+INSN = re.compile(r"^\s+[0-9a-f]+:\s+(\S+)\s*(.*)$")
+LABEL = re.compile(r"^([0-9a-f]+) <([^>]+)>:$")
+TARGET = re.compile(r"<([^>+]+)(\+0x[0-9a-f]+)?>")
+VENEER = re.compile(r"^__(.+)_veneer$")
+
+
+def registers(reglist):
+    n = 0
+    for part in reglist.split(","):
+        part = part.strip()
+        if "-" in part:
+            lo, hi = part.split("-")
+            n += int(hi.strip()[1:]) - int(lo.strip()[1:]) + 1
+        elif part:
+            n += 1
+    return n
+
+
+def call_graph(objdump, elf):
+    """Function -> (direct callees, has indirect calls, frame from its prologue) from the disassembly."""
+    out = subprocess.run([objdump, "-d", "--no-show-raw-insn", elf], stdout=subprocess.PIPE,
+                         universal_newlines=True, check=True).stdout
+    graph = {}
+    func = None
+    for line in out.split("\n"):
+        m = LABEL.match(line)
+        if m:
+            func = m.group(2)
+            if func.startswith("$"):
+                func = None
+                continue
+            graph[func] = [set(), False, 0, 0]  # callees, indirect, frame, instructions seen
+            continue
+        m = INSN.match(line)
+        if not m or func is None:
+            continue
+        op, args = m.group(1), m.group(2)
+        node = graph[func]
+        node[3] += 1
+        if op.startswith("push") and node[3] <= 4:
+            node[2] += 4 * registers(args.strip("{} "))
+        elif op.startswith("sub") and node[3] <= 6 and re.match(r"sp,\s*(sp,\s*)?#\d+", args):
+            node[2] += int(args.rsplit("#", 1)[1].split()[0])
+        elif op.startswith("blx") and not TARGET.search(args):
+            node[1] = True
+        elif op.startswith("bl") or op.startswith("b.") or op == "b":
+            t = TARGET.search(args)
+            if t and not t.group(2) and t.group(1) != func:
+                node[0].add(t.group(1))
+    # calls through a veneer are calls to what it jumps to
+    for node in graph.values():
+        node[0] = {VENEER.sub(r"\1", c) for c in node[0]}
+    return graph
+
+
+class Stack:
+    """Deepest path from a function, through its direct calls and the indirect calls the budget names."""
+
+    def __init__(self, graph, frames, indirect):
+        self.graph, self.frames, self.indirect = graph, frames, indirect
+        self.memo = {}
+        self.unresolved = set()
+        self.generic = set()
+        self.recursive = set()
+        self.dynamic = set()
+
+    def frame(self, func):
+        if func in self.frames:
+            size, qualifiers = self.frames[func]
+            if "dynamic" in qualifiers:
+                self.dynamic.add(func)
+            return size
+        return self.graph[func][2] if func in self.graph else 0
+
+    def callees(self, func):
+        callees, indirect = self.graph.get(func, (set(), False))[:2]
+        callees = set(callees)
+        if indirect:
+            if func in self.indirect:
+                callees |= set(self.indirect[func])
+            elif "*" in self.indirect:
+                callees |= set(self.indirect["*"])
+                self.generic.add(func)
+            else:
+                self.unresolved.add(func)
+        return callees
+
+    def deepest(self, func, path=()):
+        """(bytes, [functions]) of the deepest path from func."""
+        if func in self.memo:
+            return self.memo[func]
+        if func in path:
+            self.recursive.add(func)
+            return 0, []
+        best = (0, [])
+        for callee in sorted(self.callees(func)):
+            if callee in self.graph:
+                depth = self.deepest(callee, path + (func,))
+                if depth[0] > best[0]:
+                    best = depth
+        result = (self.frame(func) + best[0], [func] + best[1])
+        self.memo[func] = result
+        return result
+
+
+def section_size(sections, wanted):
+    return sum(size for name, _, _, _, size in sections if name == wanted)
+
+
+def headroom(used, percent):
+    """used plus percent, rounded up to a multiple of 256 bytes."""
+    return (int(used * (100 + percent) / 100) + 255) // 256 * 256
+
+
+def dump(value, indent=""):
+    """JSON laid out as memory_budget.json is: objects and lists of lists one item a line."""
+    inner = indent + "  "
+    if isinstance(value, dict) and value:
+        items = ['%s%s: %s' % (inner, json.dumps(k), dump(v, inner)) for k, v in value.items()]
+        return "{\n" + ",\n".join(items) + "\n" + indent + "}"
+    if isinstance(value, list) and value and all(isinstance(v, list) for v in value):
+        return "[\n" + ",\n".join(inner + dump(v, inner) for v in value) + "\n" + indent + "]"
+    return json.dumps(value)
+
+
+def set_budget(path, budget, measured, percent):
+    """Set each budget to what was measured plus headroom, record the figures, and write the file."""
+    for key, used in measured.items():
+        if used is not None and key in ("flash", "ram", "ramfunc", "stack"):
+            budget[key] = headroom(used, percent)
+    budget["measured"] = measured
+    with open(path, "w") as f:
+        f.write(dump(budget) + "\n")
+    print("\nbudgets set from this build with %g%% headroom: %s" % (
+        percent, ", ".join("%s %d" % (k, budget[k]) for k in ("flash", "ram", "ramfunc", "stack") if k in budget)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Report and check the firmware's flash, SRAM and stack use")
+    parser.add_argument("elf", nargs="?", default=ELF, help="firmware to report on (default: the nucleo_f091rc build)")
+    parser.add_argument("--budget", default=BUDGET, help="budget file (default: memory_budget.json)")
+    parser.add_argument("--objdump", default="arm-none-eabi-objdump", help="objdump for the call graph")
+    parser.add_argument("--top", type=int, default=15, help="how many of the largest symbols and frames to list")
+    parser.add_argument("--set-budget", type=float, metavar="PERCENT",
+                        help="set the budgets to this build's figures plus PERCENT headroom, and record the figures")
+    args = parser.parse_args()
+    if not os.path.exists(args.elf):
+        sys.exit("no %s; build it with: pio run -e nucleo_f091rc" % args.elf)
+    with open(args.budget) as f:
+        budget = json.load(f)
+
+    sections, symbols = read_elf(args.elf)
+    flash, ram, in_flash, in_sram = memory(sections, symbols)
+    absolute = {name: value for name, value, _, _, shndx in symbols if shndx == SHN_ABS}
+    reserved = absolute.get("_Min_Stack_Size")
+    ramfunc = section_size(sections, ".ramfunc")
+
+    if "measured" not in budget:
+        print("the budgets in %s are round figures, not yet set from a build (--set-budget)\n" % args.budget)
+    print("flash  %7d bytes of a %d budget (%.1f%%)" % (flash, budget["flash"], 100.0 * flash / budget["flash"]))
+    print("sram   %7d bytes static of a %d budget (%.1f%%)" % (ram, budget["ram"], 100.0 * ram / budget["ram"]))
+    if "ramfunc" in budget:
+        print("       %7d of them .ramfunc, of a %d budget" % (ramfunc, budget["ramfunc"]))
+    else:
+        print("       %7d of them .ramfunc" % ramfunc)
+    for title, rows in (("largest in flash", in_flash), ("largest in SRAM", in_sram)):
+        print("\n%s" % title)
+        for size, name, section in rows[:args.top]:
+            print("  %-36s %7d  %s" % (name, size, section))
+
+    frames = stack_usage(os.path.dirname(os.path.abspath(args.elf)))
+    if frames:
+        print("\nlargest stack frames")
+        for func, (size, qualifiers) in sorted(frames.items(), key=lambda kv: -kv[1][0])[:args.top]:
+            print("  %-36s %7d  %s" % (func, size, qualifiers))
+
+    failures = []
+    if flash > budget["flash"]:
+        failures.append("flash is %d bytes, over the budget of %d" % (flash, budget["flash"]))
+    if ram > budget["ram"]:
+        failures.append("static SRAM is %d bytes, over the budget of %d" % (ram, budget["ram"]))
+    if ramfunc > budget.get("ramfunc", ramfunc):
+        failures.append(".ramfunc is %d bytes, over the budget of %d" % (ramfunc, budget["ramfunc"]))
+    if reserved is not None and reserved < budget["stack"]:
+        failures.append("the linker script reserves %d bytes of stack, less than the budget of %d" % (reserved, budget["stack"]))
+
+    total = None
+    objdump = shutil.which(args.objdump)
+    if not objdump:
+        print("\nno %s on the PATH, so no call graph and no worst-case stack" % args.objdump)
+    else:
+        stack = Stack(call_graph(objdump, args.elf), frames, budget.get("indirect", {}))
+        print("\ndeepest stack from each entry point")
+        entry = "Reset_Handler" if "Reset_Handler" in stack.graph else "main"
+        depth, path = stack.deepest(entry)
+        total = depth
+        print("  %-36s %7d  %s" % (entry, depth, " > ".join(path)))
+        for level, handlers in enumerate(budget.get("priorities", [])):
+            worst = 0
+            for handler in handlers:
+                if handler not in stack.graph:
+                    continue
+                depth, path = stack.deepest(handler)
+                print("  %-36s %7d  %s" % ("%s (level %d)" % (handler, level), depth + EXCEPTION_FRAME,
+                                            " > ".join(path)))
+                worst = max(worst, depth + EXCEPTION_FRAME)
+            total += worst
+        print("worst case, every level preempting the one below: %d bytes of a %d budget" % (total, budget["stack"]))
+        if stack.generic:
+            print("calls through pointers followed to the \"*\" functions only: %s" % ", ".join(sorted(stack.generic)))
+        if stack.unresolved:
+            print("calls through pointers not followed: %s" % ", ".join(sorted(stack.unresolved)))
+        if stack.recursive:
+            print("recursion, counted once: %s" % ", ".join(sorted(stack.recursive)))
+        if stack.dynamic:
+            print("frames that grow at run time, counted at their fixed part: %s" % ", ".join(sorted(stack.dynamic)))
+        if total > budget["stack"]:
+            failures.append("the worst-case stack is %d bytes, over the budget of %d" % (total, budget["stack"]))
+
+    if args.set_budget is not None:
+        set_budget(args.budget, budget, {"flash": flash, "ram": ram, "ramfunc": ramfunc, "stack": total,
+                                         "reserved_stack": reserved}, args.set_budget)
+        if total is None:
+            print("no worst-case stack without %s, so the stack budget is as it was" % args.objdump)
+        elif reserved is not None and budget["stack"] > reserved:
+            print("the stack budget is more than the %d bytes the linker script reserves: raise _Min_Stack_Size"
+                  % reserved)
+        return
+
+    if failures:
+        print()
+        for line in failures:
+            print("over budget: " + line)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
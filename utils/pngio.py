@@ -0,0 +1,112 @@
+# Minimal PNG reading and writing for the asset tools, using only the
+# standard library. Handles 8-bit greyscale, RGB, palette and RGBA images,
+# which is what image editors export for sprites of this size.
+
+import struct
+import zlib
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+
+def _paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def _unfilter(raw, width, height, bpp):
+    stride = width * bpp
+    out = []
+    prev = bytearray(stride)
+    pos = 0
+    for _ in range(height):
+        ftype = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xff
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xff
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xff
+            elif ftype == 4:
+                line[i] = (line[i] + _paeth(a, b, c)) & 0xff
+        out.append(line)
+        prev = line
+    return out
+
+
+def read_png(path):
+    """Return (width, height, rows) where rows[y][x] is an (r, g, b, a) tuple."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != PNG_SIGNATURE:
+        raise ValueError("%s: not a PNG file" % path)
+    pos = 8
+    idat = b""
+    palette, trns = [], b""
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif ctype == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif ctype == b"tRNS":
+            trns = body
+        elif ctype == b"IDAT":
+            idat += body
+        elif ctype == b"IEND":
+            break
+    if depth != 8 or interlace != 0 or color not in (0, 2, 3, 6):
+        raise ValueError("%s: only 8-bit, non-interlaced grey/RGB/palette/RGBA PNGs are supported" % path)
+
+    bpp = {0: 1, 2: 3, 3: 1, 6: 4}[color]
+    lines = _unfilter(zlib.decompress(idat), width, height, bpp)
+    rows = []
+    for line in lines:
+        if color == 0:
+            row = [(v, v, v, 255) for v in line]
+        elif color == 2:
+            row = [tuple(line[i:i + 3]) + (255,) for i in range(0, len(line), 3)]
+        elif color == 3:
+            row = [palette[v] + (trns[v] if v < len(trns) else 255,) for v in line]
+        else:
+            row = [tuple(line[i:i + 4]) for i in range(0, len(line), 4)]
+        rows.append(row)
+    return width, height, rows
+
+
+def write_png(path, width, height, rows):
+    """Write rows of (r, g, b, a) tuples as an 8-bit RGBA PNG."""
+    raw = bytearray()
+    for row in rows:
+        raw.append(0)
+        for px in row:
+            raw += bytes(px)
+
+    def chunk(ctype, body):
+        return struct.pack(">I", len(body)) + ctype + body + struct.pack(">I", zlib.crc32(ctype + body) & 0xffffffff)
+
+    with open(path, "wb") as f:
+        f.write(PNG_SIGNATURE)
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 6, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+def to_rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def from_rgb565(c):
+    """Expand RGB565 to 8 bits per channel so that to_rgb565 gives c back."""
+    r, g, b = (c >> 11) & 0x1f, (c >> 5) & 0x3f, c & 0x1f
+    return (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)
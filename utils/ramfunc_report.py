@@ -0,0 +1,145 @@
+# Reports the SRAM spent on RAMFUNC code (src/ramfunc.h), from the linker
+# map that platformio.ini has the build write next to firmware.elf:
+#   python utils/ramfunc_report.py                     # the nucleo_f091rc build
+#   python utils/ramfunc_report.py path/to/firmware.map --limit 2048
+#
+# Lists each function in .ramfunc with its object file and size, then where
+# the rest of SRAM goes. The map only names global symbols, so a static
+# helper's bytes are counted with the function before it, or as (static)
+# at the start of its object. With --limit, or the "ramfunc" budget in
+# memory_budget.json when there is one, the exit status is 1 if .ramfunc
+# is larger than that many bytes.
+#
+# The .ramfunc placement has not yet been linked for the target here, so
+# no size is recorded: the first build should check the kernels this lists
+# and their size, then set the budget with memory_report.py --set-budget.
+
+import argparse
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+MAP = os.path.join(ROOT, ".pio", "build", "nucleo_f091rc", "firmware.map")
+BUDGET = os.path.join(ROOT, "memory_budget.json")
+
+# output sections in SRAM, in the order stm32f091rc.ld places them
+RAM_SECTIONS = [".ramfunc", ".data", ".bss", "._user_heap_stack"]
+
+SECTION = re.compile(r"^(\.\S+)?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+(.*))?$")
+SYMBOL = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+([A-Za-z_]\w*)$")
+MEMORY = re.compile(r"^(\w+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+
+
+def parse(path):
+    """The memory regions, output sections and .ramfunc contents of a GNU ld map file."""
+    with open(path) as f:
+        lines = f.read().split("\n")
+
+    regions = {}
+    i = lines.index("Memory Configuration") + 3 if "Memory Configuration" in lines else len(lines)
+    while i < len(lines) and lines[i].strip():
+        m = MEMORY.match(lines[i])
+        if m:
+            regions[m.group(1)] = (int(m.group(2), 16), int(m.group(3), 16))
+        i += 1
+
+    sections = {}  # name -> (address, size)
+    inputs = []  # (address, size, object) of the .ramfunc input sections
+    symbols = []  # (address, name) in .ramfunc
+    current = None
+    pending = None  # a section name ld put on a line of its own because it is long
+    for line in lines:
+        if not line.strip():
+            continue
+        if not line[0].isspace():
+            name = line.split()[0]
+            if len(line.split()) == 1:
+                pending, current = name, None
+                continue
+            m = SECTION.match(line)
+            current = m.group(1) if m else None
+            if m:
+                sections[current] = (int(m.group(2), 16), int(m.group(3), 16))
+            pending = None
+            continue
+        m = SECTION.match(line)
+        if pending and m and not m.group(1):
+            # the rest of a wrapped output section line
+            current = pending
+            sections[current] = (int(m.group(2), 16), int(m.group(3), 16))
+            pending = None
+            continue
+        pending = None
+        if current != ".ramfunc":
+            continue
+        s = SYMBOL.match(line)
+        if s:
+            symbols.append((int(s.group(1), 16), s.group(2)))
+            continue
+        m = re.match(r"^ (\.ramfunc\S*)?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$", line)
+        if m:
+            inputs.append((int(m.group(2), 16), int(m.group(3), 16), m.group(4)))
+    return regions, sections, inputs, symbols
+
+
+def functions(inputs, symbols):
+    """(name, object, size) of each .ramfunc symbol: up to the next one, or the end of its input section."""
+    out = []
+    for addr, size, obj in inputs:
+        inside = sorted(s for s in symbols if addr <= s[0] < addr + size)
+        if not inside or inside[0][0] > addr:
+            inside.insert(0, (addr, "(static)"))
+        for k, (start, name) in enumerate(inside):
+            end = inside[k + 1][0] if k + 1 < len(inside) else addr + size
+            out.append((name, os.path.basename(obj), end - start))
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Report the SRAM taken by RAMFUNC code")
+    parser.add_argument("map", nargs="?", default=MAP, help="linker map file (default: the nucleo_f091rc build)")
+    parser.add_argument("--limit", type=int,
+                        help="fail if .ramfunc is more than this many bytes (default: the budget, if one is set)")
+    parser.add_argument("--budget", default=BUDGET, help="budget file (default: memory_budget.json)")
+    args = parser.parse_args()
+    if not os.path.exists(args.map):
+        sys.exit("no %s; build it with: pio run -e nucleo_f091rc" % args.map)
+    budget = {}
+    if os.path.exists(args.budget):
+        with open(args.budget) as f:
+            budget = json.load(f)
+    if args.limit is None:
+        args.limit = budget.get("ramfunc")
+
+    regions, sections, inputs, symbols = parse(args.map)
+    ram = regions.get("RAM", (0x20000000, 32 * 1024))[1]
+    total = sections.get(".ramfunc", (0, 0))[1]
+
+    print("%-24s %-16s %6s" % ("RAMFUNC", "object", "bytes"))
+    for name, obj, size in functions(inputs, symbols):
+        print("%-24s %-16s %6d" % (name, obj, size))
+    print("%-41s %6d  (%.1f%% of SRAM)" % (".ramfunc", total, 100.0 * total / ram))
+    measured = (budget.get("measured") or {}).get("ramfunc")
+    if measured is None:
+        print("no .ramfunc size recorded in %s yet (memory_report.py --set-budget)" % args.budget)
+    elif measured != total:
+        print("%d bytes when the budget was set" % measured)
+
+    print("\nSRAM %d bytes" % ram)
+    used = 0
+    for name in RAM_SECTIONS:
+        if name in sections:
+            size = sections[name][1]
+            used += size
+            print("  %-20s %6d" % (name, size))
+    print("  %-20s %6d" % ("unused", ram - used))
+
+    if args.limit is not None and total > args.limit:
+        print("\n.ramfunc is %d bytes, over the limit of %d" % (total, args.limit))
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
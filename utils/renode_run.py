@@ -0,0 +1,273 @@
+# Runs the firmware in Renode (renode/flappy.resc) with a scripted button,
+# then prints frame and SPI statistics: the telemetry summary from
+# utils/telemetry.py, the counters the firmware keeps, and what the
+# simulated display received. Needs Renode on the PATH (or --renode) and a
+# build of the nucleo_f091rc env; run it from anywhere.
+#   python utils/renode_run.py                         # 20 s, a press every 400 ms
+#   python utils/renode_run.py --seconds 60 --presses presses.txt
+#   python utils/renode_run.py --save-baseline renode/baseline.json
+#   python utils/renode_run.py --baseline renode/baseline.json --tolerance 5
+#
+# A presses file has one press per line: the time it goes down and how
+# long it is held, in seconds ("2.5 0.05"). With --baseline the run fails
+# (exit status 1) if the frames cost more than the baseline's by more than
+# --tolerance percent, which is how a slower TIM17 frame task shows up.
+#
+# Simulated time is instructions at 48 per microsecond, so render_us counts
+# the work a frame does, not the hardware's wait states or SPI clocks, and
+# the same firmware and presses give the same numbers on any machine.
+#
+# No baseline is committed yet: the platform and the stubs in renode/ have
+# not been run against a target build. The first run on a machine with
+# Renode and the ARM toolchain should check the frame counts and display
+# statistics it prints, then save renode/baseline.json with
+# --save-baseline for later runs to compare against.
+
+import argparse
+import json
+import os
+import re
+import shutil
+import socket
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from telemetry import Decoder, percentile, summarize  # noqa: E402
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ELF = os.path.join(ROOT, ".pio", "build", "nucleo_f091rc", "firmware.elf")
+
+# firmware counters read at the end: symbol -> (field names, size of each)
+COUNTERS = {
+    "frame_count": (("frames_drawn",), "<H"),
+    "lcd_spi_bytes": (("lcd_spi_bytes",), "<I"),
+    "spibus_stats": (("bus_grants", "bus_switches", "bus_rebauds", "bus_yields", "bus_refusals"), "<I"),
+}
+
+# what the simulated display and 8-segment displays report
+STUBS = ["lcd Bytes", "lcd Commands", "lcd Pixels", "lcd Windows", "lcd Reads", "lcd FrameHash",
+         "segments Frames", "segments Text"]
+
+# baseline metrics that may only go down, and those that may only go up
+WORSE_IF_HIGHER = ("render_mean_us", "render_p99_us", "dropped_ticks")
+WORSE_IF_LOWER = ("frames",)
+
+
+def elf_symbols(path):
+    """Address of every data and function symbol in a 32-bit little-endian ELF."""
+    with open(path, "rb") as f:
+        elf = f.read()
+    if elf[:4] != b"\x7fELF" or elf[4] != 1 or elf[5] != 1:
+        sys.exit("%s is not a 32-bit little-endian ELF" % path)
+    shoff, = struct.unpack_from("<I", elf, 32)
+    shentsize, shnum = struct.unpack_from("<HH", elf, 46)
+    sections = [struct.unpack_from("<IIIIIIIIII", elf, shoff + i * shentsize) for i in range(shnum)]
+    symbols = {}
+    for sh in sections:
+        if sh[1] != 2:  # SHT_SYMTAB
+            continue
+        strtab = sections[sh[6]]
+        for off in range(sh[4], sh[4] + sh[5], 16):
+            name, value, size, info = struct.unpack_from("<IIIB", elf, off)
+            if info & 0xf in (1, 2):  # STT_OBJECT, STT_FUNC
+                end = elf.index(b"\0", strtab[4] + name)
+                symbols[elf[strtab[4] + name:end].decode()] = value
+    return symbols
+
+
+class Monitor:
+    """Renode's monitor, over the telnet port it opens with --port."""
+
+    PROMPT = re.compile(rb"\(([\w-]+)\) $")
+    ESCAPES = re.compile(rb"\x1b\[[0-9;?]*[A-Za-z]|\xff[\xfb-\xfe].|\xff[\xf0-\xfa]")
+
+    def __init__(self, port, timeout):
+        deadline = time.time() + timeout
+        while True:
+            try:
+                self.sock = socket.create_connection(("127.0.0.1", port), timeout=timeout)
+                break
+            except OSError:
+                if time.time() > deadline:
+                    sys.exit("Renode's monitor did not come up on port %d" % port)
+                time.sleep(0.5)
+        self.read_reply()
+
+    def read_reply(self):
+        data = b""
+        while True:
+            chunk = self.sock.recv(4096)
+            if not chunk:
+                sys.exit("Renode closed the monitor")
+            data = self.ESCAPES.sub(b"", data + chunk)
+            if self.PROMPT.search(data):
+                return data.decode(errors="replace")
+
+    def run(self, command):
+        self.sock.sendall(command.encode() + b"\n")
+        reply = self.read_reply()
+        lines = reply.replace("\r", "").split("\n")
+        # drop the echoed command and the prompt
+        out = "\n".join(line for line in lines[:-1] if line.strip() != command.strip()).strip()
+        if "error" in out.lower() or "no such command" in out.lower():
+            sys.exit("%s: %s" % (command, out))
+        return out
+
+    def value(self, command):
+        m = re.search(r"0x[0-9A-Fa-f]+|-?\d+", self.run(command))
+        return int(m.group(0), 0) if m else None
+
+
+def press_schedule(args):
+    if args.presses:
+        with open(args.presses) as f:
+            rows = [line.split() for line in f if line.strip() and not line.startswith("#")]
+        return sorted((float(r[0]), float(r[1]) if len(r) > 1 else 0.05) for r in rows)
+    t, presses = args.first_press, []
+    while t < args.seconds:
+        presses.append((t, 0.05))
+        t += args.interval
+    return presses
+
+
+def simulate(args, telemetry_path):
+    symbols = elf_symbols(args.elf)
+    missing = [s for s in COUNTERS if s not in symbols]
+    if missing:
+        sys.exit("%s has no %s" % (args.elf, ", ".join(missing)))
+
+    renode = subprocess.Popen([args.renode, "--disable-xwt", "--port", str(args.port)], cwd=ROOT,
+                              stdout=subprocess.DEVNULL if not args.verbose else None, stderr=subprocess.STDOUT)
+    try:
+        mon = Monitor(args.port, 60)
+        mon.run("$elf=@%s" % os.path.abspath(args.elf))
+        mon.run("$telemetry=@%s" % telemetry_path)
+        mon.run("include @renode/flappy.resc")
+        if args.eeprom and os.path.exists(args.eeprom):
+            mon.run("i2c1.eeprom Load @%s" % os.path.abspath(args.eeprom))
+
+        # run in steps, pressing and releasing the button on the way
+        events = []
+        for down, held in press_schedule(args):
+            events += [(down, "Press"), (down + held, "Release")]
+        events.sort()
+        now = 0.0
+        for t, action in events + [(args.seconds, None)]:
+            t = min(t, args.seconds)
+            if t > now:
+                mon.run('emulation RunFor "%.6f"' % (t - now))
+                now = t
+            if action and now < args.seconds:
+                mon.run("gpioPortA.button %s" % action)
+
+        stats = {}
+        for symbol, (fields, fmt) in COUNTERS.items():
+            read = "ReadWord" if fmt == "<H" else "ReadDoubleWord"
+            values = [mon.value("sysbus %s 0x%08x" % (read, symbols[symbol] + 4 * i)) for i in range(len(fields))]
+            stats.update(zip(fields, values))
+        for stub in STUBS:
+            peripheral, prop = stub.split()
+            out = mon.run("%s.%s %s" % ("spi1" if peripheral == "lcd" else "spi2", peripheral, prop))
+            stats["%s_%s" % (peripheral, prop.lower())] = out.strip('"')
+        if args.frame:
+            mon.run("spi1.lcd SaveFrame @%s" % os.path.abspath(args.frame))
+        if args.eeprom:
+            mon.run("i2c1.eeprom Save @%s" % os.path.abspath(args.eeprom))
+        mon.sock.sendall(b"quit\n")
+    finally:
+        try:
+            renode.wait(timeout=30)
+        except subprocess.TimeoutExpired:
+            renode.kill()
+    return stats
+
+
+def frame_metrics(records):
+    frames = [r for r in records if r["type"] == "frame"]
+    render = [r["render_us"] for r in frames]
+    if not frames:
+        return {"frames": 0}
+    return {
+        "frames": len(frames),
+        "render_mean_us": round(sum(render) / len(render), 1),
+        "render_p99_us": percentile(render, 99),
+        "spi_bytes_per_frame": round(sum(r["spi_bytes"] for r in frames) / len(frames), 1),
+        "dropped_ticks": sum(r["dropped_ticks"] for r in frames),
+    }
+
+
+def compare(metrics, baseline, tolerance):
+    """Lines describing each metric that is worse than the baseline by more than tolerance percent."""
+    worse = []
+    for key in WORSE_IF_HIGHER + WORSE_IF_LOWER:
+        if key not in baseline:
+            continue
+        old, new = baseline[key], metrics.get(key, 0)
+        limit = old * (1 + tolerance / 100.0) if key in WORSE_IF_HIGHER else old * (1 - tolerance / 100.0)
+        if (new > limit and key in WORSE_IF_HIGHER) or (new < limit and key in WORSE_IF_LOWER):
+            worse.append("%-20s %10s -> %s" % (key, old, new))
+    return worse
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run Flappy Chip in Renode and report frame and SPI statistics")
+    parser.add_argument("--elf", default=ELF, help="firmware to run (default: the nucleo_f091rc build)")
+    parser.add_argument("--renode", default="renode", help="Renode executable")
+    parser.add_argument("--port", type=int, default=33334, help="monitor port")
+    parser.add_argument("--seconds", type=float, default=20.0, help="simulated time to run")
+    parser.add_argument("--presses", help="file of press times and hold times, in seconds")
+    parser.add_argument("--first-press", type=float, default=2.0, help="without --presses: first press, after boot")
+    parser.add_argument("--interval", type=float, default=0.4, help="without --presses: time between presses")
+    parser.add_argument("--eeprom", help="load the EEPROM from this file if it exists, and save it back after")
+    parser.add_argument("--frame", help="save the last frame on the display to this PPM file")
+    parser.add_argument("--telemetry", help="keep the raw telemetry capture in this file")
+    parser.add_argument("--baseline", help="fail if worse than the metrics in this JSON file")
+    parser.add_argument("--tolerance", type=float, default=3.0, help="percent worse than the baseline allowed")
+    parser.add_argument("--save-baseline", help="write this run's metrics to a JSON file")
+    parser.add_argument("--verbose", action="store_true", help="show Renode's own output")
+    args = parser.parse_args()
+    if not os.path.exists(args.elf):
+        sys.exit("no %s; build it with: pio run -e nucleo_f091rc" % args.elf)
+    if not shutil.which(args.renode):
+        sys.exit("no %s on the PATH; install Renode (https://renode.io) or give --renode" % args.renode)
+    if args.baseline and not os.path.exists(args.baseline):
+        sys.exit("no %s; save one from a run you have checked, with --save-baseline" % args.baseline)
+
+    capture = args.telemetry or tempfile.mkstemp(suffix=".bin")[1]
+    try:
+        stats = simulate(args, os.path.abspath(capture))
+        with open(capture, "rb") as f:
+            data = f.read()
+    finally:
+        if not args.telemetry:
+            os.remove(capture)
+
+    dec = Decoder()
+    records = dec.feed(data)
+    summarize(records, dec, sys.stdout)
+    for key, value in stats.items():
+        print("%-20s %s" % (key, value))
+
+    metrics = frame_metrics(records)
+    if args.save_baseline:
+        with open(args.save_baseline, "w") as f:
+            json.dump(metrics, f, indent=2, sort_keys=True)
+            f.write("\n")
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        worse = compare(metrics, baseline, args.tolerance)
+        if worse:
+            print("worse than %s by more than %.1f%%:" % (args.baseline, args.tolerance))
+            for line in worse:
+                print("  " + line)
+            sys.exit(1)
+        print("within %.1f%% of %s" % (args.tolerance, args.baseline))
+
+
+if __name__ == "__main__":
+    main()
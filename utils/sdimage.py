@@ -0,0 +1,225 @@
+# Builds an SD card image holding the assets as .565 files, for the
+# firmware's card store (src/store.h). Each asset in assets/assets.json
+# becomes NAME.565 (the name cut to 8 characters, upper case): a
+# little-endian width and height, then the RGB565 pixels row by row, with
+# transparent pixels as the asset's key color.
+#
+# The image is a FAT16 volume (or FAT32 with --fat32) with every file in
+# one run of clusters, so the firmware reads it without walking the FAT.
+# --fragment N scatters each file's clusters instead, as on a card that
+# has been written to for a while, for testing the FAT walk.
+# Write it to a card with dd, or copy the .565 files onto a card that is
+# already formatted:
+#   python utils/sdimage.py card.img                  # whole card, FAT16
+#   python utils/sdimage.py card.img --fat32 --partition
+#   python utils/sdimage.py card.img --dir LEVEL1     # files in a directory
+#   python utils/sdimage.py card.img --fragment 3     # chains in runs of 3
+#   python utils/sdimage.py --files out/              # just the .565 files
+#
+# A host build of src/store.c (-DSD_HOST) reads the image directly.
+
+import argparse
+import json
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from assetc import ROOT, Image  # noqa: E402
+
+BLOCK = 512
+PARTITION_START = 2048  # blocks, the usual 1 MiB alignment
+
+
+def short_name(name):
+    """The 8.3 file name for an asset."""
+    return name[:8].upper() + ".565"
+
+
+def image_file(img):
+    rows = img.keyed() if img.key is not None else [[0 if p is None else p for p in row] for row in img.pixels]
+    data = struct.pack("<HH", img.width, img.height)
+    for row in rows:
+        data += struct.pack("<%dH" % len(row), *row)
+    return data
+
+
+def fat_name(name):
+    """The 11 character directory form of an 8.3 name."""
+    if name in (".", ".."):
+        return name.ljust(11).encode("ascii")
+    base, _, ext = name.partition(".")
+    return (base.ljust(8) + ext.ljust(3)).encode("ascii")
+
+
+def dir_entry(name, attr, cluster, size):
+    return struct.pack("<11sBBBHHHHHHHI", fat_name(name), attr, 0, 0, 0, 0, 0, cluster >> 16, 0, 0x21,
+                       cluster & 0xFFFF, size)
+
+
+class Volume:
+    """A FAT16 or FAT32 volume being laid out in memory."""
+
+    def __init__(self, blocks, fat32, fragment=0):
+        self.fat32 = fat32
+        self.fragment = fragment
+        self.blocks = blocks
+        self.per_cluster = 1 if fat32 else 4
+        self.reserved = 32 if fat32 else 1
+        self.root_entries = 0 if fat32 else 512
+        root_blocks = self.root_entries * 32 // BLOCK
+        entry = 4 if fat32 else 2
+        # the FAT has to cover the clusters left after it
+        self.fat_blocks = 1
+        while True:
+            clusters = (blocks - self.reserved - 2 * self.fat_blocks - root_blocks) // self.per_cluster
+            need = ((clusters + 2) * entry + BLOCK - 1) // BLOCK
+            if need <= self.fat_blocks:
+                break
+            self.fat_blocks = need
+        self.clusters = clusters
+        if fat32 and clusters < 65525 or not fat32 and not 4085 <= clusters < 65525:
+            sys.exit("%d clusters is the wrong size for FAT%d; pick another --size" % (clusters, 32 if fat32 else 16))
+        self.root_start = self.reserved + 2 * self.fat_blocks
+        self.data_start = self.root_start + root_blocks
+        self.fat = [0x0FFFFFF8 if fat32 else 0xFFF8, 0x0FFFFFFF if fat32 else 0xFFFF]
+        self.data = {}  # cluster -> bytes
+        self.root = []  # root directory entries
+        self.root_cluster = self.allocate(b"") if fat32 else 0
+
+    def allocate(self, data):
+        """Put data in a run of new clusters and return the first (0 if empty)."""
+        size = self.per_cluster * BLOCK
+        count = max(1, (len(data) + size - 1) // size)
+        first = len(self.fat)
+        if first + count > self.clusters + 2:
+            sys.exit("the files do not fit; pick a bigger --size")
+        # the order the chain visits the run in: in a row, or with --fragment its runs of that many, last first
+        order = list(range(first, first + count))
+        if self.fragment:
+            runs = [order[i:i + self.fragment] for i in range(0, count, self.fragment)]
+            order = [c for run in reversed(runs) for c in run]
+        self.fat.extend([0] * count)
+        for i, cluster in enumerate(order):
+            self.fat[cluster] = order[i + 1] if i < count - 1 else (0x0FFFFFFF if self.fat32 else 0xFFFF)
+            self.data[cluster] = data[i * size:(i + 1) * size]
+        return order[0]
+
+    def add(self, directory, name, data):
+        """Add a file to the root (directory None) or to a directory made by mkdir."""
+        entries = self.root if directory is None else directory["entries"]
+        entries.append(dir_entry(name, 0x20, self.allocate(data) if data else 0, len(data)))
+
+    def mkdir(self, name):
+        """Add a directory to the root. Its entries go in its one cluster when closed."""
+        cluster = self.allocate(b"")
+        self.root.append(dir_entry(name, 0x10, cluster, 0))
+        # ".." to the root is cluster 0, on FAT32 too
+        return {"cluster": cluster, "entries": [dir_entry(".", 0x10, cluster, 0), dir_entry("..", 0x10, 0, 0)]}
+
+    def close(self, directory=None):
+        """Write out a directory made by mkdir, or with no argument the FAT32 root."""
+        entries, cluster = (self.root, self.root_cluster) if directory is None else \
+            (directory["entries"], directory["cluster"])
+        data = b"".join(entries)
+        if len(data) > self.per_cluster * BLOCK:
+            sys.exit("too many files for one directory cluster")
+        self.data[cluster] = data
+
+    def boot_sector(self, hidden):
+        b = bytearray(BLOCK)
+        b[0:3] = b"\xEB\x58\x90" if self.fat32 else b"\xEB\x3C\x90"
+        b[3:11] = b"FLAPPY  "
+        total16 = self.blocks if self.blocks < 0x10000 and not self.fat32 else 0
+        struct.pack_into("<HBHBHHBHHHII", b, 11, BLOCK, self.per_cluster, self.reserved, 2, self.root_entries,
+                         total16, 0xF8, 0 if self.fat32 else self.fat_blocks, 63, 255, hidden,
+                         0 if total16 else self.blocks)
+        if self.fat32:
+            struct.pack_into("<IHHIHH", b, 36, self.fat_blocks, 0, 0, self.root_cluster, 1, 6)
+            struct.pack_into("<BBBI11s8s", b, 64, 0x80, 0, 0x29, 0x12345678, b"FLAPPY     ", b"FAT32   ")
+        else:
+            struct.pack_into("<BBBI11s8s", b, 36, 0x80, 0, 0x29, 0x12345678, b"FLAPPY     ", b"FAT16   ")
+        b[510:512] = b"\x55\xAA"
+        return bytes(b)
+
+    def write(self, f, offset, hidden):
+        """Write the volume at block offset of the image file f."""
+        base = offset * BLOCK
+        f.seek(base)
+        f.write(self.boot_sector(hidden))
+        if self.fat32:
+            fsinfo = bytearray(BLOCK)
+            struct.pack_into("<I", fsinfo, 0, 0x41615252)
+            struct.pack_into("<III", fsinfo, 484, 0x61417272, 0xFFFFFFFF, 0xFFFFFFFF)
+            fsinfo[510:512] = b"\x55\xAA"
+            f.seek(base + BLOCK)
+            f.write(fsinfo)
+            f.seek(base + 6 * BLOCK)
+            f.write(self.boot_sector(hidden))
+        entry = "<I" if self.fat32 else "<H"
+        fat = b"".join(struct.pack(entry, e) for e in self.fat)
+        for i in range(2):
+            f.seek(base + (self.reserved + i * self.fat_blocks) * BLOCK)
+            f.write(fat)
+        if not self.fat32:
+            f.seek(base + self.root_start * BLOCK)
+            f.write(b"".join(self.root))
+        for cluster, data in self.data.items():
+            f.seek(base + (self.data_start + (cluster - 2) * self.per_cluster) * BLOCK)
+            f.write(data)
+        f.seek(base + self.blocks * BLOCK - 1)
+        f.write(b"\0")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build an SD card image of the assets")
+    parser.add_argument("image", nargs="?", help="image file to write")
+    parser.add_argument("--assets", default=os.path.join(ROOT, "assets"), help="asset directory")
+    parser.add_argument("--size", type=int, help="volume size in MiB (default 32, or 64 with --fat32)")
+    parser.add_argument("--fat32", action="store_true", help="FAT32 instead of FAT16")
+    parser.add_argument("--partition", action="store_true", help="put the volume in a partition behind an MBR")
+    parser.add_argument("--dir", help="put the files in this directory (8 characters at most)")
+    parser.add_argument("--fragment", type=int, default=0, metavar="N",
+                        help="chain each file's clusters in runs of N, last run first, instead of in a row")
+    parser.add_argument("--files", metavar="DIR", help="write the .565 files to DIR instead of an image")
+    args = parser.parse_args()
+    if not args.image and not args.files:
+        parser.error("give an image file or --files")
+
+    with open(os.path.join(args.assets, "assets.json")) as f:
+        manifest = json.load(f)
+    files = [(short_name(name), image_file(Image(name, manifest[name], args.assets))) for name in sorted(manifest)]
+
+    if args.files:
+        os.makedirs(args.files, exist_ok=True)
+        for name, data in files:
+            with open(os.path.join(args.files, name), "wb") as f:
+                f.write(data)
+        return
+
+    blocks = (args.size or (64 if args.fat32 else 32)) * 2048
+    vol = Volume(blocks, args.fat32, args.fragment)
+    directory = vol.mkdir(args.dir.upper()[:8]) if args.dir else None
+    for name, data in files:
+        vol.add(directory, name, data)
+    if directory is not None:
+        vol.close(directory)
+    if args.fat32:
+        vol.close()
+
+    offset = PARTITION_START if args.partition else 0
+    with open(args.image, "wb") as f:
+        vol.write(f, offset, offset)
+        if args.partition:
+            mbr = bytearray(BLOCK)
+            kind = 0x0C if args.fat32 else 0x06
+            struct.pack_into("<B3sB3sII", mbr, 446, 0, b"\xFE\xFF\xFF", kind, b"\xFE\xFF\xFF", offset, blocks)
+            mbr[510:512] = b"\x55\xAA"
+            f.seek(0)
+            f.write(mbr)
+    for name, data in files:
+        print("%-14s %8d bytes" % ((args.dir.upper()[:8] + "/" if args.dir else "") + name, len(data)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,253 @@
+# Decodes the binary telemetry stream sent by the firmware on USART2
+# (see src/telemetry.h for the record format).
+#
+# Capture from the board:
+#   python telemetry.py /dev/ttyACM0 --baud 115200 --csv run.csv
+# Decode a saved capture, or anything piped in, such as the records from a
+# host build of src/telemetry.c compiled with -DTELEMETRY_HOST:
+#   python telemetry.py capture.bin --csv run.csv
+#   cc -DTELEMETRY_HOST -Isrc -Itest test/test_telemetry.c src/telemetry.c -o test_telemetry
+#   ./test_telemetry | python utils/telemetry.py - --csv run.csv
+#
+# The CSV has one row per record; the summary is printed to stderr.
+# --readout picks what the 8-segment displays show during a live capture:
+#   python telemetry.py /dev/ttyACM0 --readout rate
+#   python telemetry.py /dev/ttyACM0 --readout stack   # bytes of stack never touched
+
+import argparse
+import csv
+import struct
+import sys
+
+SYNC = 0xA5
+
+FRAME, INPUT, SCORE, EEPROM, BOOT, RATE, POWER, RAMFUNC, STACK, ARENA, GAME = 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11
+
+# command bytes accepted on the same port (TLM_CMD_* in src/telemetry.h)
+READOUTS = {"score": b"s", "rate": b"f", "misses": b"m", "stack": b"k"}
+
+# enum boot_stage in src/boot.h
+BOOT_STAGES = ["start", "lcd_start", "eeprom", "assets", "score_display", "lcd_ready", "lcd_link", "sd_card", "first_frame"]
+
+# enum ramfunc_kernel in src/ramfunc.h
+RAMFUNC_KERNELS = ["pic_subset", "pic_overlay", "pic_overlay_indexed", "pic_blit_indexed", "asset_row"]
+
+# record type -> (name, struct format after the u32 timestamp, field names)
+RECORDS = {
+    FRAME: ("frame", "<HHHB", ("frame", "render_us", "spi_bytes", "dropped_ticks")),
+    INPUT: ("input", "<B", ("pressed",)),
+    SCORE: ("score", "<H", ("score",)),
+    EEPROM: ("eeprom", "<BIb", ("op", "latency_us", "status")),
+    BOOT: ("boot", "<B", ("stage",)),
+    RATE: ("rate", "<HHH", ("period_us", "peak_us", "misses")),
+    POWER: ("power", "<IHHI", ("window_ms", "sleep_permille", "stop_permille", "est_ua")),
+    RAMFUNC: ("ramfunc", "<BIIH", ("kernel", "flash_us", "sram_us", "pixels")),
+    STACK: ("stack", "<HH", ("used", "margin")),
+    ARENA: ("arena", "<HHH", ("peak", "size", "overflows")),
+    GAME: ("game", "<HB", ("score", "autopilot")),
+}
+
+COLUMNS = ["ts_us", "seq", "type", "frame", "render_us", "spi_bytes", "dropped_ticks",
+           "pressed", "score", "op", "latency_us", "status", "stage", "period_us", "peak_us", "misses",
+           "window_ms", "sleep_permille", "stop_permille", "est_ua", "kernel", "flash_us", "sram_us", "pixels",
+           "used", "margin", "peak", "size", "overflows", "autopilot"]
+
+
+def crc8(data):
+    crc = 0
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xff if crc & 0x80 else (crc << 1) & 0xff
+    return crc
+
+
+class Decoder:
+    """Incremental decoder: feed() bytes, get back decoded records as dicts."""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.last_seq = None
+        self.crc_errors = 0
+        self.lost = 0
+        self.skipped = 0
+
+    def feed(self, data):
+        self.buf += data
+        out = []
+        while True:
+            start = self.buf.find(SYNC)
+            if start < 0:
+                self.skipped += len(self.buf)
+                self.buf.clear()
+                break
+            self.skipped += start
+            del self.buf[:start]
+            if len(self.buf) < 4:
+                break
+            rtype, length, seq = self.buf[1], self.buf[2], self.buf[3]
+            total = 5 + length
+            if len(self.buf) < total:
+                break
+            body = bytes(self.buf[1:4 + length])
+            if crc8(body) != self.buf[4 + length]:
+                # not a real record boundary: resync one byte further on
+                self.crc_errors += 1
+                del self.buf[:1]
+                continue
+            del self.buf[:total]
+            if self.last_seq is not None:
+                self.lost += (seq - self.last_seq - 1) & 0xff
+            self.last_seq = seq
+            rec = self.decode(rtype, seq, body[3:])
+            if rec is not None:
+                out.append(rec)
+        return out
+
+    @staticmethod
+    def decode(rtype, seq, payload):
+        if rtype not in RECORDS or len(payload) < 4:
+            return None
+        name, fmt, fields = RECORDS[rtype]
+        if len(payload) != 4 + struct.calcsize(fmt):
+            return None
+        rec = {"ts_us": struct.unpack_from("<I", payload)[0], "seq": seq, "type": name}
+        rec.update(zip(fields, struct.unpack_from(fmt, payload, 4)))
+        return rec
+
+
+def percentile(values, p):
+    if not values:
+        return 0
+    values = sorted(values)
+    k = min(len(values) - 1, int(round(p / 100.0 * (len(values) - 1))))
+    return values[k]
+
+
+def summarize(records, dec, out):
+    frames = [r for r in records if r["type"] == "frame"]
+    render = [r["render_us"] for r in frames]
+    spi = [r["spi_bytes"] for r in frames]
+    dropped = sum(r["dropped_ticks"] for r in frames)
+    inputs = [r for r in records if r["type"] == "input" and r["pressed"]]
+    scores = [r for r in records if r["type"] == "score"]
+    eeprom = [r for r in records if r["type"] == "eeprom"]
+    boot = [r for r in records if r["type"] == "boot"]
+    rates = [r for r in records if r["type"] == "rate"]
+    power = [r for r in records if r["type"] == "power"]
+    ramfunc = [r for r in records if r["type"] == "ramfunc"]
+    stack = [r for r in records if r["type"] == "stack"]
+    arena = [r for r in records if r["type"] == "arena"]
+    games = [r for r in records if r["type"] == "game"]
+
+    w = out.write
+    w("records          %d (lost %d, crc errors %d, skipped bytes %d)\n"
+      % (len(records), dec.lost, dec.crc_errors, dec.skipped))
+    if boot:
+        w("boot timeline (ms since start)\n")
+        t0 = boot[0]["ts_us"]
+        for r in boot:
+            name = BOOT_STAGES[r["stage"]] if r["stage"] < len(BOOT_STAGES) else str(r["stage"])
+            w("  %-14s %8.1f\n" % (name, ((r["ts_us"] - t0) & 0xffffffff) / 1000.0))
+    if frames:
+        span = (frames[-1]["ts_us"] - frames[0]["ts_us"]) & 0xffffffff
+        fps = (len(frames) - 1) * 1e6 / span if span else 0.0
+        w("frames           %d (%.1f fps)\n" % (len(frames), fps))
+        w("render_us        mean %.0f  p50 %d  p99 %d  max %d\n"
+          % (sum(render) / len(render), percentile(render, 50), percentile(render, 99), max(render)))
+        w("spi_bytes/frame  mean %.0f  max %d\n" % (sum(spi) / len(spi), max(spi)))
+        w("dropped ticks    %d (%.1f per frame)\n" % (dropped, dropped / len(frames)))
+    if rates:
+        periods = [r["period_us"] for r in rates]
+        changes = sum(1 for a, b in zip(periods, periods[1:]) if a != b)
+        w("frame period     final %d us (%.1f fps), %d changes, %d missed frames\n"
+          % (periods[-1], 1e6 / periods[-1], changes, rates[-1]["misses"]))
+    if power:
+        ms = sum(r["window_ms"] for r in power)
+        if ms:
+            share = lambda k: sum(r[k] * r["window_ms"] for r in power) / ms / 10.0
+            ua = sum(r["est_ua"] * r["window_ms"] for r in power) / ms
+            w("power            %.1f s: %.1f%% sleep, %.1f%% stop, est. %.2f mA average\n"
+              % (ms / 1000.0, share("sleep_permille"), share("stop_permille"), ua / 1000.0))
+    if ramfunc:
+        w("kernel timing    ns per pixel from flash, from SRAM\n")
+        for r in ramfunc:
+            name = RAMFUNC_KERNELS[r["kernel"]] if r["kernel"] < len(RAMFUNC_KERNELS) else str(r["kernel"])
+            px = r["pixels"] or 1
+            change = 100.0 * (r["sram_us"] - r["flash_us"]) / r["flash_us"] if r["flash_us"] else 0.0
+            w("  %-20s %7.1f %7.1f  (%+.1f%%)\n" % (name, 1000.0 * r["flash_us"] / px, 1000.0 * r["sram_us"] / px, change))
+    if stack:
+        w("stack            %d bytes at the deepest, %d never touched\n"
+          % (max(r["used"] for r in stack), min(r["margin"] for r in stack)))
+    if arena:
+        w("frame arena      %d of %d bytes at the most, %d allocations refused\n"
+          % (max(r["peak"] for r in arena), arena[-1]["size"], arena[-1]["overflows"]))
+    w("button presses   %d\n" % len(inputs))
+    if scores:
+        w("score changes    %d (final %d)\n" % (len(scores), scores[-1]["score"]))
+    if games:
+        w("games            %d (%d by the autopilot), best score %d\n"
+          % (len(games), sum(r["autopilot"] for r in games), max(r["score"] for r in games)))
+    for op, label in ((0, "read"), (1, "write")):
+        lat = [r["latency_us"] for r in eeprom if r["op"] == op]
+        if lat:
+            fails = sum(1 for r in eeprom if r["op"] == op and r["status"] != 0)
+            w("eeprom %-5s     %d ops  mean %.0f us  max %d us  failed %d\n"
+              % (label, len(lat), sum(lat) / len(lat), max(lat), fails))
+
+
+def is_serial(path):
+    return path.startswith("/dev/") or path.upper().startswith("COM")
+
+
+def open_source(path, baud):
+    if path == "-":
+        return sys.stdin.buffer
+    if is_serial(path):
+        import serial  # pyserial, only needed for live capture
+        return serial.Serial(path, baud, timeout=1)
+    return open(path, "rb")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode Flappy Chip telemetry")
+    parser.add_argument("source", help="capture file, serial port, or - for stdin")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--csv", help="write records to this CSV file (default stdout)")
+    parser.add_argument("--raw", help="also save the raw bytes to this file")
+    parser.add_argument("--readout", choices=sorted(READOUTS), help="what the 8-segment displays show (serial only)")
+    args = parser.parse_args()
+
+    src = open_source(args.source, args.baud)
+    if args.readout:
+        if not is_serial(args.source):
+            sys.exit("--readout needs a serial port")
+        src.write(READOUTS[args.readout])
+    raw = open(args.raw, "wb") if args.raw else None
+    csv_file = open(args.csv, "w", newline="") if args.csv else sys.stdout
+    writer = csv.DictWriter(csv_file, fieldnames=COLUMNS)
+    writer.writeheader()
+
+    dec = Decoder()
+    records = []
+    try:
+        while True:
+            chunk = src.read(4096)
+            if not chunk:
+                if is_serial(args.source):
+                    continue  # serial read timed out, keep capturing
+                break
+            if raw:
+                raw.write(chunk)
+            for rec in dec.feed(chunk):
+                records.append(rec)
+                writer.writerow(rec)
+    except KeyboardInterrupt:
+        pass
+
+    csv_file.flush()
+    summarize(records, dec, sys.stderr)
+
+
+if __name__ == "__main__":
+    main()